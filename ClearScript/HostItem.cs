@@ -13,6 +13,7 @@ using System.Reflection;
 using System.Runtime.InteropServices;
 using System.Runtime.InteropServices.ComTypes;
 using System.Runtime.InteropServices.Expando;
+using System.Threading;
 using Microsoft.ClearScript.Util;
 using Microsoft.ClearScript.Util.COM;
 
@@ -23,6 +24,7 @@ namespace Microsoft.ClearScript
         #region data
 
         private HostTargetMemberData targetMemberData;
+        private HostItemIdentity identity;
 
         private static readonly PropertyInfo[] reflectionProperties =
         {
@@ -129,6 +131,44 @@ namespace Microsoft.ClearScript
             }
         }
 
+        public HostTargetMemberData TypeMemberData
+        {
+            get
+            {
+                // only host objects without dynamic members have member data that is fully
+                // determined by their type and access settings
+
+                BindTargetMemberData();
+                if ((Target is HostObject) && (TargetDynamic is null) && (TargetPropertyBag is null) && (TargetList is null) && (TargetDynamicMetaObject is null))
+                {
+                    return targetMemberData;
+                }
+
+                return null;
+            }
+        }
+
+        public string[] GetTypeMemberNames()
+        {
+            return HostInvoke(
+                static self =>
+                {
+                    if (self.TypeMemberNames is null)
+                    {
+                        self.TypeMemberNames = self.GetLocalFieldNames().Concat(self.GetLocalEventNames()).Concat(self.GetLocalMethodNames()).Concat(self.GetLocalPropertyNames()).ExcludeIndices().Distinct().ToArray();
+                    }
+
+                    return self.TypeMemberNames;
+                },
+                this
+            );
+        }
+
+        public string[] GetExtensionMethodNames()
+        {
+            return TargetFlags.HasAllFlags(HostTargetFlags.AllowExtensionMethods) ? Engine.ExtensionMethodSummary.MethodNames : ArrayHelpers.GetEmptyArray<string>();
+        }
+
         public object InvokeMember(string name, BindingFlags invokeFlags, object[] args, object[] bindArgs, CultureInfo culture, bool bypassTunneling)
         {
             return InvokeMember(name, invokeFlags, args, bindArgs, culture, bypassTunneling, out _);
@@ -326,6 +366,12 @@ namespace Microsoft.ClearScript
             set => targetMemberData.AllMemberNames = value;
         }
 
+        private string[] TypeMemberNames
+        {
+            get => targetMemberData.TypeMemberNames;
+            set => targetMemberData.TypeMemberNames = value;
+        }
+
         private FieldInfo[] AllFields
         {
             get => targetMemberData.AllFields;
@@ -1864,7 +1910,7 @@ namespace Microsoft.ClearScript
 
         private static object CreateScriptableEnumerator<T>(IEnumerable<T> enumerable)
         {
-            return HostObject.Wrap(new ScriptableEnumeratorOnEnumerator<T>(enumerable.GetEnumerator()), typeof(IScriptableEnumerator<T>));
+            return HostObject.Wrap(new ScriptableEnumeratorOnEnumerator<T>(enumerable.GetEnumerator(), EnumerableHelpers.IsMaterialized(enumerable)), typeof(IScriptableEnumerator<T>));
         }
 
         private object CreateScriptableEnumerator()
@@ -1895,7 +1941,7 @@ namespace Microsoft.ClearScript
         private object CreateAsyncEnumerator<T>(IEnumerable<T> enumerable)
         {
             // ReSharper disable once NotDisposedResource
-            return HostObject.Wrap(new ScriptableAsyncEnumeratorOnEnumerator<T>(Engine, enumerable.GetEnumerator()), typeof(IScriptableAsyncEnumerator<T>));
+            return HostObject.Wrap(new ScriptableAsyncEnumeratorOnEnumerator<T>(Engine, enumerable.GetEnumerator(), EnumerableHelpers.IsMaterialized(enumerable)), typeof(IScriptableAsyncEnumerator<T>));
         }
 
         private object CreateAsyncEnumerator()
@@ -2442,6 +2488,12 @@ namespace Microsoft.ClearScript
 
         #endregion
 
+        #region IHostItem implementation
+
+        public int Identity => LazyInitializer.EnsureInitialized(ref identity, HostItemIdentity.Create).Value;
+
+        #endregion
+
         #region IHostTargetContext implementation
 
         public CustomAttributeLoader CustomAttributeLoader => CachedCustomAttributeLoader;
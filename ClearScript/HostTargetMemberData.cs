@@ -18,6 +18,7 @@ namespace Microsoft.ClearScript
         public string[] OwnMethodNames;
         public string[] AllPropertyNames;
         public string[] AllMemberNames;
+        public string[] TypeMemberNames;
 
         public FieldInfo[] AllFields;
         public MethodInfo[] AllMethods;
@@ -26,6 +27,7 @@ namespace Microsoft.ClearScript
         public object EnumerationSettingsToken;
         public ExtensionMethodSummary ExtensionMethodSummary;
         public Invocability? TargetInvocability;
+        public int TypeId;
     }
 
     internal class HostTargetMemberDataWithContext : HostTargetMemberData
@@ -6,6 +6,7 @@ using System.Collections;
 using System.Collections.Generic;
 using System.Globalization;
 using System.Linq;
+using System.Runtime.ExceptionServices;
 using System.Runtime.InteropServices.ComTypes;
 using System.Threading.Tasks;
 using Microsoft.ClearScript.JavaScript;
@@ -52,6 +53,11 @@ namespace Microsoft.ClearScript.Util
         object ScriptableDisposeAsync();
     }
 
+    internal interface IScriptableChunkedAsyncEnumerator
+    {
+        object FetchChunkAsync(int maxCount);
+    }
+
     internal static class EnumerableHelpers
     {
         public static IList<T> ToIList<T>(this IEnumerable<T> source)
@@ -105,6 +111,16 @@ namespace Microsoft.ClearScript.Util
             }
         }
 
+        public static bool IsMaterialized(IEnumerable source)
+        {
+            return source is ICollection;
+        }
+
+        public static bool IsMaterialized<T>(IEnumerable<T> source)
+        {
+            return (source is ICollection<T>) || (source is IReadOnlyCollection<T>) || (source is ICollection);
+        }
+
         public static IEnumerable<int> GetIndices(this IEnumerable<string> names)
         {
             foreach (var name in names)
@@ -126,12 +142,12 @@ namespace Microsoft.ClearScript.Util
         public static object GetScriptableEnumerator(IEnumerable source)
         {
             // ReSharper disable once NotDisposedResource
-            return HostObject.Wrap(new ScriptableEnumeratorOnEnumerator(source.GetEnumerator()), typeof(IScriptableEnumerator));
+            return HostObject.Wrap(new ScriptableEnumeratorOnEnumerator(source.GetEnumerator(), EnumerableHelpers.IsMaterialized(source)), typeof(IScriptableEnumerator));
         }
         public static object GetScriptableAsyncEnumerator(IEnumerable source, ScriptEngine engine)
         {
             // ReSharper disable once NotDisposedResource
-            return HostItem.Wrap(engine, new ScriptableAsyncEnumeratorOnEnumerator(engine, source.GetEnumerator()), typeof(IScriptableAsyncEnumerator<object>));
+            return HostItem.Wrap(engine, new ScriptableAsyncEnumeratorOnEnumerator(engine, source.GetEnumerator(), EnumerableHelpers.IsMaterialized(source)), typeof(IScriptableAsyncEnumerator<object>));
         }
     }
 
@@ -143,13 +159,13 @@ namespace Microsoft.ClearScript.Util
 
         public static object GetScriptableEnumerator(IEnumerable<T> source)
         {
-            return HostObject.Wrap(new ScriptableEnumeratorOnEnumerator<T>(source.GetEnumerator()), typeof(IScriptableEnumerator<T>));
+            return HostObject.Wrap(new ScriptableEnumeratorOnEnumerator<T>(source.GetEnumerator(), EnumerableHelpers.IsMaterialized(source)), typeof(IScriptableEnumerator<T>));
         }
 
         public static object GetScriptableAsyncEnumerator(IEnumerable<T> source, ScriptEngine engine)
         {
             // ReSharper disable once NotDisposedResource
-            return HostItem.Wrap(engine, new ScriptableAsyncEnumeratorOnEnumerator<T>(engine, source.GetEnumerator()), typeof(IScriptableAsyncEnumerator<T>));
+            return HostItem.Wrap(engine, new ScriptableAsyncEnumeratorOnEnumerator<T>(engine, source.GetEnumerator(), EnumerableHelpers.IsMaterialized(source)), typeof(IScriptableAsyncEnumerator<T>));
         }
 
         public static object GetScriptableAsyncEnumerator(IAsyncEnumerable<T> source, ScriptEngine engine)
@@ -159,11 +175,68 @@ namespace Microsoft.ClearScript.Util
         }
     }
 
-    internal sealed class ScriptableEnumeratorOnEnumerator : IScriptableEnumerator
+    internal abstract class ScriptableChunkedEnumerator
+    {
+        private readonly bool canPrefetch;
+        private ExceptionDispatchInfo pendingException;
+
+        protected ScriptableChunkedEnumerator(bool canPrefetch)
+        {
+            this.canPrefetch = canPrefetch;
+        }
+
+        public int GetChunk<TState>(ScriptEngine engine, int maxCount, in TState state, Action<TState, int, object> setItem)
+        {
+            // Only materialized collections are advanced past the item that script is about to
+            // consume; lazy or side-effecting enumerators yield one item per chunk. A failure after
+            // one or more items have been fetched is reported when the next chunk is requested.
+
+            ThrowPendingException(ref pendingException);
+
+            maxCount = GetMaxChunkCount(maxCount);
+            var count = 0;
+
+            try
+            {
+                while ((count < maxCount) && MoveNextItem())
+                {
+                    setItem(state, count++, engine.PrepareResult(CurrentItem, ScriptMemberFlags.None, false));
+                }
+            }
+            catch (Exception exception) when (count > 0)
+            {
+                pendingException = ExceptionDispatchInfo.Capture(exception);
+            }
+
+            return count;
+        }
+
+        protected abstract object CurrentItem { get; }
+
+        protected abstract bool MoveNextItem();
+
+        protected int GetMaxChunkCount(int maxCount)
+        {
+            return canPrefetch ? maxCount : Math.Min(maxCount, 1);
+        }
+
+        protected static void ThrowPendingException(ref ExceptionDispatchInfo pendingException)
+        {
+            var exception = pendingException;
+            if (exception is not null)
+            {
+                pendingException = null;
+                exception.Throw();
+            }
+        }
+    }
+
+    internal sealed class ScriptableEnumeratorOnEnumerator : ScriptableChunkedEnumerator, IScriptableEnumerator
     {
         private readonly IEnumerator enumerator;
 
-        public ScriptableEnumeratorOnEnumerator(IEnumerator enumerator)
+        public ScriptableEnumeratorOnEnumerator(IEnumerator enumerator, bool canPrefetch)
+            : base(canPrefetch)
         {
             this.enumerator = enumerator;
         }
@@ -184,6 +257,17 @@ namespace Microsoft.ClearScript.Util
 
         #endregion
 
+        #region ScriptableChunkedEnumerator overrides
+
+        protected override object CurrentItem => Current;
+
+        protected override bool MoveNextItem()
+        {
+            return MoveNext();
+        }
+
+        #endregion
+
         #region IEnumerator implementation
 
         public object Current => enumerator.Current;
@@ -210,11 +294,12 @@ namespace Microsoft.ClearScript.Util
         #endregion
     }
 
-    internal sealed class ScriptableEnumeratorOnEnumerator<T> : IScriptableEnumerator<T>
+    internal sealed class ScriptableEnumeratorOnEnumerator<T> : ScriptableChunkedEnumerator, IScriptableEnumerator<T>
     {
         private readonly IEnumerator<T> enumerator;
 
-        public ScriptableEnumeratorOnEnumerator(IEnumerator<T> enumerator)
+        public ScriptableEnumeratorOnEnumerator(IEnumerator<T> enumerator, bool canPrefetch)
+            : base(canPrefetch)
         {
             this.enumerator = enumerator;
         }
@@ -241,6 +326,17 @@ namespace Microsoft.ClearScript.Util
 
         #endregion
 
+        #region ScriptableChunkedEnumerator overrides
+
+        protected override object CurrentItem => Current;
+
+        protected override bool MoveNextItem()
+        {
+            return MoveNext();
+        }
+
+        #endregion
+
         #region IEnumerator<T> implementation
 
         public T Current => enumerator.Current;
@@ -273,11 +369,12 @@ namespace Microsoft.ClearScript.Util
         #endregion
     }
 
-    internal sealed class ScriptableEnumeratorOnEnumVariant : IScriptableEnumerator
+    internal sealed class ScriptableEnumeratorOnEnumVariant : ScriptableChunkedEnumerator, IScriptableEnumerator
     {
         private readonly IEnumVARIANT enumVariant;
 
         public ScriptableEnumeratorOnEnumVariant(IEnumVARIANT enumVariant)
+            : base(false)
         {
             this.enumVariant = enumVariant;
         }
@@ -298,6 +395,17 @@ namespace Microsoft.ClearScript.Util
 
         #endregion
 
+        #region ScriptableChunkedEnumerator overrides
+
+        protected override object CurrentItem => Current;
+
+        protected override bool MoveNextItem()
+        {
+            return MoveNext();
+        }
+
+        #endregion
+
         #region IEnumerator implementation
 
         public object Current { get; private set; }
@@ -330,11 +438,15 @@ namespace Microsoft.ClearScript.Util
         #endregion
     }
 
-    internal abstract class ScriptableAsyncEnumerator<T> : IScriptableAsyncEnumerator<T>
+    internal abstract class ScriptableAsyncEnumerator<T> : ScriptableChunkedEnumerator, IScriptableAsyncEnumerator<T>, IScriptableChunkedAsyncEnumerator
     {
         private readonly ScriptEngine engine;
+        private readonly Queue<T> chunk = new();
+        private T currentItem;
+        private ExceptionDispatchInfo pendingFetchException;
 
-        protected ScriptableAsyncEnumerator(ScriptEngine engine)
+        protected ScriptableAsyncEnumerator(ScriptEngine engine, bool canPrefetch)
+            : base(canPrefetch)
         {
             this.engine = engine;
         }
@@ -355,6 +467,33 @@ namespace Microsoft.ClearScript.Util
 
         #endregion
 
+        #region IScriptableChunkedAsyncEnumerator implementation
+
+        public object FetchChunkAsync(int maxCount)
+        {
+            return FillChunkAsync(maxCount).ToPromise(engine);
+        }
+
+        #endregion
+
+        #region ScriptableChunkedEnumerator overrides
+
+        protected override object CurrentItem => currentItem;
+
+        protected override bool MoveNextItem()
+        {
+            if (chunk.Count > 0)
+            {
+                currentItem = chunk.Dequeue();
+                return true;
+            }
+
+            currentItem = default;
+            return false;
+        }
+
+        #endregion
+
         #region IAsyncEnumerable<T> implementation
 
         public abstract T Current { get; }
@@ -368,14 +507,33 @@ namespace Microsoft.ClearScript.Util
         public abstract ValueTask DisposeAsync();
 
         #endregion
+
+        private async Task FillChunkAsync(int maxCount)
+        {
+            ThrowPendingException(ref pendingFetchException);
+
+            maxCount = GetMaxChunkCount(maxCount);
+
+            try
+            {
+                while ((chunk.Count < maxCount) && await MoveNextAsync())
+                {
+                    chunk.Enqueue(Current);
+                }
+            }
+            catch (Exception exception) when (chunk.Count > 0)
+            {
+                pendingFetchException = ExceptionDispatchInfo.Capture(exception);
+            }
+        }
     }
 
     internal sealed class ScriptableAsyncEnumeratorOnEnumerator : ScriptableAsyncEnumerator<object>
     {
         private readonly IEnumerator enumerator;
 
-        public ScriptableAsyncEnumeratorOnEnumerator(ScriptEngine engine, IEnumerator enumerator)
-            : base(engine)
+        public ScriptableAsyncEnumeratorOnEnumerator(ScriptEngine engine, IEnumerator enumerator, bool canPrefetch)
+            : base(engine, canPrefetch)
         {
             this.enumerator = enumerator;
         }
@@ -402,8 +560,8 @@ namespace Microsoft.ClearScript.Util
     {
         private readonly IEnumerator<T> enumerator;
 
-        public ScriptableAsyncEnumeratorOnEnumerator(ScriptEngine engine, IEnumerator<T> enumerator)
-            : base(engine)
+        public ScriptableAsyncEnumeratorOnEnumerator(ScriptEngine engine, IEnumerator<T> enumerator, bool canPrefetch)
+            : base(engine, canPrefetch)
         {
             this.enumerator = enumerator;
         }
@@ -431,7 +589,7 @@ namespace Microsoft.ClearScript.Util
         private readonly IAsyncEnumerator<T> enumerator;
 
         public ScriptableAsyncEnumeratorOnAsyncEnumerator(ScriptEngine engine, IAsyncEnumerator<T> enumerator)
-            : base(engine)
+            : base(engine, false)
         {
             this.enumerator = enumerator;
         }
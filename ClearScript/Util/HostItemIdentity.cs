@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System.Collections.Concurrent;
+using System.Threading;
+
+namespace Microsoft.ClearScript.Util
+{
+    internal sealed class HostItemIdentity
+    {
+        private static readonly ConcurrentQueue<int> freeValues = new();
+        private static int nextValue;
+
+        public int Value { get; }
+
+        private HostItemIdentity(int value)
+        {
+            Value = value;
+        }
+
+        public static HostItemIdentity Create()
+        {
+            // Values are recycled only after their previous owners have been collected. Since the
+            // native side holds a strong reference to every host item it tracks by identity, a
+            // value can never be shared by two live entries.
+
+            return new HostItemIdentity(freeValues.TryDequeue(out var value) ? value : Interlocked.Increment(ref nextValue));
+        }
+
+        ~HostItemIdentity()
+        {
+            freeValues.Enqueue(Value);
+        }
+    }
+}
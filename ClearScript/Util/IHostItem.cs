@@ -5,5 +5,6 @@ namespace Microsoft.ClearScript.Util
 {
     internal interface IHostItem : IScriptMarshalWrapper
     {
+        int Identity { get; }
     }
 }
@@ -108,7 +108,7 @@ namespace Microsoft.ClearScript.V8.FastProxy
                 return true;
             }
 
-            if (TryGetFromObject(obj, out string stringValue, out _))
+            if (arg.TryGetString(out var stringValue) || TryGetFromObject(obj, out stringValue, out _))
             {
                 value = stringValue.AsSpan();
                 return true;
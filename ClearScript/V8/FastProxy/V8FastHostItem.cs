@@ -5,6 +5,7 @@ using System;
 using System.Collections.Concurrent;
 using System.Collections.Generic;
 using System.Linq;
+using System.Threading;
 using Microsoft.ClearScript.JavaScript;
 using Microsoft.ClearScript.Util;
 using Microsoft.ClearScript.V8.SplitProxy;
@@ -15,6 +16,8 @@ namespace Microsoft.ClearScript.V8.FastProxy
     {
         private static readonly Func<IntPtr, int, string> getPropertyName = static (pName, length) => PropertyNamePool.GetOrAdd(pName, length);
 
+        private HostItemIdentity identity;
+
         public V8ScriptEngine Engine { get; }
 
         public IV8FastHostObject Target { get; }
@@ -314,6 +317,14 @@ namespace Microsoft.ClearScript.V8.FastProxy
             );
         }
 
+        public int GetEnumeratorChunk(V8Value.FastResult.Ptr pItems)
+        {
+            return Engine.HostInvoke(
+                static ctx => (ctx.self.Target is ScriptableEnumerator enumerator) ? enumerator.GetChunk(ctx.self.Engine, ctx.self.Flags, ctx.pItems) : -1,
+                (self: this, pItems)
+            );
+        }
+
         #region Object overrides
 
         public override string ToString()
@@ -336,6 +347,12 @@ namespace Microsoft.ClearScript.V8.FastProxy
 
         #endregion
 
+        #region IHostItem implementation
+
+        public int Identity => LazyInitializer.EnsureInitialized(ref identity, HostItemIdentity.Create).Value;
+
+        #endregion
+
         #region Nested type: PropertyNamePool
 
         private static class PropertyNamePool
@@ -502,6 +519,20 @@ namespace Microsoft.ClearScript.V8.FastProxy
             }
 
             public ScriptableEnumerator(IV8FastEnumerator enumerator) => this.enumerator = enumerator;
+
+            public int GetChunk(V8ScriptEngine engine, HostItemFlags flags, V8Value.FastResult.Ptr pItems)
+            {
+                // fast enumerators may be lazy or have side effects, so they're never advanced
+                // beyond the item that script is about to consume
+
+                if (enumerator.MoveNext())
+                {
+                    enumerator.GetCurrent(new V8FastResult(engine, flags, pItems));
+                    return 1;
+                }
+
+                return 0;
+            }
         }
 
         #endregion
@@ -385,7 +385,7 @@ namespace Microsoft.ClearScript.V8.FastProxy
             pResult.AsRef().SetNumber(value);
         }
 
-        private void SetFromObject(object obj)
+        internal void SetFromObject(object obj)
         {
             var result = engine.MarshalToScript(obj, flags);
             if (result is null)
@@ -18,11 +18,16 @@ namespace Microsoft.ClearScript.V8
         void SetProperty(string name, object value);
         bool DeleteProperty(string name);
         string[] GetPropertyNames(bool includeIndices);
+        object[] GetProperties(string[] names);
+        void SetProperties(string[] names, object[] values);
 
         object GetProperty(int index);
         void SetProperty(int index, object value);
         bool DeleteProperty(int index);
         int[] GetPropertyIndices();
+        object[] ExportArray();
+        byte[] Serialize(out object[] sharedObjects);
+        string ToJson();
 
         object Invoke(bool asConstructor, object[] args);
         object InvokeMethod(string name, object[] args);
@@ -20,6 +20,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
         IntPtr Memory_Allocate(UIntPtr size);
         IntPtr Memory_AllocateZeroed(UIntPtr size);
         void Memory_Free(IntPtr pMemory);
+        IntPtr Memory_AllocateTransient(UIntPtr size);
 
         #endregion
 
@@ -117,7 +118,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
         void V8Value_SetDateTime(V8Value.Ptr pV8Value, double value);
         void V8Value_SetBigInt(V8Value.Ptr pV8Value, int signBit, byte[] bytes);
         void V8Value_SetV8Object(V8Value.Ptr pV8Value, V8Object.Handle hObject, V8Value.Subtype subtype, V8Value.Flags flags);
-        void V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, V8Value.Subtype subtype, V8Value.Flags flags);
+        void V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, int identity, int typeId, V8Value.Subtype subtype, V8Value.Flags flags);
         void V8Value_Decode(V8Value.Ptr pV8Value, out V8Value.Decoded decoded);
         void V8Value_Delete(V8Value.Ptr pV8Value);
 
@@ -143,6 +144,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
         void V8Isolate_SetHeapSizeSampleInterval(V8Isolate.Handle hIsolate, double milliseconds);
         UIntPtr V8Isolate_GetMaxStackUsage(V8Isolate.Handle hIsolate);
         void V8Isolate_SetMaxStackUsage(V8Isolate.Handle hIsolate, UIntPtr size);
+        UIntPtr V8Isolate_GetMaxStringCacheSize(V8Isolate.Handle hIsolate);
+        void V8Isolate_SetMaxStringCacheSize(V8Isolate.Handle hIsolate, UIntPtr size);
         void V8Isolate_AwaitDebuggerAndPause(V8Isolate.Handle hIsolate);
         void V8Isolate_CancelAwaitDebugger(V8Isolate.Handle hIsolate);
         V8Script.Handle V8Isolate_Compile(V8Isolate.Handle hIsolate, string resourceName, string sourceMapUrl, ulong uniqueId, DocumentKind documentKind, IntPtr pDocumentInfo, string code);
@@ -154,7 +157,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
         bool V8Isolate_GetDisableHeapSizeViolationInterrupt(V8Isolate.Handle hIsolate);
         void V8Isolate_SetDisableHeapSizeViolationInterrupt(V8Isolate.Handle hIsolate, bool value);
         void V8Isolate_GetHeapStatistics(V8Isolate.Handle hIsolate, out ulong totalHeapSize, out ulong totalHeapSizeExecutable, out ulong totalPhysicalSize, out ulong totalAvailableSize, out ulong usedHeapSize, out ulong heapSizeLimit, out ulong totalExternalSize);
-        void V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts);
+        void V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts);
         void V8Isolate_CollectGarbage(V8Isolate.Handle hIsolate, bool exhaustive);
         bool V8Isolate_BeginCpuProfile(V8Isolate.Handle hIsolate, string name, bool recordSamples);
         void V8Isolate_EndCpuProfile(V8Isolate.Handle hIsolate, string name, IntPtr pAction);
@@ -173,10 +176,18 @@ namespace Microsoft.ClearScript.V8.SplitProxy
         void V8Context_SetIsolateHeapSizeSampleInterval(V8Context.Handle hContext, double milliseconds);
         UIntPtr V8Context_GetMaxIsolateStackUsage(V8Context.Handle hContext);
         void V8Context_SetMaxIsolateStackUsage(V8Context.Handle hContext, UIntPtr size);
+        UIntPtr V8Context_GetMaxIsolateStringCacheSize(V8Context.Handle hContext);
+        void V8Context_SetMaxIsolateStringCacheSize(V8Context.Handle hContext, UIntPtr size);
         void V8Context_InvokeWithLock(V8Context.Handle hContext, IntPtr pAction);
         void V8Context_InvokeWithLockWithArg(V8Context.Handle hContext, IntPtr pAction, IntPtr pArg);
         object V8Context_GetRootItem(V8Context.Handle hContext);
         void V8Context_AddGlobalItem(V8Context.Handle hContext, string name, object value, bool globalMembers);
+        object V8Context_CreateArray(V8Context.Handle hContext, object[] values);
+        object V8Context_CreateObject(V8Context.Handle hContext, string[] names, object[] values);
+        object V8Context_Deserialize(V8Context.Handle hContext, byte[] data, object[] sharedObjects);
+        object V8Context_ParseJson(V8Context.Handle hContext, string json);
+        object V8Context_ParseJsonUtf8(V8Context.Handle hContext, IntPtr pJson, int length);
+        object V8Context_CreateFastFunction(V8Context.Handle hContext, IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes);
         void V8Context_AwaitDebuggerAndPause(V8Context.Handle hContext);
         void V8Context_CancelAwaitDebugger(V8Context.Handle hContext);
         object V8Context_ExecuteCode(V8Context.Handle hContext, string resourceName, string sourceMapUrl, ulong uniqueId, DocumentKind documentKind, IntPtr pDocumentInfo, string code, bool evaluate);
@@ -185,6 +196,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
         V8Script.Handle V8Context_CompileConsumingCache(V8Context.Handle hContext, string resourceName, string sourceMapUrl, ulong uniqueId, DocumentKind documentKind, IntPtr pDocumentInfo, string code, V8CacheKind cacheKind, byte[] cacheBytes, out bool cacheAccepted);
         V8Script.Handle V8Context_CompileUpdatingCache(V8Context.Handle hContext, string resourceName, string sourceMapUrl, ulong uniqueId, DocumentKind documentKind, IntPtr pDocumentInfo, string code, V8CacheKind cacheKind, ref byte[] cacheBytes, out V8CacheResult cacheResult);
         object V8Context_ExecuteScript(V8Context.Handle hContext, V8Script.Handle hScript, bool evaluate);
+        void V8Context_ExecuteBatch(V8Context.Handle hContext, int[] commands, string[] names, object[] values, out object[] results, out string[] errors);
         void V8Context_Interrupt(V8Context.Handle hContext);
         void V8Context_CancelInterrupt(V8Context.Handle hContext);
         bool V8Context_GetEnableIsolateInterruptPropagation(V8Context.Handle hContext);
@@ -192,10 +204,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
         bool V8Context_GetDisableIsolateHeapSizeViolationInterrupt(V8Context.Handle hContext);
         void V8Context_SetDisableIsolateHeapSizeViolationInterrupt(V8Context.Handle hContext, bool value);
         void V8Context_GetIsolateHeapStatistics(V8Context.Handle hContext, out ulong totalHeapSize, out ulong totalHeapSizeExecutable, out ulong totalPhysicalSize, out ulong totalAvailableSize, out ulong usedHeapSize, out ulong heapSizeLimit, out ulong totalExternalSize);
-        void V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts);
-        void V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize);
+        void V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts);
+        void V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize, out ulong propertyNameCacheHitCount, out ulong propertyNameCacheMissCount, out ulong objectIdentityCacheHitCount, out ulong objectIdentityCacheMissCount, out ulong fastFunctionCallCount);
         void V8Context_CollectGarbage(V8Context.Handle hContext, bool exhaustive);
         void V8Context_OnAccessSettingsChanged(V8Context.Handle hContext);
+        void V8Context_OnEnumerationSettingsChanged(V8Context.Handle hContext);
+        void V8Context_InvalidateHostMemberCache(V8Context.Handle hContext, string[] names);
         bool V8Context_BeginCpuProfile(V8Context.Handle hContext, string name, bool recordSamples);
         void V8Context_EndCpuProfile(V8Context.Handle hContext, string name, IntPtr pAction);
         void V8Context_CollectCpuProfileSample(V8Context.Handle hContext);
@@ -212,10 +226,15 @@ namespace Microsoft.ClearScript.V8.SplitProxy
         void V8Object_SetNamedProperty(V8Object.Handle hObject, string name, object value);
         bool V8Object_DeleteNamedProperty(V8Object.Handle hObject, string name);
         string[] V8Object_GetPropertyNames(V8Object.Handle hObject, bool includeIndices);
+        object[] V8Object_GetNamedProperties(V8Object.Handle hObject, string[] names);
+        void V8Object_SetNamedProperties(V8Object.Handle hObject, string[] names, object[] values);
         object V8Object_GetIndexedProperty(V8Object.Handle hObject, int index);
         void V8Object_SetIndexedProperty(V8Object.Handle hObject, int index, object value);
         bool V8Object_DeleteIndexedProperty(V8Object.Handle hObject, int index);
         int[] V8Object_GetPropertyIndices(V8Object.Handle hObject);
+        object[] V8Object_ExportArray(V8Object.Handle hObject);
+        byte[] V8Object_Serialize(V8Object.Handle hObject, out object[] sharedObjects);
+        string V8Object_ToJson(V8Object.Handle hObject);
         object V8Object_Invoke(V8Object.Handle hObject, bool asConstructor, object[] args);
         object V8Object_InvokeMethod(V8Object.Handle hObject, string name, object[] args);
         void V8Object_GetArrayBufferOrViewInfo(V8Object.Handle hObject, out IV8Object arrayBuffer, out ulong offset, out ulong size, out ulong length);
@@ -252,6 +271,22 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
         #endregion
 
+        #region split proxy statistics
+
+        void V8SplitProxyStatistics_SetEnabled(bool enabled);
+        void V8SplitProxyStatistics_Reset();
+        void V8SplitProxyStatistics_GetSnapshot(out string[] names, out int[] kinds, out ulong[] bucketCounts);
+
+        #endregion
+
+        #region trace recorder
+
+        void V8TraceRecorder_SetEnabled(bool enabled);
+        void V8TraceRecorder_Clear();
+        void V8TraceRecorder_WriteJson(IntPtr pStream);
+
+        #endregion
+
         #region unit test support
 
         UIntPtr V8UnitTestSupport_GetTextDigest(string value);
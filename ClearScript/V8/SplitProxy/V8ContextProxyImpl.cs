@@ -39,6 +39,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             set => V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_SetMaxIsolateStackUsage(ctx.Handle, ctx.value), (Handle, value));
         }
 
+        public override UIntPtr MaxIsolateStringCacheSize
+        {
+            get => V8SplitProxyNative.Invoke(static (instance, handle) => instance.V8Context_GetMaxIsolateStringCacheSize(handle), Handle);
+            set => V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_SetMaxIsolateStringCacheSize(ctx.Handle, ctx.value), (Handle, value));
+        }
+
         public override void InvokeWithLock(Action action)
         {
             using (var actionScope = V8ProxyHelpers.CreateAddRefHostObjectScope(action))
@@ -76,6 +82,39 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_AddGlobalItem(ctx.Handle, ctx.name, ctx.item, ctx.globalMembers), (Handle, name, item, globalMembers));
         }
 
+        public override object CreateArray(object[] values)
+        {
+            return V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_CreateArray(ctx.Handle, ctx.values), (Handle, values));
+        }
+
+        public override object CreateObject(string[] names, object[] values)
+        {
+            return V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_CreateObject(ctx.Handle, ctx.names, ctx.values), (Handle, names, values));
+        }
+
+        public override object Deserialize(byte[] data, object[] sharedObjects)
+        {
+            return V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_Deserialize(ctx.Handle, ctx.data, ctx.sharedObjects), (Handle, data, sharedObjects));
+        }
+
+        public override object ParseJson(string json)
+        {
+            return V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_ParseJson(ctx.Handle, ctx.json), (Handle, json));
+        }
+
+        public override unsafe object ParseJson(byte[] utf8Json)
+        {
+            fixed (byte* pJson = utf8Json)
+            {
+                return V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_ParseJsonUtf8(ctx.Handle, ctx.pJson, ctx.length), (Handle, pJson: (IntPtr)pJson, length: utf8Json.Length));
+            }
+        }
+
+        public override object CreateFastFunction(IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes)
+        {
+            return V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_CreateFastFunction(ctx.Handle, ctx.pFunction, ctx.returnType, ctx.argTypes), (Handle, pFunction, returnType, argTypes));
+        }
+
         public override void AwaitDebuggerAndPause()
         {
             V8SplitProxyNative.Invoke(static (instance, handle) => instance.V8Context_AwaitDebuggerAndPause(handle), Handle);
@@ -249,6 +288,18 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             throw new ArgumentException("Invalid compiled script", nameof(script));
         }
 
+        public override void ExecuteBatch(int[] commands, string[] names, object[] values, out object[] results, out string[] errors)
+        {
+            (results, errors) = V8SplitProxyNative.Invoke(
+                static (instance, ctx) =>
+                {
+                    instance.V8Context_ExecuteBatch(ctx.Handle, ctx.commands, ctx.names, ctx.values, out var tempResults, out var tempErrors);
+                    return (tempResults, tempErrors);
+                },
+                (Handle, commands, names, values)
+            );
+        }
+
         public override void Interrupt()
         {
             V8SplitProxyNative.Invoke(static (instance, handle) => instance.V8Context_Interrupt(handle), Handle);
@@ -318,14 +369,14 @@ namespace Microsoft.ClearScript.V8.SplitProxy
         public override V8Runtime.Statistics GetIsolateStatistics()
         {
             var statistics = new V8Runtime.Statistics();
-            V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_GetIsolateStatistics(ctx.Handle, out ctx.statistics.ScriptCount, out ctx.statistics.ScriptCacheSize, out ctx.statistics.ModuleCount, out ctx.statistics.PostedTaskCounts, out ctx.statistics.InvokedTaskCounts), (Handle, statistics));
+            V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_GetIsolateStatistics(ctx.Handle, out ctx.statistics.ScriptCount, out ctx.statistics.ScriptCacheSize, out ctx.statistics.ModuleCount, out ctx.statistics.StringCacheHitCount, out ctx.statistics.StringCacheMissCount, out ctx.statistics.PostedTaskCounts, out ctx.statistics.InvokedTaskCounts), (Handle, statistics));
             return statistics;
         }
 
         public override V8ScriptEngine.Statistics GetStatistics()
         {
             var statistics = new V8ScriptEngine.Statistics();
-            V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_GetStatistics(ctx.Handle, out ctx.statistics.ScriptCount, out ctx.statistics.ModuleCount, out ctx.statistics.ModuleCacheSize), (Handle, statistics));
+            V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_GetStatistics(ctx.Handle, out ctx.statistics.ScriptCount, out ctx.statistics.ModuleCount, out ctx.statistics.ModuleCacheSize, out ctx.statistics.PropertyNameCacheHitCount, out ctx.statistics.PropertyNameCacheMissCount, out ctx.statistics.ObjectIdentityCacheHitCount, out ctx.statistics.ObjectIdentityCacheMissCount, out ctx.statistics.FastFunctionCallCount), (Handle, statistics));
             return statistics;
         }
 
@@ -339,6 +390,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             V8SplitProxyNative.Invoke(static (instance, handle) => instance.V8Context_OnAccessSettingsChanged(handle), Handle);
         }
 
+        public override void OnEnumerationSettingsChanged()
+        {
+            V8SplitProxyNative.Invoke(static (instance, handle) => instance.V8Context_OnEnumerationSettingsChanged(handle), Handle);
+        }
+
+        public override void InvalidateHostMemberCache(string[] names)
+        {
+            V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_InvalidateHostMemberCache(ctx.Handle, ctx.names), (Handle, names));
+        }
+
         public override bool BeginCpuProfile(string name, V8CpuProfileFlags flags)
         {
             return V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Context_BeginCpuProfile(ctx.Handle, ctx.name, ctx.flags.HasAllFlags(V8CpuProfileFlags.EnableSampleCollection)), (Handle, name, flags));
@@ -54,6 +54,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             set => V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Isolate_SetMaxStackUsage(ctx.Handle, ctx.value), (Handle, value));
         }
 
+        public override UIntPtr MaxStringCacheSize
+        {
+            get => V8SplitProxyNative.Invoke(static (instance, handle) => instance.V8Isolate_GetMaxStringCacheSize(handle), Handle);
+            set => V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Isolate_SetMaxStringCacheSize(ctx.Handle, ctx.value), (Handle, value));
+        }
+
         public override void AwaitDebuggerAndPause()
         {
             V8SplitProxyNative.Invoke(static (instance, handle) => instance.V8Isolate_AwaitDebuggerAndPause(handle), Handle);
@@ -258,7 +264,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
         public override V8Runtime.Statistics GetStatistics()
         {
             var statistics = new V8Runtime.Statistics();
-            V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Isolate_GetStatistics(ctx.Handle, out ctx.statistics.ScriptCount, out ctx.statistics.ScriptCacheSize, out ctx.statistics.ModuleCount, out ctx.statistics.PostedTaskCounts, out ctx.statistics.InvokedTaskCounts), (Handle, statistics));
+            V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Isolate_GetStatistics(ctx.Handle, out ctx.statistics.ScriptCount, out ctx.statistics.ScriptCacheSize, out ctx.statistics.ModuleCount, out ctx.statistics.StringCacheHitCount, out ctx.statistics.StringCacheMissCount, out ctx.statistics.PostedTaskCounts, out ctx.statistics.InvokedTaskCounts), (Handle, statistics));
             return statistics;
         }
 
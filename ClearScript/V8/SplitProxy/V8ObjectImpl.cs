@@ -145,6 +145,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             return V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Object_GetPropertyNames(ctx.Handle, ctx.includeIndices), (Handle, includeIndices));
         }
 
+        public object[] GetProperties(string[] names)
+        {
+            return V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Object_GetNamedProperties(ctx.Handle, ctx.names), (Handle, names));
+        }
+
+        public void SetProperties(string[] names, object[] values)
+        {
+            V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Object_SetNamedProperties(ctx.Handle, ctx.names, ctx.values), (Handle, names, values));
+        }
+
         public object GetProperty(int index)
         {
             return V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Object_GetIndexedProperty(ctx.Handle, ctx.index), (Handle, index));
@@ -165,6 +175,31 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             return V8SplitProxyNative.Invoke(static (instance, handle) => instance.V8Object_GetPropertyIndices(handle), Handle);
         }
 
+        public object[] ExportArray()
+        {
+            return V8SplitProxyNative.Invoke(static (instance, handle) => instance.V8Object_ExportArray(handle), Handle);
+        }
+
+        public byte[] Serialize(out object[] sharedObjects)
+        {
+            var result = V8SplitProxyNative.Invoke(
+                static (instance, handle) =>
+                {
+                    var data = instance.V8Object_Serialize(handle, out var sharedObjects);
+                    return (data, sharedObjects);
+                },
+                Handle
+            );
+
+            sharedObjects = result.sharedObjects;
+            return result.data;
+        }
+
+        public string ToJson()
+        {
+            return V8SplitProxyNative.Invoke(static (instance, handle) => instance.V8Object_ToJson(handle), Handle);
+        }
+
         public object Invoke(bool asConstructor, object[] args)
         {
             return V8SplitProxyNative.Invoke(static (instance, ctx) => instance.V8Object_Invoke(ctx.Handle, ctx.asConstructor, ctx.args), (Handle, asConstructor, args));
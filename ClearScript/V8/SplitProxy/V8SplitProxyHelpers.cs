@@ -9,6 +9,7 @@ using System.Linq;
 using System.Numerics;
 using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
+using System.Text;
 using Microsoft.ClearScript.Util;
 using Microsoft.ClearScript.V8.FastProxy;
 
@@ -47,6 +48,57 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             V8SplitProxyNative.InvokeRaw(static (instance, ctx) => instance.StdString_SetValue(ctx.pString, ctx.value), (pString, value));
         }
 
+        public static unsafe string GetValue(IntPtr pValue, int length, bool isOneByte)
+        {
+            if (length < 1)
+            {
+                return string.Empty;
+            }
+
+            if (isOneByte)
+            {
+                return oneByteEncoding.GetString((byte*)pValue.ToPointer(), length);
+            }
+
+            return Marshal.PtrToStringUni(pValue, length);
+        }
+
+        public static TValue GetValue<TValue>(IntPtr pValue, int length, Func<IntPtr, int, TValue> factory)
+        {
+            return GetValue(pValue, length, static (pValue, length, factory) => factory(pValue, length), factory);
+        }
+
+        public static unsafe TValue GetValue<TValue, TArg>(IntPtr pValue, int length, Func<IntPtr, int, TArg, TValue> factory, in TArg arg)
+        {
+            // widen one-byte (Latin-1) data for factories that consume UTF-16
+
+            const int maxStackBufferLength = 256;
+            if (length <= maxStackBufferLength)
+            {
+                var pBuffer = stackalloc char[length];
+                WidenOneByteValue(pValue, length, pBuffer);
+                return factory((IntPtr)pBuffer, length, arg);
+            }
+
+            var buffer = new char[length];
+            fixed (char* pBuffer = buffer)
+            {
+                WidenOneByteValue(pValue, length, pBuffer);
+                return factory((IntPtr)pBuffer, length, arg);
+            }
+        }
+
+        private static unsafe void WidenOneByteValue(IntPtr pValue, int length, char* pBuffer)
+        {
+            var pBytes = (byte*)pValue.ToPointer();
+            for (var index = 0; index < length; index++)
+            {
+                pBuffer[index] = (char)pBytes[index];
+            }
+        }
+
+        private static readonly Encoding oneByteEncoding = Encoding.GetEncoding(28591 /*ISO-8859-1*/);
+
         #region Nested type: Ptr
 
         public readonly struct Ptr
@@ -1069,7 +1121,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
-            V8SplitProxyNative.InvokeNoThrow(static (instance, ctx) => instance.V8Value_SetHostObject(ctx.pV8Value, V8ProxyHelpers.AddRefHostObject(ctx.obj), ctx.subtype, ctx.flags), (pV8Value, obj: hostObject, subtype, flags));
+            var typeId = V8ProxyHelpers.GetExportedHostObjectTypeId(hostObject);
+            V8SplitProxyNative.InvokeNoThrow(static (instance, ctx) => instance.V8Value_SetHostObject(ctx.pV8Value, V8ProxyHelpers.AddRefHostObject(ctx.obj), ctx.obj.Identity, ctx.typeId, ctx.subtype, ctx.flags), (pV8Value, obj: hostObject, typeId, subtype, flags));
         }
 
         #region Nested type: Type
@@ -1130,7 +1183,9 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             Async = 0x0002,
             Generator = 0x0004,
             Pending = 0x0008,
-            Rejected = 0x0010
+            Rejected = 0x0010,
+            OneByte = 0x0020,
+            Borrowed = 0x0040
         }
 
         public static bool HasAllFlags(this Flags value, Flags flags) => (value & flags) == flags;
@@ -1180,6 +1235,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [FieldOffset(8)] public double DoubleValue;
             [FieldOffset(8)] public IntPtr PtrOrHandle;
 
+            public readonly string GetString() => StdString.GetValue(PtrOrHandle, Length, Flags.HasAllFlags(Flags.OneByte));
+
             public readonly bool TryCreateBigInteger(out BigInteger value)
             {
                 value = BigInteger.Zero;
@@ -1235,7 +1292,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                         return data.DoubleValue;
 
                     case Type.String:
-                        return Marshal.PtrToStringUni(data.PtrOrHandle, data.Length);
+                        return data.GetString();
 
                     case Type.DateTime:
                         return DateTimeHelpers.FromUnixMilliseconds(data.DoubleValue);
@@ -1341,7 +1398,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             {
                 if (data.Type == Type.String)
                 {
-                    value = Marshal.PtrToStringUni(data.PtrOrHandle, data.Length);
+                    value = data.GetString();
                     return true;
                 }
 
@@ -1351,7 +1408,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             public unsafe bool TryGetCharSpan(out ReadOnlySpan<char> value)
             {
-                if (data.Type == Type.String)
+                if ((data.Type == Type.String) && !data.Flags.HasAllFlags(Flags.OneByte))
                 {
                     value = new ReadOnlySpan<char>(data.PtrOrHandle.ToPointer(), data.Length);
                     return true;
@@ -1535,6 +1592,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 data.Type = Type.HostObject;
                 data.Subtype = subtype;
                 data.Flags = flags;
+                data.IdentityHash = hostObject.Identity;
                 data.PtrOrHandle = V8ProxyHelpers.AddRefHostObject(hostObject);
             }
 
@@ -1548,7 +1606,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 var length = value.Length;
 
                 var bufferSize = checked((length + 1) * sizeof(char));
-                var pBuffer = V8SplitProxyNative.InvokeRaw(static (instance, size) => instance.Memory_AllocateZeroed(size), (UIntPtr)bufferSize);
+                var pBuffer = V8SplitProxyNative.InvokeRaw(static (instance, size) => instance.Memory_AllocateTransient(size), (UIntPtr)bufferSize);
 
                 if (length > 0)
                 {
@@ -1572,7 +1630,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 var length = value.Length;
 
                 var bufferSize = checked((length + 1) * sizeof(char));
-                var pBuffer = V8SplitProxyNative.InvokeRaw(static (instance, size) => instance.Memory_AllocateZeroed(size), (UIntPtr)bufferSize);
+                var pBuffer = V8SplitProxyNative.InvokeRaw(static (instance, size) => instance.Memory_AllocateTransient(size), (UIntPtr)bufferSize);
 
                 if (length > 0)
                 {
@@ -1600,7 +1658,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
                 wordCount = checked(arrayLength + sizeof(ulong) - 1) / sizeof(ulong);
                 var bufferSize = wordCount * sizeof(ulong);
-                var pWords = V8SplitProxyNative.InvokeRaw(static (instance, size) => instance.Memory_AllocateZeroed(size), (UIntPtr)bufferSize);
+                var pWords = V8SplitProxyNative.InvokeRaw(static (instance, size) => instance.Memory_AllocateTransient(size), (UIntPtr)bufferSize);
 
                 UnmanagedMemoryHelpers.Copy(bytes, 0, (ulong)arrayLength, pWords);
                 return pWords;
@@ -1626,6 +1684,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 public unsafe ref FastResult AsRef() => ref Unsafe.AsRef<FastResult>(bits.ToPointer());
                 public unsafe ReadOnlySpan<FastResult> ToSpan(int length) => new(bits.ToPointer(), length);
 
+                public Ptr GetElementPtr(int index) => new(bits + index * Size);
+
                 #region Object overrides
 
                 public override bool Equals(object obj) => (obj is Ptr ptr) && (this == ptr);
@@ -1640,6 +1700,58 @@ namespace Microsoft.ClearScript.V8.SplitProxy
         #endregion
     }
 
+    [StructLayout(LayoutKind.Explicit)]
+    internal struct V8FastFunctionCallValue
+    {
+        // IMPORTANT: maintain bitwise equivalence with native union FastHostObjectUtil::CallValue
+        [FieldOffset(0)] public int Int32Value;
+        [FieldOffset(0)] public double DoubleValue;
+        [FieldOffset(0)] public StringData StringValue;
+
+        public readonly string GetString() => StdString.GetValue(StringValue.pData, StringValue.Length, StringValue.IsOneByte != 0);
+
+        #region Nested type: StringData
+
+        [StructLayout(LayoutKind.Sequential)]
+        public struct StringData
+        {
+            public IntPtr pData;
+            public int Length;
+            public int IsOneByte;
+        }
+
+        #endregion
+
+        #region Nested type: Ptr
+
+        public readonly struct Ptr
+        {
+            private readonly IntPtr bits;
+
+            private Ptr(IntPtr bits) => this.bits = bits;
+
+            public static readonly Ptr Null = new(IntPtr.Zero);
+
+            public static bool operator ==(Ptr left, Ptr right) => left.bits == right.bits;
+            public static bool operator !=(Ptr left, Ptr right) => left.bits != right.bits;
+
+            public static explicit operator IntPtr(Ptr ptr) => ptr.bits;
+            public static explicit operator Ptr(IntPtr bits) => new(bits);
+
+            public unsafe ref V8FastFunctionCallValue AsRef() => ref Unsafe.AsRef<V8FastFunctionCallValue>(bits.ToPointer());
+            public unsafe ReadOnlySpan<V8FastFunctionCallValue> ToSpan(int length) => new(bits.ToPointer(), length);
+
+            #region Object overrides
+
+            public override bool Equals(object obj) => (obj is Ptr ptr) && (this == ptr);
+            public override int GetHashCode() => bits.GetHashCode();
+
+            #endregion
+        }
+
+        #endregion
+    }
+
     internal static class V8CpuProfile
     {
         public static void ProcessProfile(V8Entity.Handle hEntity, Ptr pProfile, V8.V8CpuProfile profile)
@@ -2002,6 +2114,52 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
     internal static class V8Object
     {
+        public static object[] GetPackedArray(ArrayExportKind kind, StdByteArray.Ptr pPackedValues)
+        {
+            return V8SplitProxyNative.InvokeRaw(
+                static (instance, ctx) =>
+                {
+                    var byteCount = instance.StdByteArray_GetElementCount(ctx.pPackedValues);
+                    var pData = instance.StdByteArray_GetData(ctx.pPackedValues);
+
+                    // IMPORTANT: numbers are surfaced as doubles to match the behavior of V8Value.Get
+
+                    if (ctx.kind == ArrayExportKind.Int32)
+                    {
+                        var int32Values = new int[byteCount / sizeof(int)];
+                        if (int32Values.Length > 0)
+                        {
+                            Marshal.Copy(pData, int32Values, 0, int32Values.Length);
+                        }
+
+                        return int32Values.Select(static value => (object)(double)value).ToArray();
+                    }
+
+                    var doubleValues = new double[byteCount / sizeof(double)];
+                    if (doubleValues.Length > 0)
+                    {
+                        Marshal.Copy(pData, doubleValues, 0, doubleValues.Length);
+                    }
+
+                    return doubleValues.Select(static value => (object)value).ToArray();
+                },
+                (kind, pPackedValues)
+            );
+        }
+
+        #region Nested type: ArrayExportKind
+
+        public enum ArrayExportKind
+        {
+            // IMPORTANT: maintain bitwise equivalence with native enum V8ObjectHelpers::ArrayExportKind
+            Values,
+            Int32,
+            Double,
+            Unsupported
+        }
+
+        #endregion
+
         #region Nested type: Handle
 
         public readonly struct Handle
@@ -29,77 +29,77 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             public static void Write(IntPtr ptr, StdBool value) => Marshal.WriteByte(ptr, value.bits);
         }
 
-        private static unsafe IntPtr CacheV8ObjectFastMethodPtr
+        private static unsafe IntPtr AddRefHostObjectFastMethodPtr
         {
             get
             {
                 [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvStdcall) })]
-                static void Thunk(IntPtr pCache, IntPtr pObject, IntPtr pV8Object)
+                static IntPtr Thunk(IntPtr pObject)
                 {
-                    CacheV8Object(pCache, pObject, pV8Object);
+                    return AddRefHostObject(pObject);
                 }
 
-                delegate* unmanaged[Stdcall]<IntPtr, IntPtr, IntPtr, void> pThunk = &Thunk;
+                delegate* unmanaged[Stdcall]<IntPtr, IntPtr> pThunk = &Thunk;
                 return (IntPtr)pThunk;
             }
         }
 
-        private static unsafe IntPtr GetCachedV8ObjectFastMethodPtr
+        private static unsafe IntPtr ReleaseHostObjectFastMethodPtr
         {
             get
             {
                 [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvStdcall) })]
-                static IntPtr Thunk(IntPtr pCache, IntPtr pObject)
+                static void Thunk(IntPtr pObject)
                 {
-                    return GetCachedV8Object(pCache, pObject);
+                    ReleaseHostObject(pObject);
                 }
 
-                delegate* unmanaged[Stdcall]<IntPtr, IntPtr, IntPtr> pThunk = &Thunk;
+                delegate* unmanaged[Stdcall]<IntPtr, void> pThunk = &Thunk;
                 return (IntPtr)pThunk;
             }
         }
 
-        private static unsafe IntPtr AddRefHostObjectFastMethodPtr
+        private static unsafe IntPtr ReleaseHostObjectsFastMethodPtr
         {
             get
             {
                 [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvStdcall) })]
-                static IntPtr Thunk(IntPtr pObject)
+                static void Thunk(StdPtrArray.Ptr pObjects)
                 {
-                    return AddRefHostObject(pObject);
+                    ReleaseHostObjects(pObjects);
                 }
 
-                delegate* unmanaged[Stdcall]<IntPtr, IntPtr> pThunk = &Thunk;
+                delegate* unmanaged[Stdcall]<StdPtrArray.Ptr, void> pThunk = &Thunk;
                 return (IntPtr)pThunk;
             }
         }
 
-        private static unsafe IntPtr ReleaseHostObjectFastMethodPtr
+        private static unsafe IntPtr GetHostObjectInvocabilityFastMethodPtr
         {
             get
             {
                 [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvStdcall) })]
-                static void Thunk(IntPtr pObject)
+                static Invocability Thunk(IntPtr pObject)
                 {
-                    ReleaseHostObject(pObject);
+                    return GetHostObjectInvocability(pObject);
                 }
 
-                delegate* unmanaged[Stdcall]<IntPtr, void> pThunk = &Thunk;
+                delegate* unmanaged[Stdcall]<IntPtr, Invocability> pThunk = &Thunk;
                 return (IntPtr)pThunk;
             }
         }
 
-        private static unsafe IntPtr GetHostObjectInvocabilityFastMethodPtr
+        private static unsafe IntPtr GetHostObjectTypeIdFastMethodPtr
         {
             get
             {
                 [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvStdcall) })]
-                static Invocability Thunk(IntPtr pObject)
+                static int Thunk(IntPtr pObject)
                 {
-                    return GetHostObjectInvocability(pObject);
+                    return GetHostObjectTypeId(pObject);
                 }
 
-                delegate* unmanaged[Stdcall]<IntPtr, Invocability> pThunk = &Thunk;
+                delegate* unmanaged[Stdcall]<IntPtr, int> pThunk = &Thunk;
                 return (IntPtr)pThunk;
             }
         }
@@ -301,6 +301,21 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             }
         }
 
+        private static unsafe IntPtr InvokeFastHostFunctionFastMethodPtr
+        {
+            get
+            {
+                [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvStdcall) })]
+                static void Thunk(IntPtr pFunction, int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult)
+                {
+                    InvokeFastHostFunction(pFunction, argCount, pArgs, pResult);
+                }
+
+                delegate* unmanaged[Stdcall]<IntPtr, int, V8FastFunctionCallValue.Ptr, V8FastFunctionCallValue.Ptr, void> pThunk = &Thunk;
+                return (IntPtr)pThunk;
+            }
+        }
+
         #endregion
     }
 }
@@ -23,6 +23,7 @@ namespace Microsoft.ClearScript.V8.SplitProxy
         private static int methodCount;
 
         [ThreadStatic] public static Exception ScheduledException;
+        [ThreadStatic] public static bool InFastHostFunctionCall;
 
         public static void Initialize()
         {
@@ -115,35 +116,6 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [In] IntPtr pAction
         );
 
-        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
-        private delegate IntPtr RawCreateV8ObjectCache();
-
-        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
-        private delegate void RawCacheV8Object(
-            [In] IntPtr pCache,
-            [In] IntPtr pObject,
-            [In] IntPtr pV8Object
-        );
-
-        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
-        private delegate IntPtr RawGetCachedV8Object(
-            [In] IntPtr pCache,
-            [In] IntPtr pObject
-        );
-
-        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
-        private delegate void RawGetAllCachedV8Objects(
-            [In] IntPtr pCache,
-            [In] StdPtrArray.Ptr pV8ObjectPtrs
-        );
-
-        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
-        [return: MarshalAs(UnmanagedType.I1)]
-        private delegate bool RawRemoveV8ObjectCacheEntry(
-            [In] IntPtr pCache,
-            [In] IntPtr pObject
-        );
-
         [UnmanagedFunctionPointer(CallingConvention.StdCall)]
         private delegate IntPtr RawCreateDebugAgent(
             [In] StdString.Ptr pName,
@@ -180,11 +152,28 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [In] IntPtr pObject
         );
 
+        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+        private delegate void RawReleaseHostObjects(
+            [In] StdPtrArray.Ptr pObjects
+        );
+
         [UnmanagedFunctionPointer(CallingConvention.StdCall)]
         private delegate Invocability RawGetHostObjectInvocability(
             [In] IntPtr pObject
         );
 
+        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+        private delegate int RawGetHostObjectTypeId(
+            [In] IntPtr pObject
+        );
+
+        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+        private delegate void RawGetHostObjectTypeMemberNames(
+            [In] IntPtr pObject,
+            [In] StdStringArray.Ptr pNames,
+            [In] StdStringArray.Ptr pExtensionMethodNames
+        );
+
         [UnmanagedFunctionPointer(CallingConvention.StdCall)]
         private delegate void RawGetHostObjectNamedProperty(
             [In] IntPtr pObject,
@@ -346,6 +335,14 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [In] V8Value.FastResult.Ptr pResult
         );
 
+        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+        private delegate void RawInvokeFastHostFunction(
+            [In] IntPtr pFunction,
+            [In] int argCount,
+            [In] V8FastFunctionCallValue.Ptr pArgs,
+            [In] V8FastFunctionCallValue.Ptr pResult
+        );
+
         [UnmanagedFunctionPointer(CallingConvention.StdCall)]
         private delegate void RawGetFastHostObjectEnumerator(
             [In] IntPtr pObject,
@@ -358,6 +355,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [In] V8Value.FastResult.Ptr pResult
         );
 
+        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+        private delegate int RawGetHostEnumeratorChunk(
+            [In] IntPtr pEnumerator,
+            [In] int maxCount,
+            [In] V8Value.FastResult.Ptr pItems
+        );
+
+        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+        private delegate void RawFetchHostAsyncEnumeratorChunk(
+            [In] IntPtr pEnumerator,
+            [In] int maxCount,
+            [In] V8Value.Ptr pPromise
+        );
+
         [UnmanagedFunctionPointer(CallingConvention.StdCall)]
         private delegate void RawQueueNativeCallback(
             [In] NativeCallback.Handle hCallback
@@ -445,18 +456,6 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 GetMethodPair<RawProcessArrayBufferOrViewData>(ProcessArrayBufferOrViewData),
                 GetMethodPair<RawProcessArrayBufferOrViewDataWithArg>(ProcessArrayBufferOrViewDataWithArg),
                 GetMethodPair<RawProcessCpuProfile>(ProcessCpuProfile),
-                GetMethodPair<RawCreateV8ObjectCache>(CreateV8ObjectCache),
-
-            #if NET5_0_OR_GREATER
-                (IntPtr.Zero, CacheV8ObjectFastMethodPtr),
-                (IntPtr.Zero, GetCachedV8ObjectFastMethodPtr),
-            #else
-                GetMethodPair<RawCacheV8Object>(CacheV8Object),
-                GetMethodPair<RawGetCachedV8Object>(GetCachedV8Object),
-            #endif
-
-                GetMethodPair<RawGetAllCachedV8Objects>(GetAllCachedV8Objects),
-                GetMethodPair<RawRemoveV8ObjectCacheEntry>(RemoveV8ObjectCacheEntry),
                 GetMethodPair<RawCreateDebugAgent>(CreateDebugAgent),
                 GetMethodPair<RawSendDebugMessage>(SendDebugMessage),
                 GetMethodPair<RawDestroyDebugAgent>(DestroyDebugAgent),
@@ -466,13 +465,19 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             #if NET5_0_OR_GREATER
                 (IntPtr.Zero, AddRefHostObjectFastMethodPtr),
                 (IntPtr.Zero, ReleaseHostObjectFastMethodPtr),
+                (IntPtr.Zero, ReleaseHostObjectsFastMethodPtr),
                 (IntPtr.Zero, GetHostObjectInvocabilityFastMethodPtr),
+                (IntPtr.Zero, GetHostObjectTypeIdFastMethodPtr),
             #else
                 GetMethodPair<RawAddRefHostObject>(AddRefHostObject),
                 GetMethodPair<RawReleaseHostObject>(ReleaseHostObject),
+                GetMethodPair<RawReleaseHostObjects>(ReleaseHostObjects),
                 GetMethodPair<RawGetHostObjectInvocability>(GetHostObjectInvocability),
+                GetMethodPair<RawGetHostObjectTypeId>(GetHostObjectTypeId),
             #endif
 
+                GetMethodPair<RawGetHostObjectTypeMemberNames>(GetHostObjectTypeMemberNames),
+
             #if NET5_0_OR_GREATER
                 (IntPtr.Zero, GetHostObjectNamedPropertyFastMethodPtr),
                 (IntPtr.Zero, SetHostObjectNamedPropertyFastMethodPtr),
@@ -536,9 +541,18 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 GetMethodPair<RawInvokeFastHostObject>(InvokeFastHostObject),
             #endif
 
+            #if NET5_0_OR_GREATER
+                (IntPtr.Zero, InvokeFastHostFunctionFastMethodPtr),
+            #else
+                GetMethodPair<RawInvokeFastHostFunction>(InvokeFastHostFunction),
+            #endif
+
                 GetMethodPair<RawGetFastHostObjectEnumerator>(GetFastHostObjectEnumerator),
                 GetMethodPair<RawGetFastHostObjectAsyncEnumerator>(GetFastHostObjectAsyncEnumerator),
 
+                GetMethodPair<RawGetHostEnumeratorChunk>(GetHostEnumeratorChunk),
+                GetMethodPair<RawFetchHostAsyncEnumeratorChunk>(FetchHostAsyncEnumeratorChunk),
+
                 GetMethodPair<RawQueueNativeCallback>(QueueNativeCallback),
                 GetMethodPair<RawCreateNativeCallbackTimer>(CreateNativeCallbackTimer),
                 GetMethodPair<RawChangeNativeCallbackTimer>(ChangeNativeCallbackTimer),
@@ -692,32 +706,6 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             }
         }
 
-        private static IntPtr CreateV8ObjectCache()
-        {
-            return V8ProxyHelpers.AddRefHostObject(new Dictionary<object, IntPtr>());
-        }
-
-        private static void CacheV8Object(IntPtr pCache, IntPtr pObject, IntPtr pV8Object)
-        {
-            V8ProxyHelpers.GetHostObject<Dictionary<object, IntPtr>>(pCache).Add(V8ProxyHelpers.GetHostObject(pObject), pV8Object);
-        }
-
-        private static IntPtr GetCachedV8Object(IntPtr pCache, IntPtr pObject)
-        {
-            return V8ProxyHelpers.GetHostObject<Dictionary<object, IntPtr>>(pCache).TryGetValue(V8ProxyHelpers.GetHostObject(pObject), out IntPtr pV8Object) ? pV8Object : IntPtr.Zero;
-        }
-
-        private static void GetAllCachedV8Objects(IntPtr pCache, StdPtrArray.Ptr pV8ObjectPtrs)
-        {
-            var cache = V8ProxyHelpers.GetHostObject<Dictionary<object, IntPtr>>(pCache);
-            StdPtrArray.CopyFromArray(pV8ObjectPtrs, cache.Values.ToArray());
-        }
-
-        private static bool RemoveV8ObjectCacheEntry(IntPtr pCache, IntPtr pObject)
-        {
-            return V8ProxyHelpers.GetHostObject<Dictionary<object, IntPtr>>(pCache).Remove(V8ProxyHelpers.GetHostObject(pObject));
-        }
-
         private static IntPtr CreateDebugAgent(StdString.Ptr pName, StdString.Ptr pVersion, int port, bool remote, V8DebugCallback.Handle hCallback)
         {
             return V8ProxyHelpers.AddRefHostObject(new V8DebugAgent(StdString.GetValue(pName), StdString.GetValue(pVersion), port, remote, new V8DebugListenerImpl(hCallback)));
@@ -754,6 +742,14 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             V8ProxyHelpers.ReleaseHostObject(pObject);
         }
 
+        private static void ReleaseHostObjects(StdPtrArray.Ptr pObjects)
+        {
+            foreach (var pObject in StdPtrArray.ToArray(pObjects))
+            {
+                V8ProxyHelpers.ReleaseHostObject(pObject);
+            }
+        }
+
         private static Invocability GetHostObjectInvocability(IntPtr pObject)
         {
             try
@@ -767,6 +763,37 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             }
         }
 
+        private static int GetHostObjectTypeId(IntPtr pObject)
+        {
+            try
+            {
+                return V8ProxyHelpers.GetHostObjectTypeId(pObject);
+            }
+            catch (Exception exception)
+            {
+                ScheduleHostException(pObject, exception);
+                return default;
+            }
+        }
+
+        private static void GetHostObjectTypeMemberNames(IntPtr pObject, StdStringArray.Ptr pNames, StdStringArray.Ptr pExtensionMethodNames)
+        {
+            string[] names;
+            string[] extensionMethodNames;
+            try
+            {
+                names = V8ProxyHelpers.GetHostObjectTypeMemberNames(pObject, out extensionMethodNames);
+            }
+            catch (Exception exception)
+            {
+                ScheduleHostException(pObject, exception);
+                return;
+            }
+
+            StdStringArray.CopyFromArray(pNames, names);
+            StdStringArray.CopyFromArray(pExtensionMethodNames, extensionMethodNames);
+        }
+
         private static void GetHostObjectNamedProperty(IntPtr pObject, StdString.Ptr pName, V8Value.Ptr pValue, out bool isCacheable)
         {
             try
@@ -1067,6 +1094,26 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             }
         }
 
+        private static void InvokeFastHostFunction(IntPtr pFunction, int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult)
+        {
+            try
+            {
+                var previousInFastHostFunctionCall = MiscHelpers.Exchange(ref InFastHostFunctionCall, true);
+                try
+                {
+                    V8ProxyHelpers.InvokeFastHostFunction(pFunction, argCount, pArgs, pResult);
+                }
+                finally
+                {
+                    InFastHostFunctionCall = previousInFastHostFunctionCall;
+                }
+            }
+            catch (Exception exception)
+            {
+                ScheduleHostException(pFunction, exception);
+            }
+        }
+
         private static void GetFastHostObjectEnumerator(IntPtr pObject, V8Value.FastResult.Ptr pResult)
         {
             try
@@ -1091,6 +1138,31 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             }
         }
 
+        private static int GetHostEnumeratorChunk(IntPtr pEnumerator, int maxCount, V8Value.FastResult.Ptr pItems)
+        {
+            try
+            {
+                return V8ProxyHelpers.GetHostEnumeratorChunk(pEnumerator, maxCount, pItems);
+            }
+            catch (Exception exception)
+            {
+                ScheduleHostException(pEnumerator, exception);
+                return default;
+            }
+        }
+
+        private static void FetchHostAsyncEnumeratorChunk(IntPtr pEnumerator, int maxCount, V8Value.Ptr pPromise)
+        {
+            try
+            {
+                V8Value.Set(pPromise, V8ProxyHelpers.FetchHostAsyncEnumeratorChunk(pEnumerator, maxCount));
+            }
+            catch (Exception exception)
+            {
+                ScheduleHostException(pEnumerator, exception);
+            }
+        }
+
         private static void QueueNativeCallback(NativeCallback.Handle hCallback)
         {
             MiscHelpers.QueueNativeCallback(new NativeCallbackImpl(hCallback));
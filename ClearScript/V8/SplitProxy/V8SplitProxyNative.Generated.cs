@@ -136,6 +136,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 Memory_Free(pMemory);
             }
 
+            IntPtr IV8SplitProxyNative.Memory_AllocateTransient(UIntPtr size)
+            {
+                return Memory_AllocateTransient(size);
+            }
+
             #endregion
 
             #region StdString methods
@@ -147,20 +152,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdString_GetValue(StdString.Ptr pString)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue>(StdString.Ptr pString, Func<IntPtr, int, TValue> factory)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory) : factory(pValue, length);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue, TArg>(StdString.Ptr pString, Func<IntPtr, int, TArg, TValue> factory, in TArg arg)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length, arg);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory, arg) : factory(pValue, length, arg);
             }
 
             void IV8SplitProxyNative.StdString_SetValue(StdString.Ptr pString, string value)
@@ -194,8 +199,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdStringArray_GetElement(StdStringArray.Ptr pArray, int index)
             {
-                var pValue = StdStringArray_GetElement(pArray, index, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdStringArray_GetElement(pArray, index, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             void IV8SplitProxyNative.StdStringArray_SetElement(StdStringArray.Ptr pArray, int index, string value)
@@ -436,9 +441,9 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Value_SetV8Object(pV8Value, hObject, subtype, flags);
             }
 
-            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, V8Value.Subtype subtype, V8Value.Flags flags)
+            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, int identity, int typeId, V8Value.Subtype subtype, V8Value.Flags flags)
             {
-                V8Value_SetHostObject(pV8Value, pObject, subtype, flags);
+                V8Value_SetHostObject(pV8Value, pObject, identity, typeId, subtype, flags);
             }
 
             void IV8SplitProxyNative.V8Value_Decode(V8Value.Ptr pV8Value, out V8Value.Decoded decoded)
@@ -556,6 +561,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_SetMaxStackUsage(hIsolate, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Isolate_GetMaxStringCacheSize(V8Isolate.Handle hIsolate)
+            {
+                return V8Isolate_GetMaxStringCacheSize(hIsolate);
+            }
+
+            void IV8SplitProxyNative.V8Isolate_SetMaxStringCacheSize(V8Isolate.Handle hIsolate, UIntPtr size)
+            {
+                V8Isolate_SetMaxStringCacheSize(hIsolate, size);
+            }
+
             void IV8SplitProxyNative.V8Isolate_AwaitDebuggerAndPause(V8Isolate.Handle hIsolate)
             {
                 V8Isolate_AwaitDebuggerAndPause(hIsolate);
@@ -664,13 +679,13 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_GetHeapStatistics(hIsolate, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
@@ -752,6 +767,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_SetMaxIsolateStackUsage(hContext, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Context_GetMaxIsolateStringCacheSize(V8Context.Handle hContext)
+            {
+                return V8Context_GetMaxIsolateStringCacheSize(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_SetMaxIsolateStringCacheSize(V8Context.Handle hContext, UIntPtr size)
+            {
+                V8Context_SetMaxIsolateStringCacheSize(hContext, size);
+            }
+
             void IV8SplitProxyNative.V8Context_InvokeWithLock(V8Context.Handle hContext, IntPtr pAction)
             {
                 V8Context_InvokeWithLock(hContext, pAction);
@@ -782,6 +807,81 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object IV8SplitProxyNative.V8Context_CreateArray(V8Context.Handle hContext, object[] values)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                {
+                    using (var arrayScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateArray(hContext, valuesScope.Value, arrayScope.Value);
+                        return V8Value.Get(arrayScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateObject(V8Context.Handle hContext, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        using (var objScope = V8Value.CreateScope())
+                        {
+                            V8Context_CreateObject(hContext, namesScope.Value, valuesScope.Value, objScope.Value);
+                            return V8Value.Get(objScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_Deserialize(V8Context.Handle hContext, byte[] data, object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope(data))
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope(sharedObjects))
+                    {
+                        using (var valueScope = V8Value.CreateScope())
+                        {
+                            V8Context_Deserialize(hContext, dataScope.Value, sharedObjectsScope.Value, valueScope.Value);
+                            return V8Value.Get(valueScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJson(V8Context.Handle hContext, string json)
+            {
+                using (var jsonScope = StdString.CreateScope(json))
+                {
+                    using (var valueScope = V8Value.CreateScope())
+                    {
+                        V8Context_ParseJson(hContext, jsonScope.Value, valueScope.Value);
+                        return V8Value.Get(valueScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJsonUtf8(V8Context.Handle hContext, IntPtr pJson, int length)
+            {
+                using (var valueScope = V8Value.CreateScope())
+                {
+                    V8Context_ParseJsonUtf8(hContext, pJson, length, valueScope.Value);
+                    return V8Value.Get(valueScope.Value);
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateFastFunction(V8Context.Handle hContext, IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes)
+            {
+                using (var argTypesScope = StdInt32Array.CreateScope(argTypes))
+                {
+                    using (var functionScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateFastFunction(hContext, pFunction, returnType, argTypesScope.Value, functionScope.Value);
+                        return V8Value.Get(functionScope.Value);
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_AwaitDebuggerAndPause(V8Context.Handle hContext)
             {
                 V8Context_AwaitDebuggerAndPause(hContext);
@@ -892,6 +992,28 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            void IV8SplitProxyNative.V8Context_ExecuteBatch(V8Context.Handle hContext, int[] commands, string[] names, object[] values, out object[] results, out string[] errors)
+            {
+                using (var commandsScope = StdInt32Array.CreateScope(commands))
+                {
+                    using (var namesScope = StdStringArray.CreateScope(names))
+                    {
+                        using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                        {
+                            using (var resultsScope = StdV8ValueArray.CreateScope())
+                            {
+                                using (var errorsScope = StdStringArray.CreateScope())
+                                {
+                                    V8Context_ExecuteBatch(hContext, commandsScope.Value, namesScope.Value, valuesScope.Value, resultsScope.Value, errorsScope.Value);
+                                    results = StdV8ValueArray.ToArray(resultsScope.Value);
+                                    errors = StdStringArray.ToArray(errorsScope.Value);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_Interrupt(V8Context.Handle hContext)
             {
                 V8Context_Interrupt(hContext);
@@ -927,22 +1049,22 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_GetIsolateHeapStatistics(hContext, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
                 }
             }
 
-            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize)
+            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize, out ulong propertyNameCacheHitCount, out ulong propertyNameCacheMissCount, out ulong objectIdentityCacheHitCount, out ulong objectIdentityCacheMissCount, out ulong fastFunctionCallCount)
             {
-                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize);
+                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize, out propertyNameCacheHitCount, out propertyNameCacheMissCount, out objectIdentityCacheHitCount, out objectIdentityCacheMissCount, out fastFunctionCallCount);
             }
 
             void IV8SplitProxyNative.V8Context_CollectGarbage(V8Context.Handle hContext, bool exhaustive)
@@ -955,6 +1077,19 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_OnAccessSettingsChanged(hContext);
             }
 
+            void IV8SplitProxyNative.V8Context_OnEnumerationSettingsChanged(V8Context.Handle hContext)
+            {
+                V8Context_OnEnumerationSettingsChanged(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_InvalidateHostMemberCache(V8Context.Handle hContext, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    V8Context_InvalidateHostMemberCache(hContext, namesScope.Value);
+                }
+            }
+
             bool IV8SplitProxyNative.V8Context_BeginCpuProfile(V8Context.Handle hContext, string name, bool recordSamples)
             {
                 using (var nameScope = StdString.CreateScope(name))
@@ -1053,6 +1188,29 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_GetNamedProperties(V8Object.Handle hObject, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_GetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                        return StdV8ValueArray.ToArray(valuesScope.Value);
+                    }
+                }
+            }
+
+            void IV8SplitProxyNative.V8Object_SetNamedProperties(V8Object.Handle hObject, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        V8Object_SetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                    }
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_GetIndexedProperty(V8Object.Handle hObject, int index)
             {
                 using (var valueScope = V8Value.CreateScope())
@@ -1084,6 +1242,45 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_ExportArray(V8Object.Handle hObject)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope())
+                {
+                    using (var packedValuesScope = StdByteArray.CreateScope())
+                    {
+                        var kind = V8Object_ExportArray(hObject, valuesScope.Value, packedValuesScope.Value);
+                        if (kind == V8Object.ArrayExportKind.Unsupported)
+                        {
+                            return null;
+                        }
+
+                        return (kind == V8Object.ArrayExportKind.Values) ? StdV8ValueArray.ToArray(valuesScope.Value) : V8Object.GetPackedArray(kind, packedValuesScope.Value);
+                    }
+                }
+            }
+
+            byte[] IV8SplitProxyNative.V8Object_Serialize(V8Object.Handle hObject, out object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope())
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_Serialize(hObject, dataScope.Value, sharedObjectsScope.Value);
+                        sharedObjects = StdV8ValueArray.ToArray(sharedObjectsScope.Value);
+                        return StdByteArray.ToArray(dataScope.Value);
+                    }
+                }
+            }
+
+            string IV8SplitProxyNative.V8Object_ToJson(V8Object.Handle hObject)
+            {
+                using (var jsonScope = StdString.CreateScope())
+                {
+                    V8Object_ToJson(hObject, jsonScope.Value);
+                    return StdString.GetValue(jsonScope.Value);
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_Invoke(V8Object.Handle hObject, bool asConstructor, object[] args)
             {
                 using (var argsScope = StdV8ValueArray.CreateScope(args))
@@ -1197,6 +1394,56 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_SetEnabled(bool enabled)
+            {
+                V8SplitProxyStatistics_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_Reset()
+            {
+                V8SplitProxyStatistics_Reset();
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_GetSnapshot(out string[] names, out int[] kinds, out ulong[] bucketCounts)
+            {
+                using (var namesScope = StdStringArray.CreateScope())
+                {
+                    using (var kindsScope = StdInt32Array.CreateScope())
+                    {
+                        using (var bucketCountsScope = StdUInt64Array.CreateScope())
+                        {
+                            V8SplitProxyStatistics_GetSnapshot(namesScope.Value, kindsScope.Value, bucketCountsScope.Value);
+                            names = StdStringArray.ToArray(namesScope.Value);
+                            kinds = StdInt32Array.ToArray(kindsScope.Value);
+                            bucketCounts = StdUInt64Array.ToArray(bucketCountsScope.Value);
+                        }
+                    }
+                }
+            }
+
+            #endregion
+
+            #region trace recorder
+
+            void IV8SplitProxyNative.V8TraceRecorder_SetEnabled(bool enabled)
+            {
+                V8TraceRecorder_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_Clear()
+            {
+                V8TraceRecorder_Clear();
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_WriteJson(IntPtr pStream)
+            {
+                V8TraceRecorder_WriteJson(pStream);
+            }
+
+            #endregion
+
             #region unit test support
 
             UIntPtr IV8SplitProxyNative.V8UnitTestSupport_GetTextDigest(string value)
@@ -1253,6 +1500,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] IntPtr pMemory
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern IntPtr Memory_AllocateTransient(
+                [In] UIntPtr size
+            );
+
             #endregion
 
             #region StdString methods
@@ -1266,7 +1518,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern IntPtr StdString_GetValue(
                 [In] StdString.Ptr pString,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
@@ -1305,7 +1558,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern IntPtr StdStringArray_GetElement(
                 [In] StdStringArray.Ptr pArray,
                 [In] int index,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
@@ -1568,6 +1822,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern void V8Value_SetHostObject(
                 [In] V8Value.Ptr pV8Value,
                 [In] IntPtr pObject,
+                [In] int identity,
+                [In] int typeId,
                 [In] V8Value.Subtype subtype,
                 [In] V8Value.Flags flags
             );
@@ -1693,6 +1949,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Isolate_GetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Isolate_SetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Isolate_AwaitDebuggerAndPause(
                 [In] V8Isolate.Handle hIsolate
@@ -1797,6 +2064,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -1881,6 +2150,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Context_GetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_SetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_InvokeWithLock(
                 [In] V8Context.Handle hContext,
@@ -1908,6 +2188,53 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] [MarshalAs(UnmanagedType.I1)] bool globalMembers
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateArray(
+                [In] V8Context.Handle hContext,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pArray
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateObject(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pObject
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_Deserialize(
+                [In] V8Context.Handle hContext,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJson(
+                [In] V8Context.Handle hContext,
+                [In] StdString.Ptr pJson,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJsonUtf8(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pJson,
+                [In] int length,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateFastFunction(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pFunction,
+                [In] V8FastFunctionCallType returnType,
+                [In] StdInt32Array.Ptr pArgTypes,
+                [In] V8Value.Ptr pV8Function
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_AwaitDebuggerAndPause(
                 [In] V8Context.Handle hContext
@@ -1991,6 +2318,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Value.Ptr pResult
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ExecuteBatch(
+                [In] V8Context.Handle hContext,
+                [In] StdInt32Array.Ptr pCommands,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdV8ValueArray.Ptr pResults,
+                [In] StdStringArray.Ptr pErrors
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_Interrupt(
                 [In] V8Context.Handle hContext
@@ -2043,6 +2380,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -2052,7 +2391,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext,
                 [Out] out ulong scriptCount,
                 [Out] out ulong moduleCount,
-                [Out] out ulong moduleCacheSize
+                [Out] out ulong moduleCacheSize,
+                [Out] out ulong propertyNameCacheHitCount,
+                [Out] out ulong propertyNameCacheMissCount,
+                [Out] out ulong objectIdentityCacheHitCount,
+                [Out] out ulong objectIdentityCacheMissCount,
+                [Out] out ulong fastFunctionCallCount
             );
 
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
@@ -2066,6 +2410,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_OnEnumerationSettingsChanged(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_InvalidateHostMemberCache(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             [return: MarshalAs(UnmanagedType.I1)]
             private static extern bool V8Context_BeginCpuProfile(
@@ -2143,6 +2498,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdStringArray.Ptr pNames
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_GetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_SetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_GetIndexedProperty(
                 [In] V8Object.Handle hObject,
@@ -2170,6 +2539,26 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdInt32Array.Ptr pIndices
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern V8Object.ArrayExportKind V8Object_ExportArray(
+                [In] V8Object.Handle hObject,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdByteArray.Ptr pPackedValues
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_Serialize(
+                [In] V8Object.Handle hObject,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_ToJson(
+                [In] V8Object.Handle hObject,
+                [In] StdString.Ptr pJson
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_Invoke(
                 [In] V8Object.Handle hObject,
@@ -2268,6 +2657,42 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_Reset();
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_GetSnapshot(
+                [In] StdStringArray.Ptr pNames,
+                [In] StdInt32Array.Ptr pKinds,
+                [In] StdUInt64Array.Ptr pBucketCounts
+            );
+
+            #endregion
+
+            #region trace recorder
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_Clear();
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_WriteJson(
+                [In] IntPtr pStream
+            );
+
+            #endregion
+
             #region unit test support
 
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
@@ -2333,6 +2758,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 Memory_Free(pMemory);
             }
 
+            IntPtr IV8SplitProxyNative.Memory_AllocateTransient(UIntPtr size)
+            {
+                return Memory_AllocateTransient(size);
+            }
+
             #endregion
 
             #region StdString methods
@@ -2344,20 +2774,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdString_GetValue(StdString.Ptr pString)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue>(StdString.Ptr pString, Func<IntPtr, int, TValue> factory)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory) : factory(pValue, length);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue, TArg>(StdString.Ptr pString, Func<IntPtr, int, TArg, TValue> factory, in TArg arg)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length, arg);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory, arg) : factory(pValue, length, arg);
             }
 
             void IV8SplitProxyNative.StdString_SetValue(StdString.Ptr pString, string value)
@@ -2391,8 +2821,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdStringArray_GetElement(StdStringArray.Ptr pArray, int index)
             {
-                var pValue = StdStringArray_GetElement(pArray, index, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdStringArray_GetElement(pArray, index, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             void IV8SplitProxyNative.StdStringArray_SetElement(StdStringArray.Ptr pArray, int index, string value)
@@ -2633,9 +3063,9 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Value_SetV8Object(pV8Value, hObject, subtype, flags);
             }
 
-            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, V8Value.Subtype subtype, V8Value.Flags flags)
+            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, int identity, int typeId, V8Value.Subtype subtype, V8Value.Flags flags)
             {
-                V8Value_SetHostObject(pV8Value, pObject, subtype, flags);
+                V8Value_SetHostObject(pV8Value, pObject, identity, typeId, subtype, flags);
             }
 
             void IV8SplitProxyNative.V8Value_Decode(V8Value.Ptr pV8Value, out V8Value.Decoded decoded)
@@ -2753,6 +3183,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_SetMaxStackUsage(hIsolate, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Isolate_GetMaxStringCacheSize(V8Isolate.Handle hIsolate)
+            {
+                return V8Isolate_GetMaxStringCacheSize(hIsolate);
+            }
+
+            void IV8SplitProxyNative.V8Isolate_SetMaxStringCacheSize(V8Isolate.Handle hIsolate, UIntPtr size)
+            {
+                V8Isolate_SetMaxStringCacheSize(hIsolate, size);
+            }
+
             void IV8SplitProxyNative.V8Isolate_AwaitDebuggerAndPause(V8Isolate.Handle hIsolate)
             {
                 V8Isolate_AwaitDebuggerAndPause(hIsolate);
@@ -2861,13 +3301,13 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_GetHeapStatistics(hIsolate, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
@@ -2949,6 +3389,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_SetMaxIsolateStackUsage(hContext, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Context_GetMaxIsolateStringCacheSize(V8Context.Handle hContext)
+            {
+                return V8Context_GetMaxIsolateStringCacheSize(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_SetMaxIsolateStringCacheSize(V8Context.Handle hContext, UIntPtr size)
+            {
+                V8Context_SetMaxIsolateStringCacheSize(hContext, size);
+            }
+
             void IV8SplitProxyNative.V8Context_InvokeWithLock(V8Context.Handle hContext, IntPtr pAction)
             {
                 V8Context_InvokeWithLock(hContext, pAction);
@@ -2979,6 +3429,81 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object IV8SplitProxyNative.V8Context_CreateArray(V8Context.Handle hContext, object[] values)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                {
+                    using (var arrayScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateArray(hContext, valuesScope.Value, arrayScope.Value);
+                        return V8Value.Get(arrayScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateObject(V8Context.Handle hContext, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        using (var objScope = V8Value.CreateScope())
+                        {
+                            V8Context_CreateObject(hContext, namesScope.Value, valuesScope.Value, objScope.Value);
+                            return V8Value.Get(objScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_Deserialize(V8Context.Handle hContext, byte[] data, object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope(data))
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope(sharedObjects))
+                    {
+                        using (var valueScope = V8Value.CreateScope())
+                        {
+                            V8Context_Deserialize(hContext, dataScope.Value, sharedObjectsScope.Value, valueScope.Value);
+                            return V8Value.Get(valueScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJson(V8Context.Handle hContext, string json)
+            {
+                using (var jsonScope = StdString.CreateScope(json))
+                {
+                    using (var valueScope = V8Value.CreateScope())
+                    {
+                        V8Context_ParseJson(hContext, jsonScope.Value, valueScope.Value);
+                        return V8Value.Get(valueScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJsonUtf8(V8Context.Handle hContext, IntPtr pJson, int length)
+            {
+                using (var valueScope = V8Value.CreateScope())
+                {
+                    V8Context_ParseJsonUtf8(hContext, pJson, length, valueScope.Value);
+                    return V8Value.Get(valueScope.Value);
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateFastFunction(V8Context.Handle hContext, IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes)
+            {
+                using (var argTypesScope = StdInt32Array.CreateScope(argTypes))
+                {
+                    using (var functionScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateFastFunction(hContext, pFunction, returnType, argTypesScope.Value, functionScope.Value);
+                        return V8Value.Get(functionScope.Value);
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_AwaitDebuggerAndPause(V8Context.Handle hContext)
             {
                 V8Context_AwaitDebuggerAndPause(hContext);
@@ -3089,6 +3614,28 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            void IV8SplitProxyNative.V8Context_ExecuteBatch(V8Context.Handle hContext, int[] commands, string[] names, object[] values, out object[] results, out string[] errors)
+            {
+                using (var commandsScope = StdInt32Array.CreateScope(commands))
+                {
+                    using (var namesScope = StdStringArray.CreateScope(names))
+                    {
+                        using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                        {
+                            using (var resultsScope = StdV8ValueArray.CreateScope())
+                            {
+                                using (var errorsScope = StdStringArray.CreateScope())
+                                {
+                                    V8Context_ExecuteBatch(hContext, commandsScope.Value, namesScope.Value, valuesScope.Value, resultsScope.Value, errorsScope.Value);
+                                    results = StdV8ValueArray.ToArray(resultsScope.Value);
+                                    errors = StdStringArray.ToArray(errorsScope.Value);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_Interrupt(V8Context.Handle hContext)
             {
                 V8Context_Interrupt(hContext);
@@ -3124,22 +3671,22 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_GetIsolateHeapStatistics(hContext, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
                 }
             }
 
-            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize)
+            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize, out ulong propertyNameCacheHitCount, out ulong propertyNameCacheMissCount, out ulong objectIdentityCacheHitCount, out ulong objectIdentityCacheMissCount, out ulong fastFunctionCallCount)
             {
-                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize);
+                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize, out propertyNameCacheHitCount, out propertyNameCacheMissCount, out objectIdentityCacheHitCount, out objectIdentityCacheMissCount, out fastFunctionCallCount);
             }
 
             void IV8SplitProxyNative.V8Context_CollectGarbage(V8Context.Handle hContext, bool exhaustive)
@@ -3152,6 +3699,19 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_OnAccessSettingsChanged(hContext);
             }
 
+            void IV8SplitProxyNative.V8Context_OnEnumerationSettingsChanged(V8Context.Handle hContext)
+            {
+                V8Context_OnEnumerationSettingsChanged(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_InvalidateHostMemberCache(V8Context.Handle hContext, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    V8Context_InvalidateHostMemberCache(hContext, namesScope.Value);
+                }
+            }
+
             bool IV8SplitProxyNative.V8Context_BeginCpuProfile(V8Context.Handle hContext, string name, bool recordSamples)
             {
                 using (var nameScope = StdString.CreateScope(name))
@@ -3250,6 +3810,29 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_GetNamedProperties(V8Object.Handle hObject, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_GetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                        return StdV8ValueArray.ToArray(valuesScope.Value);
+                    }
+                }
+            }
+
+            void IV8SplitProxyNative.V8Object_SetNamedProperties(V8Object.Handle hObject, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        V8Object_SetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                    }
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_GetIndexedProperty(V8Object.Handle hObject, int index)
             {
                 using (var valueScope = V8Value.CreateScope())
@@ -3281,6 +3864,45 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_ExportArray(V8Object.Handle hObject)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope())
+                {
+                    using (var packedValuesScope = StdByteArray.CreateScope())
+                    {
+                        var kind = V8Object_ExportArray(hObject, valuesScope.Value, packedValuesScope.Value);
+                        if (kind == V8Object.ArrayExportKind.Unsupported)
+                        {
+                            return null;
+                        }
+
+                        return (kind == V8Object.ArrayExportKind.Values) ? StdV8ValueArray.ToArray(valuesScope.Value) : V8Object.GetPackedArray(kind, packedValuesScope.Value);
+                    }
+                }
+            }
+
+            byte[] IV8SplitProxyNative.V8Object_Serialize(V8Object.Handle hObject, out object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope())
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_Serialize(hObject, dataScope.Value, sharedObjectsScope.Value);
+                        sharedObjects = StdV8ValueArray.ToArray(sharedObjectsScope.Value);
+                        return StdByteArray.ToArray(dataScope.Value);
+                    }
+                }
+            }
+
+            string IV8SplitProxyNative.V8Object_ToJson(V8Object.Handle hObject)
+            {
+                using (var jsonScope = StdString.CreateScope())
+                {
+                    V8Object_ToJson(hObject, jsonScope.Value);
+                    return StdString.GetValue(jsonScope.Value);
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_Invoke(V8Object.Handle hObject, bool asConstructor, object[] args)
             {
                 using (var argsScope = StdV8ValueArray.CreateScope(args))
@@ -3394,6 +4016,56 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_SetEnabled(bool enabled)
+            {
+                V8SplitProxyStatistics_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_Reset()
+            {
+                V8SplitProxyStatistics_Reset();
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_GetSnapshot(out string[] names, out int[] kinds, out ulong[] bucketCounts)
+            {
+                using (var namesScope = StdStringArray.CreateScope())
+                {
+                    using (var kindsScope = StdInt32Array.CreateScope())
+                    {
+                        using (var bucketCountsScope = StdUInt64Array.CreateScope())
+                        {
+                            V8SplitProxyStatistics_GetSnapshot(namesScope.Value, kindsScope.Value, bucketCountsScope.Value);
+                            names = StdStringArray.ToArray(namesScope.Value);
+                            kinds = StdInt32Array.ToArray(kindsScope.Value);
+                            bucketCounts = StdUInt64Array.ToArray(bucketCountsScope.Value);
+                        }
+                    }
+                }
+            }
+
+            #endregion
+
+            #region trace recorder
+
+            void IV8SplitProxyNative.V8TraceRecorder_SetEnabled(bool enabled)
+            {
+                V8TraceRecorder_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_Clear()
+            {
+                V8TraceRecorder_Clear();
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_WriteJson(IntPtr pStream)
+            {
+                V8TraceRecorder_WriteJson(pStream);
+            }
+
+            #endregion
+
             #region unit test support
 
             UIntPtr IV8SplitProxyNative.V8UnitTestSupport_GetTextDigest(string value)
@@ -3450,6 +4122,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] IntPtr pMemory
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern IntPtr Memory_AllocateTransient(
+                [In] UIntPtr size
+            );
+
             #endregion
 
             #region StdString methods
@@ -3463,7 +4140,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern IntPtr StdString_GetValue(
                 [In] StdString.Ptr pString,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -3502,7 +4180,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern IntPtr StdStringArray_GetElement(
                 [In] StdStringArray.Ptr pArray,
                 [In] int index,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -3765,6 +4444,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern void V8Value_SetHostObject(
                 [In] V8Value.Ptr pV8Value,
                 [In] IntPtr pObject,
+                [In] int identity,
+                [In] int typeId,
                 [In] V8Value.Subtype subtype,
                 [In] V8Value.Flags flags
             );
@@ -3890,6 +4571,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Isolate_GetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Isolate_SetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Isolate_AwaitDebuggerAndPause(
                 [In] V8Isolate.Handle hIsolate
@@ -3994,6 +4686,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -4078,6 +4772,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Context_GetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_SetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_InvokeWithLock(
                 [In] V8Context.Handle hContext,
@@ -4105,6 +4810,53 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] [MarshalAs(UnmanagedType.I1)] bool globalMembers
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateArray(
+                [In] V8Context.Handle hContext,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pArray
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateObject(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pObject
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_Deserialize(
+                [In] V8Context.Handle hContext,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJson(
+                [In] V8Context.Handle hContext,
+                [In] StdString.Ptr pJson,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJsonUtf8(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pJson,
+                [In] int length,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateFastFunction(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pFunction,
+                [In] V8FastFunctionCallType returnType,
+                [In] StdInt32Array.Ptr pArgTypes,
+                [In] V8Value.Ptr pV8Function
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_AwaitDebuggerAndPause(
                 [In] V8Context.Handle hContext
@@ -4188,6 +4940,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Value.Ptr pResult
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ExecuteBatch(
+                [In] V8Context.Handle hContext,
+                [In] StdInt32Array.Ptr pCommands,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdV8ValueArray.Ptr pResults,
+                [In] StdStringArray.Ptr pErrors
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_Interrupt(
                 [In] V8Context.Handle hContext
@@ -4240,6 +5002,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -4249,7 +5013,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext,
                 [Out] out ulong scriptCount,
                 [Out] out ulong moduleCount,
-                [Out] out ulong moduleCacheSize
+                [Out] out ulong moduleCacheSize,
+                [Out] out ulong propertyNameCacheHitCount,
+                [Out] out ulong propertyNameCacheMissCount,
+                [Out] out ulong objectIdentityCacheHitCount,
+                [Out] out ulong objectIdentityCacheMissCount,
+                [Out] out ulong fastFunctionCallCount
             );
 
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -4263,6 +5032,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_OnEnumerationSettingsChanged(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_InvalidateHostMemberCache(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             [return: MarshalAs(UnmanagedType.I1)]
             private static extern bool V8Context_BeginCpuProfile(
@@ -4340,6 +5120,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdStringArray.Ptr pNames
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_GetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_SetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_GetIndexedProperty(
                 [In] V8Object.Handle hObject,
@@ -4367,6 +5161,26 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdInt32Array.Ptr pIndices
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern V8Object.ArrayExportKind V8Object_ExportArray(
+                [In] V8Object.Handle hObject,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdByteArray.Ptr pPackedValues
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_Serialize(
+                [In] V8Object.Handle hObject,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_ToJson(
+                [In] V8Object.Handle hObject,
+                [In] StdString.Ptr pJson
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_Invoke(
                 [In] V8Object.Handle hObject,
@@ -4465,6 +5279,42 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_Reset();
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_GetSnapshot(
+                [In] StdStringArray.Ptr pNames,
+                [In] StdInt32Array.Ptr pKinds,
+                [In] StdUInt64Array.Ptr pBucketCounts
+            );
+
+            #endregion
+
+            #region trace recorder
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_Clear();
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_WriteJson(
+                [In] IntPtr pStream
+            );
+
+            #endregion
+
             #region unit test support
 
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -4530,6 +5380,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 Memory_Free(pMemory);
             }
 
+            IntPtr IV8SplitProxyNative.Memory_AllocateTransient(UIntPtr size)
+            {
+                return Memory_AllocateTransient(size);
+            }
+
             #endregion
 
             #region StdString methods
@@ -4541,20 +5396,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdString_GetValue(StdString.Ptr pString)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue>(StdString.Ptr pString, Func<IntPtr, int, TValue> factory)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory) : factory(pValue, length);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue, TArg>(StdString.Ptr pString, Func<IntPtr, int, TArg, TValue> factory, in TArg arg)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length, arg);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory, arg) : factory(pValue, length, arg);
             }
 
             void IV8SplitProxyNative.StdString_SetValue(StdString.Ptr pString, string value)
@@ -4588,8 +5443,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdStringArray_GetElement(StdStringArray.Ptr pArray, int index)
             {
-                var pValue = StdStringArray_GetElement(pArray, index, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdStringArray_GetElement(pArray, index, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             void IV8SplitProxyNative.StdStringArray_SetElement(StdStringArray.Ptr pArray, int index, string value)
@@ -4830,9 +5685,9 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Value_SetV8Object(pV8Value, hObject, subtype, flags);
             }
 
-            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, V8Value.Subtype subtype, V8Value.Flags flags)
+            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, int identity, int typeId, V8Value.Subtype subtype, V8Value.Flags flags)
             {
-                V8Value_SetHostObject(pV8Value, pObject, subtype, flags);
+                V8Value_SetHostObject(pV8Value, pObject, identity, typeId, subtype, flags);
             }
 
             void IV8SplitProxyNative.V8Value_Decode(V8Value.Ptr pV8Value, out V8Value.Decoded decoded)
@@ -4950,6 +5805,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_SetMaxStackUsage(hIsolate, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Isolate_GetMaxStringCacheSize(V8Isolate.Handle hIsolate)
+            {
+                return V8Isolate_GetMaxStringCacheSize(hIsolate);
+            }
+
+            void IV8SplitProxyNative.V8Isolate_SetMaxStringCacheSize(V8Isolate.Handle hIsolate, UIntPtr size)
+            {
+                V8Isolate_SetMaxStringCacheSize(hIsolate, size);
+            }
+
             void IV8SplitProxyNative.V8Isolate_AwaitDebuggerAndPause(V8Isolate.Handle hIsolate)
             {
                 V8Isolate_AwaitDebuggerAndPause(hIsolate);
@@ -5058,13 +5923,13 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_GetHeapStatistics(hIsolate, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
@@ -5146,6 +6011,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_SetMaxIsolateStackUsage(hContext, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Context_GetMaxIsolateStringCacheSize(V8Context.Handle hContext)
+            {
+                return V8Context_GetMaxIsolateStringCacheSize(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_SetMaxIsolateStringCacheSize(V8Context.Handle hContext, UIntPtr size)
+            {
+                V8Context_SetMaxIsolateStringCacheSize(hContext, size);
+            }
+
             void IV8SplitProxyNative.V8Context_InvokeWithLock(V8Context.Handle hContext, IntPtr pAction)
             {
                 V8Context_InvokeWithLock(hContext, pAction);
@@ -5176,6 +6051,81 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object IV8SplitProxyNative.V8Context_CreateArray(V8Context.Handle hContext, object[] values)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                {
+                    using (var arrayScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateArray(hContext, valuesScope.Value, arrayScope.Value);
+                        return V8Value.Get(arrayScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateObject(V8Context.Handle hContext, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        using (var objScope = V8Value.CreateScope())
+                        {
+                            V8Context_CreateObject(hContext, namesScope.Value, valuesScope.Value, objScope.Value);
+                            return V8Value.Get(objScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_Deserialize(V8Context.Handle hContext, byte[] data, object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope(data))
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope(sharedObjects))
+                    {
+                        using (var valueScope = V8Value.CreateScope())
+                        {
+                            V8Context_Deserialize(hContext, dataScope.Value, sharedObjectsScope.Value, valueScope.Value);
+                            return V8Value.Get(valueScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJson(V8Context.Handle hContext, string json)
+            {
+                using (var jsonScope = StdString.CreateScope(json))
+                {
+                    using (var valueScope = V8Value.CreateScope())
+                    {
+                        V8Context_ParseJson(hContext, jsonScope.Value, valueScope.Value);
+                        return V8Value.Get(valueScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJsonUtf8(V8Context.Handle hContext, IntPtr pJson, int length)
+            {
+                using (var valueScope = V8Value.CreateScope())
+                {
+                    V8Context_ParseJsonUtf8(hContext, pJson, length, valueScope.Value);
+                    return V8Value.Get(valueScope.Value);
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateFastFunction(V8Context.Handle hContext, IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes)
+            {
+                using (var argTypesScope = StdInt32Array.CreateScope(argTypes))
+                {
+                    using (var functionScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateFastFunction(hContext, pFunction, returnType, argTypesScope.Value, functionScope.Value);
+                        return V8Value.Get(functionScope.Value);
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_AwaitDebuggerAndPause(V8Context.Handle hContext)
             {
                 V8Context_AwaitDebuggerAndPause(hContext);
@@ -5286,6 +6236,28 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            void IV8SplitProxyNative.V8Context_ExecuteBatch(V8Context.Handle hContext, int[] commands, string[] names, object[] values, out object[] results, out string[] errors)
+            {
+                using (var commandsScope = StdInt32Array.CreateScope(commands))
+                {
+                    using (var namesScope = StdStringArray.CreateScope(names))
+                    {
+                        using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                        {
+                            using (var resultsScope = StdV8ValueArray.CreateScope())
+                            {
+                                using (var errorsScope = StdStringArray.CreateScope())
+                                {
+                                    V8Context_ExecuteBatch(hContext, commandsScope.Value, namesScope.Value, valuesScope.Value, resultsScope.Value, errorsScope.Value);
+                                    results = StdV8ValueArray.ToArray(resultsScope.Value);
+                                    errors = StdStringArray.ToArray(errorsScope.Value);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_Interrupt(V8Context.Handle hContext)
             {
                 V8Context_Interrupt(hContext);
@@ -5321,22 +6293,22 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_GetIsolateHeapStatistics(hContext, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
                 }
             }
 
-            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize)
+            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize, out ulong propertyNameCacheHitCount, out ulong propertyNameCacheMissCount, out ulong objectIdentityCacheHitCount, out ulong objectIdentityCacheMissCount, out ulong fastFunctionCallCount)
             {
-                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize);
+                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize, out propertyNameCacheHitCount, out propertyNameCacheMissCount, out objectIdentityCacheHitCount, out objectIdentityCacheMissCount, out fastFunctionCallCount);
             }
 
             void IV8SplitProxyNative.V8Context_CollectGarbage(V8Context.Handle hContext, bool exhaustive)
@@ -5349,6 +6321,19 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_OnAccessSettingsChanged(hContext);
             }
 
+            void IV8SplitProxyNative.V8Context_OnEnumerationSettingsChanged(V8Context.Handle hContext)
+            {
+                V8Context_OnEnumerationSettingsChanged(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_InvalidateHostMemberCache(V8Context.Handle hContext, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    V8Context_InvalidateHostMemberCache(hContext, namesScope.Value);
+                }
+            }
+
             bool IV8SplitProxyNative.V8Context_BeginCpuProfile(V8Context.Handle hContext, string name, bool recordSamples)
             {
                 using (var nameScope = StdString.CreateScope(name))
@@ -5447,6 +6432,29 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_GetNamedProperties(V8Object.Handle hObject, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_GetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                        return StdV8ValueArray.ToArray(valuesScope.Value);
+                    }
+                }
+            }
+
+            void IV8SplitProxyNative.V8Object_SetNamedProperties(V8Object.Handle hObject, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        V8Object_SetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                    }
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_GetIndexedProperty(V8Object.Handle hObject, int index)
             {
                 using (var valueScope = V8Value.CreateScope())
@@ -5478,6 +6486,45 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_ExportArray(V8Object.Handle hObject)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope())
+                {
+                    using (var packedValuesScope = StdByteArray.CreateScope())
+                    {
+                        var kind = V8Object_ExportArray(hObject, valuesScope.Value, packedValuesScope.Value);
+                        if (kind == V8Object.ArrayExportKind.Unsupported)
+                        {
+                            return null;
+                        }
+
+                        return (kind == V8Object.ArrayExportKind.Values) ? StdV8ValueArray.ToArray(valuesScope.Value) : V8Object.GetPackedArray(kind, packedValuesScope.Value);
+                    }
+                }
+            }
+
+            byte[] IV8SplitProxyNative.V8Object_Serialize(V8Object.Handle hObject, out object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope())
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_Serialize(hObject, dataScope.Value, sharedObjectsScope.Value);
+                        sharedObjects = StdV8ValueArray.ToArray(sharedObjectsScope.Value);
+                        return StdByteArray.ToArray(dataScope.Value);
+                    }
+                }
+            }
+
+            string IV8SplitProxyNative.V8Object_ToJson(V8Object.Handle hObject)
+            {
+                using (var jsonScope = StdString.CreateScope())
+                {
+                    V8Object_ToJson(hObject, jsonScope.Value);
+                    return StdString.GetValue(jsonScope.Value);
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_Invoke(V8Object.Handle hObject, bool asConstructor, object[] args)
             {
                 using (var argsScope = StdV8ValueArray.CreateScope(args))
@@ -5591,6 +6638,56 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_SetEnabled(bool enabled)
+            {
+                V8SplitProxyStatistics_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_Reset()
+            {
+                V8SplitProxyStatistics_Reset();
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_GetSnapshot(out string[] names, out int[] kinds, out ulong[] bucketCounts)
+            {
+                using (var namesScope = StdStringArray.CreateScope())
+                {
+                    using (var kindsScope = StdInt32Array.CreateScope())
+                    {
+                        using (var bucketCountsScope = StdUInt64Array.CreateScope())
+                        {
+                            V8SplitProxyStatistics_GetSnapshot(namesScope.Value, kindsScope.Value, bucketCountsScope.Value);
+                            names = StdStringArray.ToArray(namesScope.Value);
+                            kinds = StdInt32Array.ToArray(kindsScope.Value);
+                            bucketCounts = StdUInt64Array.ToArray(bucketCountsScope.Value);
+                        }
+                    }
+                }
+            }
+
+            #endregion
+
+            #region trace recorder
+
+            void IV8SplitProxyNative.V8TraceRecorder_SetEnabled(bool enabled)
+            {
+                V8TraceRecorder_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_Clear()
+            {
+                V8TraceRecorder_Clear();
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_WriteJson(IntPtr pStream)
+            {
+                V8TraceRecorder_WriteJson(pStream);
+            }
+
+            #endregion
+
             #region unit test support
 
             UIntPtr IV8SplitProxyNative.V8UnitTestSupport_GetTextDigest(string value)
@@ -5647,6 +6744,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] IntPtr pMemory
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern IntPtr Memory_AllocateTransient(
+                [In] UIntPtr size
+            );
+
             #endregion
 
             #region StdString methods
@@ -5660,7 +6762,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern IntPtr StdString_GetValue(
                 [In] StdString.Ptr pString,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -5699,7 +6802,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern IntPtr StdStringArray_GetElement(
                 [In] StdStringArray.Ptr pArray,
                 [In] int index,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -5962,6 +7066,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern void V8Value_SetHostObject(
                 [In] V8Value.Ptr pV8Value,
                 [In] IntPtr pObject,
+                [In] int identity,
+                [In] int typeId,
                 [In] V8Value.Subtype subtype,
                 [In] V8Value.Flags flags
             );
@@ -6087,6 +7193,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Isolate_GetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Isolate_SetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Isolate_AwaitDebuggerAndPause(
                 [In] V8Isolate.Handle hIsolate
@@ -6191,6 +7308,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -6275,6 +7394,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Context_GetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_SetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_InvokeWithLock(
                 [In] V8Context.Handle hContext,
@@ -6302,6 +7432,53 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] [MarshalAs(UnmanagedType.I1)] bool globalMembers
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateArray(
+                [In] V8Context.Handle hContext,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pArray
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateObject(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pObject
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_Deserialize(
+                [In] V8Context.Handle hContext,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJson(
+                [In] V8Context.Handle hContext,
+                [In] StdString.Ptr pJson,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJsonUtf8(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pJson,
+                [In] int length,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateFastFunction(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pFunction,
+                [In] V8FastFunctionCallType returnType,
+                [In] StdInt32Array.Ptr pArgTypes,
+                [In] V8Value.Ptr pV8Function
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_AwaitDebuggerAndPause(
                 [In] V8Context.Handle hContext
@@ -6385,6 +7562,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Value.Ptr pResult
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ExecuteBatch(
+                [In] V8Context.Handle hContext,
+                [In] StdInt32Array.Ptr pCommands,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdV8ValueArray.Ptr pResults,
+                [In] StdStringArray.Ptr pErrors
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_Interrupt(
                 [In] V8Context.Handle hContext
@@ -6437,6 +7624,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -6446,7 +7635,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext,
                 [Out] out ulong scriptCount,
                 [Out] out ulong moduleCount,
-                [Out] out ulong moduleCacheSize
+                [Out] out ulong moduleCacheSize,
+                [Out] out ulong propertyNameCacheHitCount,
+                [Out] out ulong propertyNameCacheMissCount,
+                [Out] out ulong objectIdentityCacheHitCount,
+                [Out] out ulong objectIdentityCacheMissCount,
+                [Out] out ulong fastFunctionCallCount
             );
 
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -6460,6 +7654,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_OnEnumerationSettingsChanged(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_InvalidateHostMemberCache(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             [return: MarshalAs(UnmanagedType.I1)]
             private static extern bool V8Context_BeginCpuProfile(
@@ -6537,6 +7742,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdStringArray.Ptr pNames
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_GetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_SetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_GetIndexedProperty(
                 [In] V8Object.Handle hObject,
@@ -6564,6 +7783,26 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdInt32Array.Ptr pIndices
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern V8Object.ArrayExportKind V8Object_ExportArray(
+                [In] V8Object.Handle hObject,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdByteArray.Ptr pPackedValues
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_Serialize(
+                [In] V8Object.Handle hObject,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_ToJson(
+                [In] V8Object.Handle hObject,
+                [In] StdString.Ptr pJson
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_Invoke(
                 [In] V8Object.Handle hObject,
@@ -6662,6 +7901,42 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_Reset();
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_GetSnapshot(
+                [In] StdStringArray.Ptr pNames,
+                [In] StdInt32Array.Ptr pKinds,
+                [In] StdUInt64Array.Ptr pBucketCounts
+            );
+
+            #endregion
+
+            #region trace recorder
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_Clear();
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_WriteJson(
+                [In] IntPtr pStream
+            );
+
+            #endregion
+
             #region unit test support
 
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -6727,6 +8002,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 Memory_Free(pMemory);
             }
 
+            IntPtr IV8SplitProxyNative.Memory_AllocateTransient(UIntPtr size)
+            {
+                return Memory_AllocateTransient(size);
+            }
+
             #endregion
 
             #region StdString methods
@@ -6738,20 +8018,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdString_GetValue(StdString.Ptr pString)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue>(StdString.Ptr pString, Func<IntPtr, int, TValue> factory)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory) : factory(pValue, length);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue, TArg>(StdString.Ptr pString, Func<IntPtr, int, TArg, TValue> factory, in TArg arg)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length, arg);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory, arg) : factory(pValue, length, arg);
             }
 
             void IV8SplitProxyNative.StdString_SetValue(StdString.Ptr pString, string value)
@@ -6785,8 +8065,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdStringArray_GetElement(StdStringArray.Ptr pArray, int index)
             {
-                var pValue = StdStringArray_GetElement(pArray, index, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdStringArray_GetElement(pArray, index, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             void IV8SplitProxyNative.StdStringArray_SetElement(StdStringArray.Ptr pArray, int index, string value)
@@ -7027,9 +8307,9 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Value_SetV8Object(pV8Value, hObject, subtype, flags);
             }
 
-            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, V8Value.Subtype subtype, V8Value.Flags flags)
+            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, int identity, int typeId, V8Value.Subtype subtype, V8Value.Flags flags)
             {
-                V8Value_SetHostObject(pV8Value, pObject, subtype, flags);
+                V8Value_SetHostObject(pV8Value, pObject, identity, typeId, subtype, flags);
             }
 
             void IV8SplitProxyNative.V8Value_Decode(V8Value.Ptr pV8Value, out V8Value.Decoded decoded)
@@ -7147,6 +8427,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_SetMaxStackUsage(hIsolate, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Isolate_GetMaxStringCacheSize(V8Isolate.Handle hIsolate)
+            {
+                return V8Isolate_GetMaxStringCacheSize(hIsolate);
+            }
+
+            void IV8SplitProxyNative.V8Isolate_SetMaxStringCacheSize(V8Isolate.Handle hIsolate, UIntPtr size)
+            {
+                V8Isolate_SetMaxStringCacheSize(hIsolate, size);
+            }
+
             void IV8SplitProxyNative.V8Isolate_AwaitDebuggerAndPause(V8Isolate.Handle hIsolate)
             {
                 V8Isolate_AwaitDebuggerAndPause(hIsolate);
@@ -7255,13 +8545,13 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_GetHeapStatistics(hIsolate, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
@@ -7343,6 +8633,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_SetMaxIsolateStackUsage(hContext, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Context_GetMaxIsolateStringCacheSize(V8Context.Handle hContext)
+            {
+                return V8Context_GetMaxIsolateStringCacheSize(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_SetMaxIsolateStringCacheSize(V8Context.Handle hContext, UIntPtr size)
+            {
+                V8Context_SetMaxIsolateStringCacheSize(hContext, size);
+            }
+
             void IV8SplitProxyNative.V8Context_InvokeWithLock(V8Context.Handle hContext, IntPtr pAction)
             {
                 V8Context_InvokeWithLock(hContext, pAction);
@@ -7373,6 +8673,81 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object IV8SplitProxyNative.V8Context_CreateArray(V8Context.Handle hContext, object[] values)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                {
+                    using (var arrayScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateArray(hContext, valuesScope.Value, arrayScope.Value);
+                        return V8Value.Get(arrayScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateObject(V8Context.Handle hContext, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        using (var objScope = V8Value.CreateScope())
+                        {
+                            V8Context_CreateObject(hContext, namesScope.Value, valuesScope.Value, objScope.Value);
+                            return V8Value.Get(objScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_Deserialize(V8Context.Handle hContext, byte[] data, object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope(data))
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope(sharedObjects))
+                    {
+                        using (var valueScope = V8Value.CreateScope())
+                        {
+                            V8Context_Deserialize(hContext, dataScope.Value, sharedObjectsScope.Value, valueScope.Value);
+                            return V8Value.Get(valueScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJson(V8Context.Handle hContext, string json)
+            {
+                using (var jsonScope = StdString.CreateScope(json))
+                {
+                    using (var valueScope = V8Value.CreateScope())
+                    {
+                        V8Context_ParseJson(hContext, jsonScope.Value, valueScope.Value);
+                        return V8Value.Get(valueScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJsonUtf8(V8Context.Handle hContext, IntPtr pJson, int length)
+            {
+                using (var valueScope = V8Value.CreateScope())
+                {
+                    V8Context_ParseJsonUtf8(hContext, pJson, length, valueScope.Value);
+                    return V8Value.Get(valueScope.Value);
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateFastFunction(V8Context.Handle hContext, IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes)
+            {
+                using (var argTypesScope = StdInt32Array.CreateScope(argTypes))
+                {
+                    using (var functionScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateFastFunction(hContext, pFunction, returnType, argTypesScope.Value, functionScope.Value);
+                        return V8Value.Get(functionScope.Value);
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_AwaitDebuggerAndPause(V8Context.Handle hContext)
             {
                 V8Context_AwaitDebuggerAndPause(hContext);
@@ -7483,6 +8858,28 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            void IV8SplitProxyNative.V8Context_ExecuteBatch(V8Context.Handle hContext, int[] commands, string[] names, object[] values, out object[] results, out string[] errors)
+            {
+                using (var commandsScope = StdInt32Array.CreateScope(commands))
+                {
+                    using (var namesScope = StdStringArray.CreateScope(names))
+                    {
+                        using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                        {
+                            using (var resultsScope = StdV8ValueArray.CreateScope())
+                            {
+                                using (var errorsScope = StdStringArray.CreateScope())
+                                {
+                                    V8Context_ExecuteBatch(hContext, commandsScope.Value, namesScope.Value, valuesScope.Value, resultsScope.Value, errorsScope.Value);
+                                    results = StdV8ValueArray.ToArray(resultsScope.Value);
+                                    errors = StdStringArray.ToArray(errorsScope.Value);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_Interrupt(V8Context.Handle hContext)
             {
                 V8Context_Interrupt(hContext);
@@ -7518,22 +8915,22 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_GetIsolateHeapStatistics(hContext, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
                 }
             }
 
-            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize)
+            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize, out ulong propertyNameCacheHitCount, out ulong propertyNameCacheMissCount, out ulong objectIdentityCacheHitCount, out ulong objectIdentityCacheMissCount, out ulong fastFunctionCallCount)
             {
-                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize);
+                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize, out propertyNameCacheHitCount, out propertyNameCacheMissCount, out objectIdentityCacheHitCount, out objectIdentityCacheMissCount, out fastFunctionCallCount);
             }
 
             void IV8SplitProxyNative.V8Context_CollectGarbage(V8Context.Handle hContext, bool exhaustive)
@@ -7546,6 +8943,19 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_OnAccessSettingsChanged(hContext);
             }
 
+            void IV8SplitProxyNative.V8Context_OnEnumerationSettingsChanged(V8Context.Handle hContext)
+            {
+                V8Context_OnEnumerationSettingsChanged(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_InvalidateHostMemberCache(V8Context.Handle hContext, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    V8Context_InvalidateHostMemberCache(hContext, namesScope.Value);
+                }
+            }
+
             bool IV8SplitProxyNative.V8Context_BeginCpuProfile(V8Context.Handle hContext, string name, bool recordSamples)
             {
                 using (var nameScope = StdString.CreateScope(name))
@@ -7644,6 +9054,29 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_GetNamedProperties(V8Object.Handle hObject, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_GetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                        return StdV8ValueArray.ToArray(valuesScope.Value);
+                    }
+                }
+            }
+
+            void IV8SplitProxyNative.V8Object_SetNamedProperties(V8Object.Handle hObject, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        V8Object_SetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                    }
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_GetIndexedProperty(V8Object.Handle hObject, int index)
             {
                 using (var valueScope = V8Value.CreateScope())
@@ -7675,6 +9108,45 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_ExportArray(V8Object.Handle hObject)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope())
+                {
+                    using (var packedValuesScope = StdByteArray.CreateScope())
+                    {
+                        var kind = V8Object_ExportArray(hObject, valuesScope.Value, packedValuesScope.Value);
+                        if (kind == V8Object.ArrayExportKind.Unsupported)
+                        {
+                            return null;
+                        }
+
+                        return (kind == V8Object.ArrayExportKind.Values) ? StdV8ValueArray.ToArray(valuesScope.Value) : V8Object.GetPackedArray(kind, packedValuesScope.Value);
+                    }
+                }
+            }
+
+            byte[] IV8SplitProxyNative.V8Object_Serialize(V8Object.Handle hObject, out object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope())
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_Serialize(hObject, dataScope.Value, sharedObjectsScope.Value);
+                        sharedObjects = StdV8ValueArray.ToArray(sharedObjectsScope.Value);
+                        return StdByteArray.ToArray(dataScope.Value);
+                    }
+                }
+            }
+
+            string IV8SplitProxyNative.V8Object_ToJson(V8Object.Handle hObject)
+            {
+                using (var jsonScope = StdString.CreateScope())
+                {
+                    V8Object_ToJson(hObject, jsonScope.Value);
+                    return StdString.GetValue(jsonScope.Value);
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_Invoke(V8Object.Handle hObject, bool asConstructor, object[] args)
             {
                 using (var argsScope = StdV8ValueArray.CreateScope(args))
@@ -7788,6 +9260,56 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_SetEnabled(bool enabled)
+            {
+                V8SplitProxyStatistics_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_Reset()
+            {
+                V8SplitProxyStatistics_Reset();
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_GetSnapshot(out string[] names, out int[] kinds, out ulong[] bucketCounts)
+            {
+                using (var namesScope = StdStringArray.CreateScope())
+                {
+                    using (var kindsScope = StdInt32Array.CreateScope())
+                    {
+                        using (var bucketCountsScope = StdUInt64Array.CreateScope())
+                        {
+                            V8SplitProxyStatistics_GetSnapshot(namesScope.Value, kindsScope.Value, bucketCountsScope.Value);
+                            names = StdStringArray.ToArray(namesScope.Value);
+                            kinds = StdInt32Array.ToArray(kindsScope.Value);
+                            bucketCounts = StdUInt64Array.ToArray(bucketCountsScope.Value);
+                        }
+                    }
+                }
+            }
+
+            #endregion
+
+            #region trace recorder
+
+            void IV8SplitProxyNative.V8TraceRecorder_SetEnabled(bool enabled)
+            {
+                V8TraceRecorder_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_Clear()
+            {
+                V8TraceRecorder_Clear();
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_WriteJson(IntPtr pStream)
+            {
+                V8TraceRecorder_WriteJson(pStream);
+            }
+
+            #endregion
+
             #region unit test support
 
             UIntPtr IV8SplitProxyNative.V8UnitTestSupport_GetTextDigest(string value)
@@ -7844,6 +9366,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] IntPtr pMemory
             );
 
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern IntPtr Memory_AllocateTransient(
+                [In] UIntPtr size
+            );
+
             #endregion
 
             #region StdString methods
@@ -7857,7 +9384,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern IntPtr StdString_GetValue(
                 [In] StdString.Ptr pString,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
@@ -7896,7 +9424,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern IntPtr StdStringArray_GetElement(
                 [In] StdStringArray.Ptr pArray,
                 [In] int index,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
@@ -8159,6 +9688,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern void V8Value_SetHostObject(
                 [In] V8Value.Ptr pV8Value,
                 [In] IntPtr pObject,
+                [In] int identity,
+                [In] int typeId,
                 [In] V8Value.Subtype subtype,
                 [In] V8Value.Flags flags
             );
@@ -8284,6 +9815,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Isolate_GetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Isolate_SetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Isolate_AwaitDebuggerAndPause(
                 [In] V8Isolate.Handle hIsolate
@@ -8388,6 +9930,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -8472,6 +10016,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Context_GetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_SetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_InvokeWithLock(
                 [In] V8Context.Handle hContext,
@@ -8499,6 +10054,53 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] [MarshalAs(UnmanagedType.I1)] bool globalMembers
             );
 
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateArray(
+                [In] V8Context.Handle hContext,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pArray
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateObject(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pObject
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_Deserialize(
+                [In] V8Context.Handle hContext,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJson(
+                [In] V8Context.Handle hContext,
+                [In] StdString.Ptr pJson,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJsonUtf8(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pJson,
+                [In] int length,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateFastFunction(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pFunction,
+                [In] V8FastFunctionCallType returnType,
+                [In] StdInt32Array.Ptr pArgTypes,
+                [In] V8Value.Ptr pV8Function
+            );
+
             [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_AwaitDebuggerAndPause(
                 [In] V8Context.Handle hContext
@@ -8582,6 +10184,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Value.Ptr pResult
             );
 
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ExecuteBatch(
+                [In] V8Context.Handle hContext,
+                [In] StdInt32Array.Ptr pCommands,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdV8ValueArray.Ptr pResults,
+                [In] StdStringArray.Ptr pErrors
+            );
+
             [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_Interrupt(
                 [In] V8Context.Handle hContext
@@ -8634,6 +10246,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -8643,7 +10257,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext,
                 [Out] out ulong scriptCount,
                 [Out] out ulong moduleCount,
-                [Out] out ulong moduleCacheSize
+                [Out] out ulong moduleCacheSize,
+                [Out] out ulong propertyNameCacheHitCount,
+                [Out] out ulong propertyNameCacheMissCount,
+                [Out] out ulong objectIdentityCacheHitCount,
+                [Out] out ulong objectIdentityCacheMissCount,
+                [Out] out ulong fastFunctionCallCount
             );
 
             [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
@@ -8657,6 +10276,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext
             );
 
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_OnEnumerationSettingsChanged(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_InvalidateHostMemberCache(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames
+            );
+
             [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
             [return: MarshalAs(UnmanagedType.I1)]
             private static extern bool V8Context_BeginCpuProfile(
@@ -8734,6 +10364,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdStringArray.Ptr pNames
             );
 
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_GetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_SetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
             [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_GetIndexedProperty(
                 [In] V8Object.Handle hObject,
@@ -8761,6 +10405,26 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdInt32Array.Ptr pIndices
             );
 
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern V8Object.ArrayExportKind V8Object_ExportArray(
+                [In] V8Object.Handle hObject,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdByteArray.Ptr pPackedValues
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_Serialize(
+                [In] V8Object.Handle hObject,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_ToJson(
+                [In] V8Object.Handle hObject,
+                [In] StdString.Ptr pJson
+            );
+
             [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_Invoke(
                 [In] V8Object.Handle hObject,
@@ -8859,6 +10523,42 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_Reset();
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_GetSnapshot(
+                [In] StdStringArray.Ptr pNames,
+                [In] StdInt32Array.Ptr pKinds,
+                [In] StdUInt64Array.Ptr pBucketCounts
+            );
+
+            #endregion
+
+            #region trace recorder
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_Clear();
+
+            [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_WriteJson(
+                [In] IntPtr pStream
+            );
+
+            #endregion
+
             #region unit test support
 
             [DllImport("ClearScriptV8.linux-x64.so", CallingConvention = CallingConvention.StdCall)]
@@ -8924,6 +10624,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 Memory_Free(pMemory);
             }
 
+            IntPtr IV8SplitProxyNative.Memory_AllocateTransient(UIntPtr size)
+            {
+                return Memory_AllocateTransient(size);
+            }
+
             #endregion
 
             #region StdString methods
@@ -8935,20 +10640,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdString_GetValue(StdString.Ptr pString)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue>(StdString.Ptr pString, Func<IntPtr, int, TValue> factory)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory) : factory(pValue, length);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue, TArg>(StdString.Ptr pString, Func<IntPtr, int, TArg, TValue> factory, in TArg arg)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length, arg);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory, arg) : factory(pValue, length, arg);
             }
 
             void IV8SplitProxyNative.StdString_SetValue(StdString.Ptr pString, string value)
@@ -8982,8 +10687,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdStringArray_GetElement(StdStringArray.Ptr pArray, int index)
             {
-                var pValue = StdStringArray_GetElement(pArray, index, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdStringArray_GetElement(pArray, index, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             void IV8SplitProxyNative.StdStringArray_SetElement(StdStringArray.Ptr pArray, int index, string value)
@@ -9224,9 +10929,9 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Value_SetV8Object(pV8Value, hObject, subtype, flags);
             }
 
-            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, V8Value.Subtype subtype, V8Value.Flags flags)
+            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, int identity, int typeId, V8Value.Subtype subtype, V8Value.Flags flags)
             {
-                V8Value_SetHostObject(pV8Value, pObject, subtype, flags);
+                V8Value_SetHostObject(pV8Value, pObject, identity, typeId, subtype, flags);
             }
 
             void IV8SplitProxyNative.V8Value_Decode(V8Value.Ptr pV8Value, out V8Value.Decoded decoded)
@@ -9344,6 +11049,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_SetMaxStackUsage(hIsolate, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Isolate_GetMaxStringCacheSize(V8Isolate.Handle hIsolate)
+            {
+                return V8Isolate_GetMaxStringCacheSize(hIsolate);
+            }
+
+            void IV8SplitProxyNative.V8Isolate_SetMaxStringCacheSize(V8Isolate.Handle hIsolate, UIntPtr size)
+            {
+                V8Isolate_SetMaxStringCacheSize(hIsolate, size);
+            }
+
             void IV8SplitProxyNative.V8Isolate_AwaitDebuggerAndPause(V8Isolate.Handle hIsolate)
             {
                 V8Isolate_AwaitDebuggerAndPause(hIsolate);
@@ -9452,13 +11167,13 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_GetHeapStatistics(hIsolate, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
@@ -9540,6 +11255,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_SetMaxIsolateStackUsage(hContext, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Context_GetMaxIsolateStringCacheSize(V8Context.Handle hContext)
+            {
+                return V8Context_GetMaxIsolateStringCacheSize(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_SetMaxIsolateStringCacheSize(V8Context.Handle hContext, UIntPtr size)
+            {
+                V8Context_SetMaxIsolateStringCacheSize(hContext, size);
+            }
+
             void IV8SplitProxyNative.V8Context_InvokeWithLock(V8Context.Handle hContext, IntPtr pAction)
             {
                 V8Context_InvokeWithLock(hContext, pAction);
@@ -9570,6 +11295,81 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object IV8SplitProxyNative.V8Context_CreateArray(V8Context.Handle hContext, object[] values)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                {
+                    using (var arrayScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateArray(hContext, valuesScope.Value, arrayScope.Value);
+                        return V8Value.Get(arrayScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateObject(V8Context.Handle hContext, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        using (var objScope = V8Value.CreateScope())
+                        {
+                            V8Context_CreateObject(hContext, namesScope.Value, valuesScope.Value, objScope.Value);
+                            return V8Value.Get(objScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_Deserialize(V8Context.Handle hContext, byte[] data, object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope(data))
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope(sharedObjects))
+                    {
+                        using (var valueScope = V8Value.CreateScope())
+                        {
+                            V8Context_Deserialize(hContext, dataScope.Value, sharedObjectsScope.Value, valueScope.Value);
+                            return V8Value.Get(valueScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJson(V8Context.Handle hContext, string json)
+            {
+                using (var jsonScope = StdString.CreateScope(json))
+                {
+                    using (var valueScope = V8Value.CreateScope())
+                    {
+                        V8Context_ParseJson(hContext, jsonScope.Value, valueScope.Value);
+                        return V8Value.Get(valueScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJsonUtf8(V8Context.Handle hContext, IntPtr pJson, int length)
+            {
+                using (var valueScope = V8Value.CreateScope())
+                {
+                    V8Context_ParseJsonUtf8(hContext, pJson, length, valueScope.Value);
+                    return V8Value.Get(valueScope.Value);
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateFastFunction(V8Context.Handle hContext, IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes)
+            {
+                using (var argTypesScope = StdInt32Array.CreateScope(argTypes))
+                {
+                    using (var functionScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateFastFunction(hContext, pFunction, returnType, argTypesScope.Value, functionScope.Value);
+                        return V8Value.Get(functionScope.Value);
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_AwaitDebuggerAndPause(V8Context.Handle hContext)
             {
                 V8Context_AwaitDebuggerAndPause(hContext);
@@ -9680,6 +11480,28 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            void IV8SplitProxyNative.V8Context_ExecuteBatch(V8Context.Handle hContext, int[] commands, string[] names, object[] values, out object[] results, out string[] errors)
+            {
+                using (var commandsScope = StdInt32Array.CreateScope(commands))
+                {
+                    using (var namesScope = StdStringArray.CreateScope(names))
+                    {
+                        using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                        {
+                            using (var resultsScope = StdV8ValueArray.CreateScope())
+                            {
+                                using (var errorsScope = StdStringArray.CreateScope())
+                                {
+                                    V8Context_ExecuteBatch(hContext, commandsScope.Value, namesScope.Value, valuesScope.Value, resultsScope.Value, errorsScope.Value);
+                                    results = StdV8ValueArray.ToArray(resultsScope.Value);
+                                    errors = StdStringArray.ToArray(errorsScope.Value);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_Interrupt(V8Context.Handle hContext)
             {
                 V8Context_Interrupt(hContext);
@@ -9715,22 +11537,22 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_GetIsolateHeapStatistics(hContext, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
                 }
             }
 
-            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize)
+            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize, out ulong propertyNameCacheHitCount, out ulong propertyNameCacheMissCount, out ulong objectIdentityCacheHitCount, out ulong objectIdentityCacheMissCount, out ulong fastFunctionCallCount)
             {
-                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize);
+                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize, out propertyNameCacheHitCount, out propertyNameCacheMissCount, out objectIdentityCacheHitCount, out objectIdentityCacheMissCount, out fastFunctionCallCount);
             }
 
             void IV8SplitProxyNative.V8Context_CollectGarbage(V8Context.Handle hContext, bool exhaustive)
@@ -9743,6 +11565,19 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_OnAccessSettingsChanged(hContext);
             }
 
+            void IV8SplitProxyNative.V8Context_OnEnumerationSettingsChanged(V8Context.Handle hContext)
+            {
+                V8Context_OnEnumerationSettingsChanged(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_InvalidateHostMemberCache(V8Context.Handle hContext, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    V8Context_InvalidateHostMemberCache(hContext, namesScope.Value);
+                }
+            }
+
             bool IV8SplitProxyNative.V8Context_BeginCpuProfile(V8Context.Handle hContext, string name, bool recordSamples)
             {
                 using (var nameScope = StdString.CreateScope(name))
@@ -9841,6 +11676,29 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_GetNamedProperties(V8Object.Handle hObject, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_GetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                        return StdV8ValueArray.ToArray(valuesScope.Value);
+                    }
+                }
+            }
+
+            void IV8SplitProxyNative.V8Object_SetNamedProperties(V8Object.Handle hObject, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        V8Object_SetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                    }
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_GetIndexedProperty(V8Object.Handle hObject, int index)
             {
                 using (var valueScope = V8Value.CreateScope())
@@ -9872,6 +11730,45 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_ExportArray(V8Object.Handle hObject)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope())
+                {
+                    using (var packedValuesScope = StdByteArray.CreateScope())
+                    {
+                        var kind = V8Object_ExportArray(hObject, valuesScope.Value, packedValuesScope.Value);
+                        if (kind == V8Object.ArrayExportKind.Unsupported)
+                        {
+                            return null;
+                        }
+
+                        return (kind == V8Object.ArrayExportKind.Values) ? StdV8ValueArray.ToArray(valuesScope.Value) : V8Object.GetPackedArray(kind, packedValuesScope.Value);
+                    }
+                }
+            }
+
+            byte[] IV8SplitProxyNative.V8Object_Serialize(V8Object.Handle hObject, out object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope())
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_Serialize(hObject, dataScope.Value, sharedObjectsScope.Value);
+                        sharedObjects = StdV8ValueArray.ToArray(sharedObjectsScope.Value);
+                        return StdByteArray.ToArray(dataScope.Value);
+                    }
+                }
+            }
+
+            string IV8SplitProxyNative.V8Object_ToJson(V8Object.Handle hObject)
+            {
+                using (var jsonScope = StdString.CreateScope())
+                {
+                    V8Object_ToJson(hObject, jsonScope.Value);
+                    return StdString.GetValue(jsonScope.Value);
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_Invoke(V8Object.Handle hObject, bool asConstructor, object[] args)
             {
                 using (var argsScope = StdV8ValueArray.CreateScope(args))
@@ -9985,6 +11882,56 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_SetEnabled(bool enabled)
+            {
+                V8SplitProxyStatistics_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_Reset()
+            {
+                V8SplitProxyStatistics_Reset();
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_GetSnapshot(out string[] names, out int[] kinds, out ulong[] bucketCounts)
+            {
+                using (var namesScope = StdStringArray.CreateScope())
+                {
+                    using (var kindsScope = StdInt32Array.CreateScope())
+                    {
+                        using (var bucketCountsScope = StdUInt64Array.CreateScope())
+                        {
+                            V8SplitProxyStatistics_GetSnapshot(namesScope.Value, kindsScope.Value, bucketCountsScope.Value);
+                            names = StdStringArray.ToArray(namesScope.Value);
+                            kinds = StdInt32Array.ToArray(kindsScope.Value);
+                            bucketCounts = StdUInt64Array.ToArray(bucketCountsScope.Value);
+                        }
+                    }
+                }
+            }
+
+            #endregion
+
+            #region trace recorder
+
+            void IV8SplitProxyNative.V8TraceRecorder_SetEnabled(bool enabled)
+            {
+                V8TraceRecorder_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_Clear()
+            {
+                V8TraceRecorder_Clear();
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_WriteJson(IntPtr pStream)
+            {
+                V8TraceRecorder_WriteJson(pStream);
+            }
+
+            #endregion
+
             #region unit test support
 
             UIntPtr IV8SplitProxyNative.V8UnitTestSupport_GetTextDigest(string value)
@@ -10041,6 +11988,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] IntPtr pMemory
             );
 
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern IntPtr Memory_AllocateTransient(
+                [In] UIntPtr size
+            );
+
             #endregion
 
             #region StdString methods
@@ -10054,7 +12006,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern IntPtr StdString_GetValue(
                 [In] StdString.Ptr pString,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
@@ -10093,7 +12046,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern IntPtr StdStringArray_GetElement(
                 [In] StdStringArray.Ptr pArray,
                 [In] int index,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
@@ -10356,6 +12310,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern void V8Value_SetHostObject(
                 [In] V8Value.Ptr pV8Value,
                 [In] IntPtr pObject,
+                [In] int identity,
+                [In] int typeId,
                 [In] V8Value.Subtype subtype,
                 [In] V8Value.Flags flags
             );
@@ -10481,6 +12437,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Isolate_GetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Isolate_SetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Isolate_AwaitDebuggerAndPause(
                 [In] V8Isolate.Handle hIsolate
@@ -10585,6 +12552,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -10669,6 +12638,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Context_GetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_SetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_InvokeWithLock(
                 [In] V8Context.Handle hContext,
@@ -10696,6 +12676,53 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] [MarshalAs(UnmanagedType.I1)] bool globalMembers
             );
 
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateArray(
+                [In] V8Context.Handle hContext,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pArray
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateObject(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pObject
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_Deserialize(
+                [In] V8Context.Handle hContext,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJson(
+                [In] V8Context.Handle hContext,
+                [In] StdString.Ptr pJson,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJsonUtf8(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pJson,
+                [In] int length,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateFastFunction(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pFunction,
+                [In] V8FastFunctionCallType returnType,
+                [In] StdInt32Array.Ptr pArgTypes,
+                [In] V8Value.Ptr pV8Function
+            );
+
             [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_AwaitDebuggerAndPause(
                 [In] V8Context.Handle hContext
@@ -10779,6 +12806,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Value.Ptr pResult
             );
 
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ExecuteBatch(
+                [In] V8Context.Handle hContext,
+                [In] StdInt32Array.Ptr pCommands,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdV8ValueArray.Ptr pResults,
+                [In] StdStringArray.Ptr pErrors
+            );
+
             [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_Interrupt(
                 [In] V8Context.Handle hContext
@@ -10831,6 +12868,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -10840,7 +12879,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext,
                 [Out] out ulong scriptCount,
                 [Out] out ulong moduleCount,
-                [Out] out ulong moduleCacheSize
+                [Out] out ulong moduleCacheSize,
+                [Out] out ulong propertyNameCacheHitCount,
+                [Out] out ulong propertyNameCacheMissCount,
+                [Out] out ulong objectIdentityCacheHitCount,
+                [Out] out ulong objectIdentityCacheMissCount,
+                [Out] out ulong fastFunctionCallCount
             );
 
             [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
@@ -10854,6 +12898,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext
             );
 
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_OnEnumerationSettingsChanged(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_InvalidateHostMemberCache(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames
+            );
+
             [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
             [return: MarshalAs(UnmanagedType.I1)]
             private static extern bool V8Context_BeginCpuProfile(
@@ -10931,6 +12986,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdStringArray.Ptr pNames
             );
 
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_GetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_SetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
             [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_GetIndexedProperty(
                 [In] V8Object.Handle hObject,
@@ -10958,6 +13027,26 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdInt32Array.Ptr pIndices
             );
 
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern V8Object.ArrayExportKind V8Object_ExportArray(
+                [In] V8Object.Handle hObject,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdByteArray.Ptr pPackedValues
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_Serialize(
+                [In] V8Object.Handle hObject,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_ToJson(
+                [In] V8Object.Handle hObject,
+                [In] StdString.Ptr pJson
+            );
+
             [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_Invoke(
                 [In] V8Object.Handle hObject,
@@ -11056,6 +13145,42 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_Reset();
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_GetSnapshot(
+                [In] StdStringArray.Ptr pNames,
+                [In] StdInt32Array.Ptr pKinds,
+                [In] StdUInt64Array.Ptr pBucketCounts
+            );
+
+            #endregion
+
+            #region trace recorder
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_Clear();
+
+            [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_WriteJson(
+                [In] IntPtr pStream
+            );
+
+            #endregion
+
             #region unit test support
 
             [DllImport("ClearScriptV8.linux-arm64.so", CallingConvention = CallingConvention.StdCall)]
@@ -11121,6 +13246,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 Memory_Free(pMemory);
             }
 
+            IntPtr IV8SplitProxyNative.Memory_AllocateTransient(UIntPtr size)
+            {
+                return Memory_AllocateTransient(size);
+            }
+
             #endregion
 
             #region StdString methods
@@ -11132,20 +13262,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdString_GetValue(StdString.Ptr pString)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue>(StdString.Ptr pString, Func<IntPtr, int, TValue> factory)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory) : factory(pValue, length);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue, TArg>(StdString.Ptr pString, Func<IntPtr, int, TArg, TValue> factory, in TArg arg)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length, arg);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory, arg) : factory(pValue, length, arg);
             }
 
             void IV8SplitProxyNative.StdString_SetValue(StdString.Ptr pString, string value)
@@ -11179,8 +13309,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdStringArray_GetElement(StdStringArray.Ptr pArray, int index)
             {
-                var pValue = StdStringArray_GetElement(pArray, index, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdStringArray_GetElement(pArray, index, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             void IV8SplitProxyNative.StdStringArray_SetElement(StdStringArray.Ptr pArray, int index, string value)
@@ -11421,9 +13551,9 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Value_SetV8Object(pV8Value, hObject, subtype, flags);
             }
 
-            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, V8Value.Subtype subtype, V8Value.Flags flags)
+            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, int identity, int typeId, V8Value.Subtype subtype, V8Value.Flags flags)
             {
-                V8Value_SetHostObject(pV8Value, pObject, subtype, flags);
+                V8Value_SetHostObject(pV8Value, pObject, identity, typeId, subtype, flags);
             }
 
             void IV8SplitProxyNative.V8Value_Decode(V8Value.Ptr pV8Value, out V8Value.Decoded decoded)
@@ -11541,6 +13671,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_SetMaxStackUsage(hIsolate, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Isolate_GetMaxStringCacheSize(V8Isolate.Handle hIsolate)
+            {
+                return V8Isolate_GetMaxStringCacheSize(hIsolate);
+            }
+
+            void IV8SplitProxyNative.V8Isolate_SetMaxStringCacheSize(V8Isolate.Handle hIsolate, UIntPtr size)
+            {
+                V8Isolate_SetMaxStringCacheSize(hIsolate, size);
+            }
+
             void IV8SplitProxyNative.V8Isolate_AwaitDebuggerAndPause(V8Isolate.Handle hIsolate)
             {
                 V8Isolate_AwaitDebuggerAndPause(hIsolate);
@@ -11649,13 +13789,13 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_GetHeapStatistics(hIsolate, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
@@ -11737,6 +13877,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_SetMaxIsolateStackUsage(hContext, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Context_GetMaxIsolateStringCacheSize(V8Context.Handle hContext)
+            {
+                return V8Context_GetMaxIsolateStringCacheSize(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_SetMaxIsolateStringCacheSize(V8Context.Handle hContext, UIntPtr size)
+            {
+                V8Context_SetMaxIsolateStringCacheSize(hContext, size);
+            }
+
             void IV8SplitProxyNative.V8Context_InvokeWithLock(V8Context.Handle hContext, IntPtr pAction)
             {
                 V8Context_InvokeWithLock(hContext, pAction);
@@ -11767,6 +13917,81 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object IV8SplitProxyNative.V8Context_CreateArray(V8Context.Handle hContext, object[] values)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                {
+                    using (var arrayScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateArray(hContext, valuesScope.Value, arrayScope.Value);
+                        return V8Value.Get(arrayScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateObject(V8Context.Handle hContext, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        using (var objScope = V8Value.CreateScope())
+                        {
+                            V8Context_CreateObject(hContext, namesScope.Value, valuesScope.Value, objScope.Value);
+                            return V8Value.Get(objScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_Deserialize(V8Context.Handle hContext, byte[] data, object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope(data))
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope(sharedObjects))
+                    {
+                        using (var valueScope = V8Value.CreateScope())
+                        {
+                            V8Context_Deserialize(hContext, dataScope.Value, sharedObjectsScope.Value, valueScope.Value);
+                            return V8Value.Get(valueScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJson(V8Context.Handle hContext, string json)
+            {
+                using (var jsonScope = StdString.CreateScope(json))
+                {
+                    using (var valueScope = V8Value.CreateScope())
+                    {
+                        V8Context_ParseJson(hContext, jsonScope.Value, valueScope.Value);
+                        return V8Value.Get(valueScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJsonUtf8(V8Context.Handle hContext, IntPtr pJson, int length)
+            {
+                using (var valueScope = V8Value.CreateScope())
+                {
+                    V8Context_ParseJsonUtf8(hContext, pJson, length, valueScope.Value);
+                    return V8Value.Get(valueScope.Value);
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateFastFunction(V8Context.Handle hContext, IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes)
+            {
+                using (var argTypesScope = StdInt32Array.CreateScope(argTypes))
+                {
+                    using (var functionScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateFastFunction(hContext, pFunction, returnType, argTypesScope.Value, functionScope.Value);
+                        return V8Value.Get(functionScope.Value);
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_AwaitDebuggerAndPause(V8Context.Handle hContext)
             {
                 V8Context_AwaitDebuggerAndPause(hContext);
@@ -11877,6 +14102,28 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            void IV8SplitProxyNative.V8Context_ExecuteBatch(V8Context.Handle hContext, int[] commands, string[] names, object[] values, out object[] results, out string[] errors)
+            {
+                using (var commandsScope = StdInt32Array.CreateScope(commands))
+                {
+                    using (var namesScope = StdStringArray.CreateScope(names))
+                    {
+                        using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                        {
+                            using (var resultsScope = StdV8ValueArray.CreateScope())
+                            {
+                                using (var errorsScope = StdStringArray.CreateScope())
+                                {
+                                    V8Context_ExecuteBatch(hContext, commandsScope.Value, namesScope.Value, valuesScope.Value, resultsScope.Value, errorsScope.Value);
+                                    results = StdV8ValueArray.ToArray(resultsScope.Value);
+                                    errors = StdStringArray.ToArray(errorsScope.Value);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_Interrupt(V8Context.Handle hContext)
             {
                 V8Context_Interrupt(hContext);
@@ -11912,22 +14159,22 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_GetIsolateHeapStatistics(hContext, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
                 }
             }
 
-            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize)
+            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize, out ulong propertyNameCacheHitCount, out ulong propertyNameCacheMissCount, out ulong objectIdentityCacheHitCount, out ulong objectIdentityCacheMissCount, out ulong fastFunctionCallCount)
             {
-                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize);
+                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize, out propertyNameCacheHitCount, out propertyNameCacheMissCount, out objectIdentityCacheHitCount, out objectIdentityCacheMissCount, out fastFunctionCallCount);
             }
 
             void IV8SplitProxyNative.V8Context_CollectGarbage(V8Context.Handle hContext, bool exhaustive)
@@ -11940,6 +14187,19 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_OnAccessSettingsChanged(hContext);
             }
 
+            void IV8SplitProxyNative.V8Context_OnEnumerationSettingsChanged(V8Context.Handle hContext)
+            {
+                V8Context_OnEnumerationSettingsChanged(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_InvalidateHostMemberCache(V8Context.Handle hContext, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    V8Context_InvalidateHostMemberCache(hContext, namesScope.Value);
+                }
+            }
+
             bool IV8SplitProxyNative.V8Context_BeginCpuProfile(V8Context.Handle hContext, string name, bool recordSamples)
             {
                 using (var nameScope = StdString.CreateScope(name))
@@ -12038,6 +14298,29 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_GetNamedProperties(V8Object.Handle hObject, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_GetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                        return StdV8ValueArray.ToArray(valuesScope.Value);
+                    }
+                }
+            }
+
+            void IV8SplitProxyNative.V8Object_SetNamedProperties(V8Object.Handle hObject, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        V8Object_SetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                    }
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_GetIndexedProperty(V8Object.Handle hObject, int index)
             {
                 using (var valueScope = V8Value.CreateScope())
@@ -12069,6 +14352,45 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_ExportArray(V8Object.Handle hObject)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope())
+                {
+                    using (var packedValuesScope = StdByteArray.CreateScope())
+                    {
+                        var kind = V8Object_ExportArray(hObject, valuesScope.Value, packedValuesScope.Value);
+                        if (kind == V8Object.ArrayExportKind.Unsupported)
+                        {
+                            return null;
+                        }
+
+                        return (kind == V8Object.ArrayExportKind.Values) ? StdV8ValueArray.ToArray(valuesScope.Value) : V8Object.GetPackedArray(kind, packedValuesScope.Value);
+                    }
+                }
+            }
+
+            byte[] IV8SplitProxyNative.V8Object_Serialize(V8Object.Handle hObject, out object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope())
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_Serialize(hObject, dataScope.Value, sharedObjectsScope.Value);
+                        sharedObjects = StdV8ValueArray.ToArray(sharedObjectsScope.Value);
+                        return StdByteArray.ToArray(dataScope.Value);
+                    }
+                }
+            }
+
+            string IV8SplitProxyNative.V8Object_ToJson(V8Object.Handle hObject)
+            {
+                using (var jsonScope = StdString.CreateScope())
+                {
+                    V8Object_ToJson(hObject, jsonScope.Value);
+                    return StdString.GetValue(jsonScope.Value);
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_Invoke(V8Object.Handle hObject, bool asConstructor, object[] args)
             {
                 using (var argsScope = StdV8ValueArray.CreateScope(args))
@@ -12182,6 +14504,56 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_SetEnabled(bool enabled)
+            {
+                V8SplitProxyStatistics_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_Reset()
+            {
+                V8SplitProxyStatistics_Reset();
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_GetSnapshot(out string[] names, out int[] kinds, out ulong[] bucketCounts)
+            {
+                using (var namesScope = StdStringArray.CreateScope())
+                {
+                    using (var kindsScope = StdInt32Array.CreateScope())
+                    {
+                        using (var bucketCountsScope = StdUInt64Array.CreateScope())
+                        {
+                            V8SplitProxyStatistics_GetSnapshot(namesScope.Value, kindsScope.Value, bucketCountsScope.Value);
+                            names = StdStringArray.ToArray(namesScope.Value);
+                            kinds = StdInt32Array.ToArray(kindsScope.Value);
+                            bucketCounts = StdUInt64Array.ToArray(bucketCountsScope.Value);
+                        }
+                    }
+                }
+            }
+
+            #endregion
+
+            #region trace recorder
+
+            void IV8SplitProxyNative.V8TraceRecorder_SetEnabled(bool enabled)
+            {
+                V8TraceRecorder_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_Clear()
+            {
+                V8TraceRecorder_Clear();
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_WriteJson(IntPtr pStream)
+            {
+                V8TraceRecorder_WriteJson(pStream);
+            }
+
+            #endregion
+
             #region unit test support
 
             UIntPtr IV8SplitProxyNative.V8UnitTestSupport_GetTextDigest(string value)
@@ -12238,6 +14610,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] IntPtr pMemory
             );
 
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern IntPtr Memory_AllocateTransient(
+                [In] UIntPtr size
+            );
+
             #endregion
 
             #region StdString methods
@@ -12251,7 +14628,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
             private static extern IntPtr StdString_GetValue(
                 [In] StdString.Ptr pString,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
@@ -12290,7 +14668,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern IntPtr StdStringArray_GetElement(
                 [In] StdStringArray.Ptr pArray,
                 [In] int index,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
@@ -12553,6 +14932,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern void V8Value_SetHostObject(
                 [In] V8Value.Ptr pV8Value,
                 [In] IntPtr pObject,
+                [In] int identity,
+                [In] int typeId,
                 [In] V8Value.Subtype subtype,
                 [In] V8Value.Flags flags
             );
@@ -12678,6 +15059,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Isolate_GetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Isolate_SetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Isolate_AwaitDebuggerAndPause(
                 [In] V8Isolate.Handle hIsolate
@@ -12782,6 +15174,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -12866,6 +15260,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Context_GetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_SetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_InvokeWithLock(
                 [In] V8Context.Handle hContext,
@@ -12893,6 +15298,53 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] [MarshalAs(UnmanagedType.I1)] bool globalMembers
             );
 
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateArray(
+                [In] V8Context.Handle hContext,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pArray
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateObject(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pObject
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_Deserialize(
+                [In] V8Context.Handle hContext,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJson(
+                [In] V8Context.Handle hContext,
+                [In] StdString.Ptr pJson,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJsonUtf8(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pJson,
+                [In] int length,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateFastFunction(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pFunction,
+                [In] V8FastFunctionCallType returnType,
+                [In] StdInt32Array.Ptr pArgTypes,
+                [In] V8Value.Ptr pV8Function
+            );
+
             [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_AwaitDebuggerAndPause(
                 [In] V8Context.Handle hContext
@@ -12976,6 +15428,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Value.Ptr pResult
             );
 
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ExecuteBatch(
+                [In] V8Context.Handle hContext,
+                [In] StdInt32Array.Ptr pCommands,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdV8ValueArray.Ptr pResults,
+                [In] StdStringArray.Ptr pErrors
+            );
+
             [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_Interrupt(
                 [In] V8Context.Handle hContext
@@ -13028,6 +15490,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -13037,7 +15501,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext,
                 [Out] out ulong scriptCount,
                 [Out] out ulong moduleCount,
-                [Out] out ulong moduleCacheSize
+                [Out] out ulong moduleCacheSize,
+                [Out] out ulong propertyNameCacheHitCount,
+                [Out] out ulong propertyNameCacheMissCount,
+                [Out] out ulong objectIdentityCacheHitCount,
+                [Out] out ulong objectIdentityCacheMissCount,
+                [Out] out ulong fastFunctionCallCount
             );
 
             [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
@@ -13051,6 +15520,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext
             );
 
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_OnEnumerationSettingsChanged(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_InvalidateHostMemberCache(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames
+            );
+
             [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
             [return: MarshalAs(UnmanagedType.I1)]
             private static extern bool V8Context_BeginCpuProfile(
@@ -13128,6 +15608,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdStringArray.Ptr pNames
             );
 
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_GetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_SetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
             [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_GetIndexedProperty(
                 [In] V8Object.Handle hObject,
@@ -13155,6 +15649,26 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdInt32Array.Ptr pIndices
             );
 
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern V8Object.ArrayExportKind V8Object_ExportArray(
+                [In] V8Object.Handle hObject,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdByteArray.Ptr pPackedValues
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_Serialize(
+                [In] V8Object.Handle hObject,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_ToJson(
+                [In] V8Object.Handle hObject,
+                [In] StdString.Ptr pJson
+            );
+
             [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_Invoke(
                 [In] V8Object.Handle hObject,
@@ -13253,6 +15767,42 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_Reset();
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_GetSnapshot(
+                [In] StdStringArray.Ptr pNames,
+                [In] StdInt32Array.Ptr pKinds,
+                [In] StdUInt64Array.Ptr pBucketCounts
+            );
+
+            #endregion
+
+            #region trace recorder
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_Clear();
+
+            [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_WriteJson(
+                [In] IntPtr pStream
+            );
+
+            #endregion
+
             #region unit test support
 
             [DllImport("ClearScriptV8.linux-arm.so", CallingConvention = CallingConvention.StdCall)]
@@ -13318,6 +15868,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 Memory_Free(pMemory);
             }
 
+            IntPtr IV8SplitProxyNative.Memory_AllocateTransient(UIntPtr size)
+            {
+                return Memory_AllocateTransient(size);
+            }
+
             #endregion
 
             #region StdString methods
@@ -13329,20 +15884,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdString_GetValue(StdString.Ptr pString)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue>(StdString.Ptr pString, Func<IntPtr, int, TValue> factory)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory) : factory(pValue, length);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue, TArg>(StdString.Ptr pString, Func<IntPtr, int, TArg, TValue> factory, in TArg arg)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length, arg);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory, arg) : factory(pValue, length, arg);
             }
 
             void IV8SplitProxyNative.StdString_SetValue(StdString.Ptr pString, string value)
@@ -13376,8 +15931,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdStringArray_GetElement(StdStringArray.Ptr pArray, int index)
             {
-                var pValue = StdStringArray_GetElement(pArray, index, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdStringArray_GetElement(pArray, index, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             void IV8SplitProxyNative.StdStringArray_SetElement(StdStringArray.Ptr pArray, int index, string value)
@@ -13618,9 +16173,9 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Value_SetV8Object(pV8Value, hObject, subtype, flags);
             }
 
-            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, V8Value.Subtype subtype, V8Value.Flags flags)
+            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, int identity, int typeId, V8Value.Subtype subtype, V8Value.Flags flags)
             {
-                V8Value_SetHostObject(pV8Value, pObject, subtype, flags);
+                V8Value_SetHostObject(pV8Value, pObject, identity, typeId, subtype, flags);
             }
 
             void IV8SplitProxyNative.V8Value_Decode(V8Value.Ptr pV8Value, out V8Value.Decoded decoded)
@@ -13738,6 +16293,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_SetMaxStackUsage(hIsolate, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Isolate_GetMaxStringCacheSize(V8Isolate.Handle hIsolate)
+            {
+                return V8Isolate_GetMaxStringCacheSize(hIsolate);
+            }
+
+            void IV8SplitProxyNative.V8Isolate_SetMaxStringCacheSize(V8Isolate.Handle hIsolate, UIntPtr size)
+            {
+                V8Isolate_SetMaxStringCacheSize(hIsolate, size);
+            }
+
             void IV8SplitProxyNative.V8Isolate_AwaitDebuggerAndPause(V8Isolate.Handle hIsolate)
             {
                 V8Isolate_AwaitDebuggerAndPause(hIsolate);
@@ -13846,13 +16411,13 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_GetHeapStatistics(hIsolate, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
@@ -13934,6 +16499,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_SetMaxIsolateStackUsage(hContext, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Context_GetMaxIsolateStringCacheSize(V8Context.Handle hContext)
+            {
+                return V8Context_GetMaxIsolateStringCacheSize(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_SetMaxIsolateStringCacheSize(V8Context.Handle hContext, UIntPtr size)
+            {
+                V8Context_SetMaxIsolateStringCacheSize(hContext, size);
+            }
+
             void IV8SplitProxyNative.V8Context_InvokeWithLock(V8Context.Handle hContext, IntPtr pAction)
             {
                 V8Context_InvokeWithLock(hContext, pAction);
@@ -13964,6 +16539,81 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object IV8SplitProxyNative.V8Context_CreateArray(V8Context.Handle hContext, object[] values)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                {
+                    using (var arrayScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateArray(hContext, valuesScope.Value, arrayScope.Value);
+                        return V8Value.Get(arrayScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateObject(V8Context.Handle hContext, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        using (var objScope = V8Value.CreateScope())
+                        {
+                            V8Context_CreateObject(hContext, namesScope.Value, valuesScope.Value, objScope.Value);
+                            return V8Value.Get(objScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_Deserialize(V8Context.Handle hContext, byte[] data, object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope(data))
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope(sharedObjects))
+                    {
+                        using (var valueScope = V8Value.CreateScope())
+                        {
+                            V8Context_Deserialize(hContext, dataScope.Value, sharedObjectsScope.Value, valueScope.Value);
+                            return V8Value.Get(valueScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJson(V8Context.Handle hContext, string json)
+            {
+                using (var jsonScope = StdString.CreateScope(json))
+                {
+                    using (var valueScope = V8Value.CreateScope())
+                    {
+                        V8Context_ParseJson(hContext, jsonScope.Value, valueScope.Value);
+                        return V8Value.Get(valueScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJsonUtf8(V8Context.Handle hContext, IntPtr pJson, int length)
+            {
+                using (var valueScope = V8Value.CreateScope())
+                {
+                    V8Context_ParseJsonUtf8(hContext, pJson, length, valueScope.Value);
+                    return V8Value.Get(valueScope.Value);
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateFastFunction(V8Context.Handle hContext, IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes)
+            {
+                using (var argTypesScope = StdInt32Array.CreateScope(argTypes))
+                {
+                    using (var functionScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateFastFunction(hContext, pFunction, returnType, argTypesScope.Value, functionScope.Value);
+                        return V8Value.Get(functionScope.Value);
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_AwaitDebuggerAndPause(V8Context.Handle hContext)
             {
                 V8Context_AwaitDebuggerAndPause(hContext);
@@ -14074,6 +16724,28 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            void IV8SplitProxyNative.V8Context_ExecuteBatch(V8Context.Handle hContext, int[] commands, string[] names, object[] values, out object[] results, out string[] errors)
+            {
+                using (var commandsScope = StdInt32Array.CreateScope(commands))
+                {
+                    using (var namesScope = StdStringArray.CreateScope(names))
+                    {
+                        using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                        {
+                            using (var resultsScope = StdV8ValueArray.CreateScope())
+                            {
+                                using (var errorsScope = StdStringArray.CreateScope())
+                                {
+                                    V8Context_ExecuteBatch(hContext, commandsScope.Value, namesScope.Value, valuesScope.Value, resultsScope.Value, errorsScope.Value);
+                                    results = StdV8ValueArray.ToArray(resultsScope.Value);
+                                    errors = StdStringArray.ToArray(errorsScope.Value);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_Interrupt(V8Context.Handle hContext)
             {
                 V8Context_Interrupt(hContext);
@@ -14109,22 +16781,22 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_GetIsolateHeapStatistics(hContext, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
                 }
             }
 
-            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize)
+            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize, out ulong propertyNameCacheHitCount, out ulong propertyNameCacheMissCount, out ulong objectIdentityCacheHitCount, out ulong objectIdentityCacheMissCount, out ulong fastFunctionCallCount)
             {
-                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize);
+                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize, out propertyNameCacheHitCount, out propertyNameCacheMissCount, out objectIdentityCacheHitCount, out objectIdentityCacheMissCount, out fastFunctionCallCount);
             }
 
             void IV8SplitProxyNative.V8Context_CollectGarbage(V8Context.Handle hContext, bool exhaustive)
@@ -14137,6 +16809,19 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_OnAccessSettingsChanged(hContext);
             }
 
+            void IV8SplitProxyNative.V8Context_OnEnumerationSettingsChanged(V8Context.Handle hContext)
+            {
+                V8Context_OnEnumerationSettingsChanged(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_InvalidateHostMemberCache(V8Context.Handle hContext, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    V8Context_InvalidateHostMemberCache(hContext, namesScope.Value);
+                }
+            }
+
             bool IV8SplitProxyNative.V8Context_BeginCpuProfile(V8Context.Handle hContext, string name, bool recordSamples)
             {
                 using (var nameScope = StdString.CreateScope(name))
@@ -14235,6 +16920,29 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_GetNamedProperties(V8Object.Handle hObject, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_GetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                        return StdV8ValueArray.ToArray(valuesScope.Value);
+                    }
+                }
+            }
+
+            void IV8SplitProxyNative.V8Object_SetNamedProperties(V8Object.Handle hObject, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        V8Object_SetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                    }
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_GetIndexedProperty(V8Object.Handle hObject, int index)
             {
                 using (var valueScope = V8Value.CreateScope())
@@ -14266,6 +16974,45 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_ExportArray(V8Object.Handle hObject)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope())
+                {
+                    using (var packedValuesScope = StdByteArray.CreateScope())
+                    {
+                        var kind = V8Object_ExportArray(hObject, valuesScope.Value, packedValuesScope.Value);
+                        if (kind == V8Object.ArrayExportKind.Unsupported)
+                        {
+                            return null;
+                        }
+
+                        return (kind == V8Object.ArrayExportKind.Values) ? StdV8ValueArray.ToArray(valuesScope.Value) : V8Object.GetPackedArray(kind, packedValuesScope.Value);
+                    }
+                }
+            }
+
+            byte[] IV8SplitProxyNative.V8Object_Serialize(V8Object.Handle hObject, out object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope())
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_Serialize(hObject, dataScope.Value, sharedObjectsScope.Value);
+                        sharedObjects = StdV8ValueArray.ToArray(sharedObjectsScope.Value);
+                        return StdByteArray.ToArray(dataScope.Value);
+                    }
+                }
+            }
+
+            string IV8SplitProxyNative.V8Object_ToJson(V8Object.Handle hObject)
+            {
+                using (var jsonScope = StdString.CreateScope())
+                {
+                    V8Object_ToJson(hObject, jsonScope.Value);
+                    return StdString.GetValue(jsonScope.Value);
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_Invoke(V8Object.Handle hObject, bool asConstructor, object[] args)
             {
                 using (var argsScope = StdV8ValueArray.CreateScope(args))
@@ -14379,6 +17126,56 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_SetEnabled(bool enabled)
+            {
+                V8SplitProxyStatistics_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_Reset()
+            {
+                V8SplitProxyStatistics_Reset();
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_GetSnapshot(out string[] names, out int[] kinds, out ulong[] bucketCounts)
+            {
+                using (var namesScope = StdStringArray.CreateScope())
+                {
+                    using (var kindsScope = StdInt32Array.CreateScope())
+                    {
+                        using (var bucketCountsScope = StdUInt64Array.CreateScope())
+                        {
+                            V8SplitProxyStatistics_GetSnapshot(namesScope.Value, kindsScope.Value, bucketCountsScope.Value);
+                            names = StdStringArray.ToArray(namesScope.Value);
+                            kinds = StdInt32Array.ToArray(kindsScope.Value);
+                            bucketCounts = StdUInt64Array.ToArray(bucketCountsScope.Value);
+                        }
+                    }
+                }
+            }
+
+            #endregion
+
+            #region trace recorder
+
+            void IV8SplitProxyNative.V8TraceRecorder_SetEnabled(bool enabled)
+            {
+                V8TraceRecorder_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_Clear()
+            {
+                V8TraceRecorder_Clear();
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_WriteJson(IntPtr pStream)
+            {
+                V8TraceRecorder_WriteJson(pStream);
+            }
+
+            #endregion
+
             #region unit test support
 
             UIntPtr IV8SplitProxyNative.V8UnitTestSupport_GetTextDigest(string value)
@@ -14435,6 +17232,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] IntPtr pMemory
             );
 
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern IntPtr Memory_AllocateTransient(
+                [In] UIntPtr size
+            );
+
             #endregion
 
             #region StdString methods
@@ -14448,7 +17250,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern IntPtr StdString_GetValue(
                 [In] StdString.Ptr pString,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
@@ -14487,7 +17290,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern IntPtr StdStringArray_GetElement(
                 [In] StdStringArray.Ptr pArray,
                 [In] int index,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
@@ -14750,6 +17554,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern void V8Value_SetHostObject(
                 [In] V8Value.Ptr pV8Value,
                 [In] IntPtr pObject,
+                [In] int identity,
+                [In] int typeId,
                 [In] V8Value.Subtype subtype,
                 [In] V8Value.Flags flags
             );
@@ -14875,6 +17681,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Isolate_GetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Isolate_SetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Isolate_AwaitDebuggerAndPause(
                 [In] V8Isolate.Handle hIsolate
@@ -14979,6 +17796,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -15063,6 +17882,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Context_GetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_SetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_InvokeWithLock(
                 [In] V8Context.Handle hContext,
@@ -15090,6 +17920,53 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] [MarshalAs(UnmanagedType.I1)] bool globalMembers
             );
 
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateArray(
+                [In] V8Context.Handle hContext,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pArray
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateObject(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pObject
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_Deserialize(
+                [In] V8Context.Handle hContext,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJson(
+                [In] V8Context.Handle hContext,
+                [In] StdString.Ptr pJson,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJsonUtf8(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pJson,
+                [In] int length,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateFastFunction(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pFunction,
+                [In] V8FastFunctionCallType returnType,
+                [In] StdInt32Array.Ptr pArgTypes,
+                [In] V8Value.Ptr pV8Function
+            );
+
             [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_AwaitDebuggerAndPause(
                 [In] V8Context.Handle hContext
@@ -15173,6 +18050,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Value.Ptr pResult
             );
 
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ExecuteBatch(
+                [In] V8Context.Handle hContext,
+                [In] StdInt32Array.Ptr pCommands,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdV8ValueArray.Ptr pResults,
+                [In] StdStringArray.Ptr pErrors
+            );
+
             [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_Interrupt(
                 [In] V8Context.Handle hContext
@@ -15225,6 +18112,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -15234,7 +18123,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext,
                 [Out] out ulong scriptCount,
                 [Out] out ulong moduleCount,
-                [Out] out ulong moduleCacheSize
+                [Out] out ulong moduleCacheSize,
+                [Out] out ulong propertyNameCacheHitCount,
+                [Out] out ulong propertyNameCacheMissCount,
+                [Out] out ulong objectIdentityCacheHitCount,
+                [Out] out ulong objectIdentityCacheMissCount,
+                [Out] out ulong fastFunctionCallCount
             );
 
             [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
@@ -15248,6 +18142,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext
             );
 
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_OnEnumerationSettingsChanged(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_InvalidateHostMemberCache(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames
+            );
+
             [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
             [return: MarshalAs(UnmanagedType.I1)]
             private static extern bool V8Context_BeginCpuProfile(
@@ -15325,6 +18230,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdStringArray.Ptr pNames
             );
 
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_GetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_SetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
             [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_GetIndexedProperty(
                 [In] V8Object.Handle hObject,
@@ -15352,6 +18271,26 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdInt32Array.Ptr pIndices
             );
 
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern V8Object.ArrayExportKind V8Object_ExportArray(
+                [In] V8Object.Handle hObject,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdByteArray.Ptr pPackedValues
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_Serialize(
+                [In] V8Object.Handle hObject,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_ToJson(
+                [In] V8Object.Handle hObject,
+                [In] StdString.Ptr pJson
+            );
+
             [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_Invoke(
                 [In] V8Object.Handle hObject,
@@ -15450,6 +18389,42 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_Reset();
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_GetSnapshot(
+                [In] StdStringArray.Ptr pNames,
+                [In] StdInt32Array.Ptr pKinds,
+                [In] StdUInt64Array.Ptr pBucketCounts
+            );
+
+            #endregion
+
+            #region trace recorder
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_Clear();
+
+            [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_WriteJson(
+                [In] IntPtr pStream
+            );
+
+            #endregion
+
             #region unit test support
 
             [DllImport("ClearScriptV8.osx-x64.dylib", CallingConvention = CallingConvention.StdCall)]
@@ -15515,6 +18490,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 Memory_Free(pMemory);
             }
 
+            IntPtr IV8SplitProxyNative.Memory_AllocateTransient(UIntPtr size)
+            {
+                return Memory_AllocateTransient(size);
+            }
+
             #endregion
 
             #region StdString methods
@@ -15526,20 +18506,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdString_GetValue(StdString.Ptr pString)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue>(StdString.Ptr pString, Func<IntPtr, int, TValue> factory)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory) : factory(pValue, length);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue, TArg>(StdString.Ptr pString, Func<IntPtr, int, TArg, TValue> factory, in TArg arg)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length, arg);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory, arg) : factory(pValue, length, arg);
             }
 
             void IV8SplitProxyNative.StdString_SetValue(StdString.Ptr pString, string value)
@@ -15573,8 +18553,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdStringArray_GetElement(StdStringArray.Ptr pArray, int index)
             {
-                var pValue = StdStringArray_GetElement(pArray, index, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdStringArray_GetElement(pArray, index, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             void IV8SplitProxyNative.StdStringArray_SetElement(StdStringArray.Ptr pArray, int index, string value)
@@ -15815,9 +18795,9 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Value_SetV8Object(pV8Value, hObject, subtype, flags);
             }
 
-            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, V8Value.Subtype subtype, V8Value.Flags flags)
+            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, int identity, int typeId, V8Value.Subtype subtype, V8Value.Flags flags)
             {
-                V8Value_SetHostObject(pV8Value, pObject, subtype, flags);
+                V8Value_SetHostObject(pV8Value, pObject, identity, typeId, subtype, flags);
             }
 
             void IV8SplitProxyNative.V8Value_Decode(V8Value.Ptr pV8Value, out V8Value.Decoded decoded)
@@ -15935,6 +18915,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_SetMaxStackUsage(hIsolate, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Isolate_GetMaxStringCacheSize(V8Isolate.Handle hIsolate)
+            {
+                return V8Isolate_GetMaxStringCacheSize(hIsolate);
+            }
+
+            void IV8SplitProxyNative.V8Isolate_SetMaxStringCacheSize(V8Isolate.Handle hIsolate, UIntPtr size)
+            {
+                V8Isolate_SetMaxStringCacheSize(hIsolate, size);
+            }
+
             void IV8SplitProxyNative.V8Isolate_AwaitDebuggerAndPause(V8Isolate.Handle hIsolate)
             {
                 V8Isolate_AwaitDebuggerAndPause(hIsolate);
@@ -16043,13 +19033,13 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_GetHeapStatistics(hIsolate, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
@@ -16131,6 +19121,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_SetMaxIsolateStackUsage(hContext, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Context_GetMaxIsolateStringCacheSize(V8Context.Handle hContext)
+            {
+                return V8Context_GetMaxIsolateStringCacheSize(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_SetMaxIsolateStringCacheSize(V8Context.Handle hContext, UIntPtr size)
+            {
+                V8Context_SetMaxIsolateStringCacheSize(hContext, size);
+            }
+
             void IV8SplitProxyNative.V8Context_InvokeWithLock(V8Context.Handle hContext, IntPtr pAction)
             {
                 V8Context_InvokeWithLock(hContext, pAction);
@@ -16161,6 +19161,81 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object IV8SplitProxyNative.V8Context_CreateArray(V8Context.Handle hContext, object[] values)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                {
+                    using (var arrayScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateArray(hContext, valuesScope.Value, arrayScope.Value);
+                        return V8Value.Get(arrayScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateObject(V8Context.Handle hContext, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        using (var objScope = V8Value.CreateScope())
+                        {
+                            V8Context_CreateObject(hContext, namesScope.Value, valuesScope.Value, objScope.Value);
+                            return V8Value.Get(objScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_Deserialize(V8Context.Handle hContext, byte[] data, object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope(data))
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope(sharedObjects))
+                    {
+                        using (var valueScope = V8Value.CreateScope())
+                        {
+                            V8Context_Deserialize(hContext, dataScope.Value, sharedObjectsScope.Value, valueScope.Value);
+                            return V8Value.Get(valueScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJson(V8Context.Handle hContext, string json)
+            {
+                using (var jsonScope = StdString.CreateScope(json))
+                {
+                    using (var valueScope = V8Value.CreateScope())
+                    {
+                        V8Context_ParseJson(hContext, jsonScope.Value, valueScope.Value);
+                        return V8Value.Get(valueScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJsonUtf8(V8Context.Handle hContext, IntPtr pJson, int length)
+            {
+                using (var valueScope = V8Value.CreateScope())
+                {
+                    V8Context_ParseJsonUtf8(hContext, pJson, length, valueScope.Value);
+                    return V8Value.Get(valueScope.Value);
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateFastFunction(V8Context.Handle hContext, IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes)
+            {
+                using (var argTypesScope = StdInt32Array.CreateScope(argTypes))
+                {
+                    using (var functionScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateFastFunction(hContext, pFunction, returnType, argTypesScope.Value, functionScope.Value);
+                        return V8Value.Get(functionScope.Value);
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_AwaitDebuggerAndPause(V8Context.Handle hContext)
             {
                 V8Context_AwaitDebuggerAndPause(hContext);
@@ -16271,6 +19346,28 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            void IV8SplitProxyNative.V8Context_ExecuteBatch(V8Context.Handle hContext, int[] commands, string[] names, object[] values, out object[] results, out string[] errors)
+            {
+                using (var commandsScope = StdInt32Array.CreateScope(commands))
+                {
+                    using (var namesScope = StdStringArray.CreateScope(names))
+                    {
+                        using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                        {
+                            using (var resultsScope = StdV8ValueArray.CreateScope())
+                            {
+                                using (var errorsScope = StdStringArray.CreateScope())
+                                {
+                                    V8Context_ExecuteBatch(hContext, commandsScope.Value, namesScope.Value, valuesScope.Value, resultsScope.Value, errorsScope.Value);
+                                    results = StdV8ValueArray.ToArray(resultsScope.Value);
+                                    errors = StdStringArray.ToArray(errorsScope.Value);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_Interrupt(V8Context.Handle hContext)
             {
                 V8Context_Interrupt(hContext);
@@ -16306,22 +19403,22 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_GetIsolateHeapStatistics(hContext, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
                 }
             }
 
-            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize)
+            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize, out ulong propertyNameCacheHitCount, out ulong propertyNameCacheMissCount, out ulong objectIdentityCacheHitCount, out ulong objectIdentityCacheMissCount, out ulong fastFunctionCallCount)
             {
-                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize);
+                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize, out propertyNameCacheHitCount, out propertyNameCacheMissCount, out objectIdentityCacheHitCount, out objectIdentityCacheMissCount, out fastFunctionCallCount);
             }
 
             void IV8SplitProxyNative.V8Context_CollectGarbage(V8Context.Handle hContext, bool exhaustive)
@@ -16334,6 +19431,19 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_OnAccessSettingsChanged(hContext);
             }
 
+            void IV8SplitProxyNative.V8Context_OnEnumerationSettingsChanged(V8Context.Handle hContext)
+            {
+                V8Context_OnEnumerationSettingsChanged(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_InvalidateHostMemberCache(V8Context.Handle hContext, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    V8Context_InvalidateHostMemberCache(hContext, namesScope.Value);
+                }
+            }
+
             bool IV8SplitProxyNative.V8Context_BeginCpuProfile(V8Context.Handle hContext, string name, bool recordSamples)
             {
                 using (var nameScope = StdString.CreateScope(name))
@@ -16432,6 +19542,29 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_GetNamedProperties(V8Object.Handle hObject, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_GetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                        return StdV8ValueArray.ToArray(valuesScope.Value);
+                    }
+                }
+            }
+
+            void IV8SplitProxyNative.V8Object_SetNamedProperties(V8Object.Handle hObject, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        V8Object_SetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                    }
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_GetIndexedProperty(V8Object.Handle hObject, int index)
             {
                 using (var valueScope = V8Value.CreateScope())
@@ -16463,6 +19596,45 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_ExportArray(V8Object.Handle hObject)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope())
+                {
+                    using (var packedValuesScope = StdByteArray.CreateScope())
+                    {
+                        var kind = V8Object_ExportArray(hObject, valuesScope.Value, packedValuesScope.Value);
+                        if (kind == V8Object.ArrayExportKind.Unsupported)
+                        {
+                            return null;
+                        }
+
+                        return (kind == V8Object.ArrayExportKind.Values) ? StdV8ValueArray.ToArray(valuesScope.Value) : V8Object.GetPackedArray(kind, packedValuesScope.Value);
+                    }
+                }
+            }
+
+            byte[] IV8SplitProxyNative.V8Object_Serialize(V8Object.Handle hObject, out object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope())
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_Serialize(hObject, dataScope.Value, sharedObjectsScope.Value);
+                        sharedObjects = StdV8ValueArray.ToArray(sharedObjectsScope.Value);
+                        return StdByteArray.ToArray(dataScope.Value);
+                    }
+                }
+            }
+
+            string IV8SplitProxyNative.V8Object_ToJson(V8Object.Handle hObject)
+            {
+                using (var jsonScope = StdString.CreateScope())
+                {
+                    V8Object_ToJson(hObject, jsonScope.Value);
+                    return StdString.GetValue(jsonScope.Value);
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_Invoke(V8Object.Handle hObject, bool asConstructor, object[] args)
             {
                 using (var argsScope = StdV8ValueArray.CreateScope(args))
@@ -16576,6 +19748,56 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_SetEnabled(bool enabled)
+            {
+                V8SplitProxyStatistics_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_Reset()
+            {
+                V8SplitProxyStatistics_Reset();
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_GetSnapshot(out string[] names, out int[] kinds, out ulong[] bucketCounts)
+            {
+                using (var namesScope = StdStringArray.CreateScope())
+                {
+                    using (var kindsScope = StdInt32Array.CreateScope())
+                    {
+                        using (var bucketCountsScope = StdUInt64Array.CreateScope())
+                        {
+                            V8SplitProxyStatistics_GetSnapshot(namesScope.Value, kindsScope.Value, bucketCountsScope.Value);
+                            names = StdStringArray.ToArray(namesScope.Value);
+                            kinds = StdInt32Array.ToArray(kindsScope.Value);
+                            bucketCounts = StdUInt64Array.ToArray(bucketCountsScope.Value);
+                        }
+                    }
+                }
+            }
+
+            #endregion
+
+            #region trace recorder
+
+            void IV8SplitProxyNative.V8TraceRecorder_SetEnabled(bool enabled)
+            {
+                V8TraceRecorder_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_Clear()
+            {
+                V8TraceRecorder_Clear();
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_WriteJson(IntPtr pStream)
+            {
+                V8TraceRecorder_WriteJson(pStream);
+            }
+
+            #endregion
+
             #region unit test support
 
             UIntPtr IV8SplitProxyNative.V8UnitTestSupport_GetTextDigest(string value)
@@ -16632,6 +19854,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] IntPtr pMemory
             );
 
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern IntPtr Memory_AllocateTransient(
+                [In] UIntPtr size
+            );
+
             #endregion
 
             #region StdString methods
@@ -16645,7 +19872,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern IntPtr StdString_GetValue(
                 [In] StdString.Ptr pString,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
@@ -16684,7 +19912,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern IntPtr StdStringArray_GetElement(
                 [In] StdStringArray.Ptr pArray,
                 [In] int index,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
@@ -16947,6 +20176,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern void V8Value_SetHostObject(
                 [In] V8Value.Ptr pV8Value,
                 [In] IntPtr pObject,
+                [In] int identity,
+                [In] int typeId,
                 [In] V8Value.Subtype subtype,
                 [In] V8Value.Flags flags
             );
@@ -17072,6 +20303,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Isolate_GetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Isolate_SetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Isolate_AwaitDebuggerAndPause(
                 [In] V8Isolate.Handle hIsolate
@@ -17176,6 +20418,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -17260,6 +20504,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Context_GetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_SetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_InvokeWithLock(
                 [In] V8Context.Handle hContext,
@@ -17287,6 +20542,53 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] [MarshalAs(UnmanagedType.I1)] bool globalMembers
             );
 
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateArray(
+                [In] V8Context.Handle hContext,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pArray
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateObject(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pObject
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_Deserialize(
+                [In] V8Context.Handle hContext,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJson(
+                [In] V8Context.Handle hContext,
+                [In] StdString.Ptr pJson,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJsonUtf8(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pJson,
+                [In] int length,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateFastFunction(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pFunction,
+                [In] V8FastFunctionCallType returnType,
+                [In] StdInt32Array.Ptr pArgTypes,
+                [In] V8Value.Ptr pV8Function
+            );
+
             [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_AwaitDebuggerAndPause(
                 [In] V8Context.Handle hContext
@@ -17370,6 +20672,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Value.Ptr pResult
             );
 
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ExecuteBatch(
+                [In] V8Context.Handle hContext,
+                [In] StdInt32Array.Ptr pCommands,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdV8ValueArray.Ptr pResults,
+                [In] StdStringArray.Ptr pErrors
+            );
+
             [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_Interrupt(
                 [In] V8Context.Handle hContext
@@ -17422,6 +20734,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -17431,7 +20745,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext,
                 [Out] out ulong scriptCount,
                 [Out] out ulong moduleCount,
-                [Out] out ulong moduleCacheSize
+                [Out] out ulong moduleCacheSize,
+                [Out] out ulong propertyNameCacheHitCount,
+                [Out] out ulong propertyNameCacheMissCount,
+                [Out] out ulong objectIdentityCacheHitCount,
+                [Out] out ulong objectIdentityCacheMissCount,
+                [Out] out ulong fastFunctionCallCount
             );
 
             [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
@@ -17445,6 +20764,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext
             );
 
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_OnEnumerationSettingsChanged(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_InvalidateHostMemberCache(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames
+            );
+
             [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
             [return: MarshalAs(UnmanagedType.I1)]
             private static extern bool V8Context_BeginCpuProfile(
@@ -17522,6 +20852,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdStringArray.Ptr pNames
             );
 
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_GetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_SetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
             [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_GetIndexedProperty(
                 [In] V8Object.Handle hObject,
@@ -17549,6 +20893,26 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdInt32Array.Ptr pIndices
             );
 
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern V8Object.ArrayExportKind V8Object_ExportArray(
+                [In] V8Object.Handle hObject,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdByteArray.Ptr pPackedValues
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_Serialize(
+                [In] V8Object.Handle hObject,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_ToJson(
+                [In] V8Object.Handle hObject,
+                [In] StdString.Ptr pJson
+            );
+
             [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_Invoke(
                 [In] V8Object.Handle hObject,
@@ -17647,6 +21011,42 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_Reset();
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_GetSnapshot(
+                [In] StdStringArray.Ptr pNames,
+                [In] StdInt32Array.Ptr pKinds,
+                [In] StdUInt64Array.Ptr pBucketCounts
+            );
+
+            #endregion
+
+            #region trace recorder
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_Clear();
+
+            [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_WriteJson(
+                [In] IntPtr pStream
+            );
+
+            #endregion
+
             #region unit test support
 
             [DllImport("ClearScriptV8.osx-arm64.dylib", CallingConvention = CallingConvention.StdCall)]
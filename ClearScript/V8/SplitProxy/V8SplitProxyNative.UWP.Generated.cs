@@ -92,6 +92,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 Memory_Free(pMemory);
             }
 
+            IntPtr IV8SplitProxyNative.Memory_AllocateTransient(UIntPtr size)
+            {
+                return Memory_AllocateTransient(size);
+            }
+
             #endregion
 
             #region StdString methods
@@ -103,20 +108,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdString_GetValue(StdString.Ptr pString)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue>(StdString.Ptr pString, Func<IntPtr, int, TValue> factory)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory) : factory(pValue, length);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue, TArg>(StdString.Ptr pString, Func<IntPtr, int, TArg, TValue> factory, in TArg arg)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length, arg);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory, arg) : factory(pValue, length, arg);
             }
 
             void IV8SplitProxyNative.StdString_SetValue(StdString.Ptr pString, string value)
@@ -150,8 +155,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdStringArray_GetElement(StdStringArray.Ptr pArray, int index)
             {
-                var pValue = StdStringArray_GetElement(pArray, index, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdStringArray_GetElement(pArray, index, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             void IV8SplitProxyNative.StdStringArray_SetElement(StdStringArray.Ptr pArray, int index, string value)
@@ -392,9 +397,9 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Value_SetV8Object(pV8Value, hObject, subtype, flags);
             }
 
-            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, V8Value.Subtype subtype, V8Value.Flags flags)
+            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, int identity, int typeId, V8Value.Subtype subtype, V8Value.Flags flags)
             {
-                V8Value_SetHostObject(pV8Value, pObject, subtype, flags);
+                V8Value_SetHostObject(pV8Value, pObject, identity, typeId, subtype, flags);
             }
 
             void IV8SplitProxyNative.V8Value_Decode(V8Value.Ptr pV8Value, out V8Value.Decoded decoded)
@@ -512,6 +517,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_SetMaxStackUsage(hIsolate, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Isolate_GetMaxStringCacheSize(V8Isolate.Handle hIsolate)
+            {
+                return V8Isolate_GetMaxStringCacheSize(hIsolate);
+            }
+
+            void IV8SplitProxyNative.V8Isolate_SetMaxStringCacheSize(V8Isolate.Handle hIsolate, UIntPtr size)
+            {
+                V8Isolate_SetMaxStringCacheSize(hIsolate, size);
+            }
+
             void IV8SplitProxyNative.V8Isolate_AwaitDebuggerAndPause(V8Isolate.Handle hIsolate)
             {
                 V8Isolate_AwaitDebuggerAndPause(hIsolate);
@@ -620,13 +635,13 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_GetHeapStatistics(hIsolate, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
@@ -708,6 +723,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_SetMaxIsolateStackUsage(hContext, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Context_GetMaxIsolateStringCacheSize(V8Context.Handle hContext)
+            {
+                return V8Context_GetMaxIsolateStringCacheSize(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_SetMaxIsolateStringCacheSize(V8Context.Handle hContext, UIntPtr size)
+            {
+                V8Context_SetMaxIsolateStringCacheSize(hContext, size);
+            }
+
             void IV8SplitProxyNative.V8Context_InvokeWithLock(V8Context.Handle hContext, IntPtr pAction)
             {
                 V8Context_InvokeWithLock(hContext, pAction);
@@ -738,6 +763,81 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object IV8SplitProxyNative.V8Context_CreateArray(V8Context.Handle hContext, object[] values)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                {
+                    using (var arrayScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateArray(hContext, valuesScope.Value, arrayScope.Value);
+                        return V8Value.Get(arrayScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateObject(V8Context.Handle hContext, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        using (var objScope = V8Value.CreateScope())
+                        {
+                            V8Context_CreateObject(hContext, namesScope.Value, valuesScope.Value, objScope.Value);
+                            return V8Value.Get(objScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_Deserialize(V8Context.Handle hContext, byte[] data, object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope(data))
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope(sharedObjects))
+                    {
+                        using (var valueScope = V8Value.CreateScope())
+                        {
+                            V8Context_Deserialize(hContext, dataScope.Value, sharedObjectsScope.Value, valueScope.Value);
+                            return V8Value.Get(valueScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJson(V8Context.Handle hContext, string json)
+            {
+                using (var jsonScope = StdString.CreateScope(json))
+                {
+                    using (var valueScope = V8Value.CreateScope())
+                    {
+                        V8Context_ParseJson(hContext, jsonScope.Value, valueScope.Value);
+                        return V8Value.Get(valueScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJsonUtf8(V8Context.Handle hContext, IntPtr pJson, int length)
+            {
+                using (var valueScope = V8Value.CreateScope())
+                {
+                    V8Context_ParseJsonUtf8(hContext, pJson, length, valueScope.Value);
+                    return V8Value.Get(valueScope.Value);
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateFastFunction(V8Context.Handle hContext, IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes)
+            {
+                using (var argTypesScope = StdInt32Array.CreateScope(argTypes))
+                {
+                    using (var functionScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateFastFunction(hContext, pFunction, returnType, argTypesScope.Value, functionScope.Value);
+                        return V8Value.Get(functionScope.Value);
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_AwaitDebuggerAndPause(V8Context.Handle hContext)
             {
                 V8Context_AwaitDebuggerAndPause(hContext);
@@ -848,6 +948,28 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            void IV8SplitProxyNative.V8Context_ExecuteBatch(V8Context.Handle hContext, int[] commands, string[] names, object[] values, out object[] results, out string[] errors)
+            {
+                using (var commandsScope = StdInt32Array.CreateScope(commands))
+                {
+                    using (var namesScope = StdStringArray.CreateScope(names))
+                    {
+                        using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                        {
+                            using (var resultsScope = StdV8ValueArray.CreateScope())
+                            {
+                                using (var errorsScope = StdStringArray.CreateScope())
+                                {
+                                    V8Context_ExecuteBatch(hContext, commandsScope.Value, namesScope.Value, valuesScope.Value, resultsScope.Value, errorsScope.Value);
+                                    results = StdV8ValueArray.ToArray(resultsScope.Value);
+                                    errors = StdStringArray.ToArray(errorsScope.Value);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_Interrupt(V8Context.Handle hContext)
             {
                 V8Context_Interrupt(hContext);
@@ -883,22 +1005,22 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_GetIsolateHeapStatistics(hContext, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
                 }
             }
 
-            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize)
+            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize, out ulong propertyNameCacheHitCount, out ulong propertyNameCacheMissCount, out ulong objectIdentityCacheHitCount, out ulong objectIdentityCacheMissCount, out ulong fastFunctionCallCount)
             {
-                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize);
+                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize, out propertyNameCacheHitCount, out propertyNameCacheMissCount, out objectIdentityCacheHitCount, out objectIdentityCacheMissCount, out fastFunctionCallCount);
             }
 
             void IV8SplitProxyNative.V8Context_CollectGarbage(V8Context.Handle hContext, bool exhaustive)
@@ -911,6 +1033,19 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_OnAccessSettingsChanged(hContext);
             }
 
+            void IV8SplitProxyNative.V8Context_OnEnumerationSettingsChanged(V8Context.Handle hContext)
+            {
+                V8Context_OnEnumerationSettingsChanged(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_InvalidateHostMemberCache(V8Context.Handle hContext, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    V8Context_InvalidateHostMemberCache(hContext, namesScope.Value);
+                }
+            }
+
             bool IV8SplitProxyNative.V8Context_BeginCpuProfile(V8Context.Handle hContext, string name, bool recordSamples)
             {
                 using (var nameScope = StdString.CreateScope(name))
@@ -1009,6 +1144,29 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_GetNamedProperties(V8Object.Handle hObject, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_GetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                        return StdV8ValueArray.ToArray(valuesScope.Value);
+                    }
+                }
+            }
+
+            void IV8SplitProxyNative.V8Object_SetNamedProperties(V8Object.Handle hObject, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        V8Object_SetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                    }
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_GetIndexedProperty(V8Object.Handle hObject, int index)
             {
                 using (var valueScope = V8Value.CreateScope())
@@ -1040,6 +1198,45 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_ExportArray(V8Object.Handle hObject)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope())
+                {
+                    using (var packedValuesScope = StdByteArray.CreateScope())
+                    {
+                        var kind = V8Object_ExportArray(hObject, valuesScope.Value, packedValuesScope.Value);
+                        if (kind == V8Object.ArrayExportKind.Unsupported)
+                        {
+                            return null;
+                        }
+
+                        return (kind == V8Object.ArrayExportKind.Values) ? StdV8ValueArray.ToArray(valuesScope.Value) : V8Object.GetPackedArray(kind, packedValuesScope.Value);
+                    }
+                }
+            }
+
+            byte[] IV8SplitProxyNative.V8Object_Serialize(V8Object.Handle hObject, out object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope())
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_Serialize(hObject, dataScope.Value, sharedObjectsScope.Value);
+                        sharedObjects = StdV8ValueArray.ToArray(sharedObjectsScope.Value);
+                        return StdByteArray.ToArray(dataScope.Value);
+                    }
+                }
+            }
+
+            string IV8SplitProxyNative.V8Object_ToJson(V8Object.Handle hObject)
+            {
+                using (var jsonScope = StdString.CreateScope())
+                {
+                    V8Object_ToJson(hObject, jsonScope.Value);
+                    return StdString.GetValue(jsonScope.Value);
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_Invoke(V8Object.Handle hObject, bool asConstructor, object[] args)
             {
                 using (var argsScope = StdV8ValueArray.CreateScope(args))
@@ -1153,6 +1350,56 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_SetEnabled(bool enabled)
+            {
+                V8SplitProxyStatistics_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_Reset()
+            {
+                V8SplitProxyStatistics_Reset();
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_GetSnapshot(out string[] names, out int[] kinds, out ulong[] bucketCounts)
+            {
+                using (var namesScope = StdStringArray.CreateScope())
+                {
+                    using (var kindsScope = StdInt32Array.CreateScope())
+                    {
+                        using (var bucketCountsScope = StdUInt64Array.CreateScope())
+                        {
+                            V8SplitProxyStatistics_GetSnapshot(namesScope.Value, kindsScope.Value, bucketCountsScope.Value);
+                            names = StdStringArray.ToArray(namesScope.Value);
+                            kinds = StdInt32Array.ToArray(kindsScope.Value);
+                            bucketCounts = StdUInt64Array.ToArray(bucketCountsScope.Value);
+                        }
+                    }
+                }
+            }
+
+            #endregion
+
+            #region trace recorder
+
+            void IV8SplitProxyNative.V8TraceRecorder_SetEnabled(bool enabled)
+            {
+                V8TraceRecorder_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_Clear()
+            {
+                V8TraceRecorder_Clear();
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_WriteJson(IntPtr pStream)
+            {
+                V8TraceRecorder_WriteJson(pStream);
+            }
+
+            #endregion
+
             #region unit test support
 
             UIntPtr IV8SplitProxyNative.V8UnitTestSupport_GetTextDigest(string value)
@@ -1209,6 +1456,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] IntPtr pMemory
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern IntPtr Memory_AllocateTransient(
+                [In] UIntPtr size
+            );
+
             #endregion
 
             #region StdString methods
@@ -1222,7 +1474,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern IntPtr StdString_GetValue(
                 [In] StdString.Ptr pString,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
@@ -1261,7 +1514,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern IntPtr StdStringArray_GetElement(
                 [In] StdStringArray.Ptr pArray,
                 [In] int index,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
@@ -1524,6 +1778,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern void V8Value_SetHostObject(
                 [In] V8Value.Ptr pV8Value,
                 [In] IntPtr pObject,
+                [In] int identity,
+                [In] int typeId,
                 [In] V8Value.Subtype subtype,
                 [In] V8Value.Flags flags
             );
@@ -1649,6 +1905,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Isolate_GetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Isolate_SetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Isolate_AwaitDebuggerAndPause(
                 [In] V8Isolate.Handle hIsolate
@@ -1753,6 +2020,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -1837,6 +2106,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Context_GetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_SetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_InvokeWithLock(
                 [In] V8Context.Handle hContext,
@@ -1864,6 +2144,53 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] [MarshalAs(UnmanagedType.I1)] bool globalMembers
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateArray(
+                [In] V8Context.Handle hContext,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pArray
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateObject(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pObject
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_Deserialize(
+                [In] V8Context.Handle hContext,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJson(
+                [In] V8Context.Handle hContext,
+                [In] StdString.Ptr pJson,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJsonUtf8(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pJson,
+                [In] int length,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateFastFunction(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pFunction,
+                [In] V8FastFunctionCallType returnType,
+                [In] StdInt32Array.Ptr pArgTypes,
+                [In] V8Value.Ptr pV8Function
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_AwaitDebuggerAndPause(
                 [In] V8Context.Handle hContext
@@ -1947,6 +2274,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Value.Ptr pResult
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ExecuteBatch(
+                [In] V8Context.Handle hContext,
+                [In] StdInt32Array.Ptr pCommands,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdV8ValueArray.Ptr pResults,
+                [In] StdStringArray.Ptr pErrors
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_Interrupt(
                 [In] V8Context.Handle hContext
@@ -1999,6 +2336,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -2008,7 +2347,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext,
                 [Out] out ulong scriptCount,
                 [Out] out ulong moduleCount,
-                [Out] out ulong moduleCacheSize
+                [Out] out ulong moduleCacheSize,
+                [Out] out ulong propertyNameCacheHitCount,
+                [Out] out ulong propertyNameCacheMissCount,
+                [Out] out ulong objectIdentityCacheHitCount,
+                [Out] out ulong objectIdentityCacheMissCount,
+                [Out] out ulong fastFunctionCallCount
             );
 
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
@@ -2022,6 +2366,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_OnEnumerationSettingsChanged(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_InvalidateHostMemberCache(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             [return: MarshalAs(UnmanagedType.I1)]
             private static extern bool V8Context_BeginCpuProfile(
@@ -2099,6 +2454,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdStringArray.Ptr pNames
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_GetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_SetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_GetIndexedProperty(
                 [In] V8Object.Handle hObject,
@@ -2126,6 +2495,26 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdInt32Array.Ptr pIndices
             );
 
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern V8Object.ArrayExportKind V8Object_ExportArray(
+                [In] V8Object.Handle hObject,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdByteArray.Ptr pPackedValues
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_Serialize(
+                [In] V8Object.Handle hObject,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_ToJson(
+                [In] V8Object.Handle hObject,
+                [In] StdString.Ptr pJson
+            );
+
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_Invoke(
                 [In] V8Object.Handle hObject,
@@ -2224,6 +2613,42 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_Reset();
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_GetSnapshot(
+                [In] StdStringArray.Ptr pNames,
+                [In] StdInt32Array.Ptr pKinds,
+                [In] StdUInt64Array.Ptr pBucketCounts
+            );
+
+            #endregion
+
+            #region trace recorder
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_Clear();
+
+            [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_WriteJson(
+                [In] IntPtr pStream
+            );
+
+            #endregion
+
             #region unit test support
 
             [DllImport("ClearScriptV8.win-x86.dll", CallingConvention = CallingConvention.StdCall)]
@@ -2289,6 +2714,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 Memory_Free(pMemory);
             }
 
+            IntPtr IV8SplitProxyNative.Memory_AllocateTransient(UIntPtr size)
+            {
+                return Memory_AllocateTransient(size);
+            }
+
             #endregion
 
             #region StdString methods
@@ -2300,20 +2730,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdString_GetValue(StdString.Ptr pString)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue>(StdString.Ptr pString, Func<IntPtr, int, TValue> factory)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory) : factory(pValue, length);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue, TArg>(StdString.Ptr pString, Func<IntPtr, int, TArg, TValue> factory, in TArg arg)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length, arg);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory, arg) : factory(pValue, length, arg);
             }
 
             void IV8SplitProxyNative.StdString_SetValue(StdString.Ptr pString, string value)
@@ -2347,8 +2777,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdStringArray_GetElement(StdStringArray.Ptr pArray, int index)
             {
-                var pValue = StdStringArray_GetElement(pArray, index, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdStringArray_GetElement(pArray, index, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             void IV8SplitProxyNative.StdStringArray_SetElement(StdStringArray.Ptr pArray, int index, string value)
@@ -2589,9 +3019,9 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Value_SetV8Object(pV8Value, hObject, subtype, flags);
             }
 
-            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, V8Value.Subtype subtype, V8Value.Flags flags)
+            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, int identity, int typeId, V8Value.Subtype subtype, V8Value.Flags flags)
             {
-                V8Value_SetHostObject(pV8Value, pObject, subtype, flags);
+                V8Value_SetHostObject(pV8Value, pObject, identity, typeId, subtype, flags);
             }
 
             void IV8SplitProxyNative.V8Value_Decode(V8Value.Ptr pV8Value, out V8Value.Decoded decoded)
@@ -2709,6 +3139,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_SetMaxStackUsage(hIsolate, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Isolate_GetMaxStringCacheSize(V8Isolate.Handle hIsolate)
+            {
+                return V8Isolate_GetMaxStringCacheSize(hIsolate);
+            }
+
+            void IV8SplitProxyNative.V8Isolate_SetMaxStringCacheSize(V8Isolate.Handle hIsolate, UIntPtr size)
+            {
+                V8Isolate_SetMaxStringCacheSize(hIsolate, size);
+            }
+
             void IV8SplitProxyNative.V8Isolate_AwaitDebuggerAndPause(V8Isolate.Handle hIsolate)
             {
                 V8Isolate_AwaitDebuggerAndPause(hIsolate);
@@ -2817,13 +3257,13 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_GetHeapStatistics(hIsolate, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
@@ -2905,6 +3345,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_SetMaxIsolateStackUsage(hContext, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Context_GetMaxIsolateStringCacheSize(V8Context.Handle hContext)
+            {
+                return V8Context_GetMaxIsolateStringCacheSize(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_SetMaxIsolateStringCacheSize(V8Context.Handle hContext, UIntPtr size)
+            {
+                V8Context_SetMaxIsolateStringCacheSize(hContext, size);
+            }
+
             void IV8SplitProxyNative.V8Context_InvokeWithLock(V8Context.Handle hContext, IntPtr pAction)
             {
                 V8Context_InvokeWithLock(hContext, pAction);
@@ -2935,6 +3385,81 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object IV8SplitProxyNative.V8Context_CreateArray(V8Context.Handle hContext, object[] values)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                {
+                    using (var arrayScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateArray(hContext, valuesScope.Value, arrayScope.Value);
+                        return V8Value.Get(arrayScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateObject(V8Context.Handle hContext, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        using (var objScope = V8Value.CreateScope())
+                        {
+                            V8Context_CreateObject(hContext, namesScope.Value, valuesScope.Value, objScope.Value);
+                            return V8Value.Get(objScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_Deserialize(V8Context.Handle hContext, byte[] data, object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope(data))
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope(sharedObjects))
+                    {
+                        using (var valueScope = V8Value.CreateScope())
+                        {
+                            V8Context_Deserialize(hContext, dataScope.Value, sharedObjectsScope.Value, valueScope.Value);
+                            return V8Value.Get(valueScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJson(V8Context.Handle hContext, string json)
+            {
+                using (var jsonScope = StdString.CreateScope(json))
+                {
+                    using (var valueScope = V8Value.CreateScope())
+                    {
+                        V8Context_ParseJson(hContext, jsonScope.Value, valueScope.Value);
+                        return V8Value.Get(valueScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJsonUtf8(V8Context.Handle hContext, IntPtr pJson, int length)
+            {
+                using (var valueScope = V8Value.CreateScope())
+                {
+                    V8Context_ParseJsonUtf8(hContext, pJson, length, valueScope.Value);
+                    return V8Value.Get(valueScope.Value);
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateFastFunction(V8Context.Handle hContext, IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes)
+            {
+                using (var argTypesScope = StdInt32Array.CreateScope(argTypes))
+                {
+                    using (var functionScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateFastFunction(hContext, pFunction, returnType, argTypesScope.Value, functionScope.Value);
+                        return V8Value.Get(functionScope.Value);
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_AwaitDebuggerAndPause(V8Context.Handle hContext)
             {
                 V8Context_AwaitDebuggerAndPause(hContext);
@@ -3045,6 +3570,28 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            void IV8SplitProxyNative.V8Context_ExecuteBatch(V8Context.Handle hContext, int[] commands, string[] names, object[] values, out object[] results, out string[] errors)
+            {
+                using (var commandsScope = StdInt32Array.CreateScope(commands))
+                {
+                    using (var namesScope = StdStringArray.CreateScope(names))
+                    {
+                        using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                        {
+                            using (var resultsScope = StdV8ValueArray.CreateScope())
+                            {
+                                using (var errorsScope = StdStringArray.CreateScope())
+                                {
+                                    V8Context_ExecuteBatch(hContext, commandsScope.Value, namesScope.Value, valuesScope.Value, resultsScope.Value, errorsScope.Value);
+                                    results = StdV8ValueArray.ToArray(resultsScope.Value);
+                                    errors = StdStringArray.ToArray(errorsScope.Value);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_Interrupt(V8Context.Handle hContext)
             {
                 V8Context_Interrupt(hContext);
@@ -3080,22 +3627,22 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_GetIsolateHeapStatistics(hContext, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
                 }
             }
 
-            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize)
+            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize, out ulong propertyNameCacheHitCount, out ulong propertyNameCacheMissCount, out ulong objectIdentityCacheHitCount, out ulong objectIdentityCacheMissCount, out ulong fastFunctionCallCount)
             {
-                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize);
+                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize, out propertyNameCacheHitCount, out propertyNameCacheMissCount, out objectIdentityCacheHitCount, out objectIdentityCacheMissCount, out fastFunctionCallCount);
             }
 
             void IV8SplitProxyNative.V8Context_CollectGarbage(V8Context.Handle hContext, bool exhaustive)
@@ -3108,6 +3655,19 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_OnAccessSettingsChanged(hContext);
             }
 
+            void IV8SplitProxyNative.V8Context_OnEnumerationSettingsChanged(V8Context.Handle hContext)
+            {
+                V8Context_OnEnumerationSettingsChanged(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_InvalidateHostMemberCache(V8Context.Handle hContext, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    V8Context_InvalidateHostMemberCache(hContext, namesScope.Value);
+                }
+            }
+
             bool IV8SplitProxyNative.V8Context_BeginCpuProfile(V8Context.Handle hContext, string name, bool recordSamples)
             {
                 using (var nameScope = StdString.CreateScope(name))
@@ -3206,6 +3766,29 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_GetNamedProperties(V8Object.Handle hObject, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_GetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                        return StdV8ValueArray.ToArray(valuesScope.Value);
+                    }
+                }
+            }
+
+            void IV8SplitProxyNative.V8Object_SetNamedProperties(V8Object.Handle hObject, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        V8Object_SetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                    }
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_GetIndexedProperty(V8Object.Handle hObject, int index)
             {
                 using (var valueScope = V8Value.CreateScope())
@@ -3237,6 +3820,45 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_ExportArray(V8Object.Handle hObject)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope())
+                {
+                    using (var packedValuesScope = StdByteArray.CreateScope())
+                    {
+                        var kind = V8Object_ExportArray(hObject, valuesScope.Value, packedValuesScope.Value);
+                        if (kind == V8Object.ArrayExportKind.Unsupported)
+                        {
+                            return null;
+                        }
+
+                        return (kind == V8Object.ArrayExportKind.Values) ? StdV8ValueArray.ToArray(valuesScope.Value) : V8Object.GetPackedArray(kind, packedValuesScope.Value);
+                    }
+                }
+            }
+
+            byte[] IV8SplitProxyNative.V8Object_Serialize(V8Object.Handle hObject, out object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope())
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_Serialize(hObject, dataScope.Value, sharedObjectsScope.Value);
+                        sharedObjects = StdV8ValueArray.ToArray(sharedObjectsScope.Value);
+                        return StdByteArray.ToArray(dataScope.Value);
+                    }
+                }
+            }
+
+            string IV8SplitProxyNative.V8Object_ToJson(V8Object.Handle hObject)
+            {
+                using (var jsonScope = StdString.CreateScope())
+                {
+                    V8Object_ToJson(hObject, jsonScope.Value);
+                    return StdString.GetValue(jsonScope.Value);
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_Invoke(V8Object.Handle hObject, bool asConstructor, object[] args)
             {
                 using (var argsScope = StdV8ValueArray.CreateScope(args))
@@ -3350,6 +3972,56 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_SetEnabled(bool enabled)
+            {
+                V8SplitProxyStatistics_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_Reset()
+            {
+                V8SplitProxyStatistics_Reset();
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_GetSnapshot(out string[] names, out int[] kinds, out ulong[] bucketCounts)
+            {
+                using (var namesScope = StdStringArray.CreateScope())
+                {
+                    using (var kindsScope = StdInt32Array.CreateScope())
+                    {
+                        using (var bucketCountsScope = StdUInt64Array.CreateScope())
+                        {
+                            V8SplitProxyStatistics_GetSnapshot(namesScope.Value, kindsScope.Value, bucketCountsScope.Value);
+                            names = StdStringArray.ToArray(namesScope.Value);
+                            kinds = StdInt32Array.ToArray(kindsScope.Value);
+                            bucketCounts = StdUInt64Array.ToArray(bucketCountsScope.Value);
+                        }
+                    }
+                }
+            }
+
+            #endregion
+
+            #region trace recorder
+
+            void IV8SplitProxyNative.V8TraceRecorder_SetEnabled(bool enabled)
+            {
+                V8TraceRecorder_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_Clear()
+            {
+                V8TraceRecorder_Clear();
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_WriteJson(IntPtr pStream)
+            {
+                V8TraceRecorder_WriteJson(pStream);
+            }
+
+            #endregion
+
             #region unit test support
 
             UIntPtr IV8SplitProxyNative.V8UnitTestSupport_GetTextDigest(string value)
@@ -3406,6 +4078,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] IntPtr pMemory
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern IntPtr Memory_AllocateTransient(
+                [In] UIntPtr size
+            );
+
             #endregion
 
             #region StdString methods
@@ -3419,7 +4096,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern IntPtr StdString_GetValue(
                 [In] StdString.Ptr pString,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -3458,7 +4136,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern IntPtr StdStringArray_GetElement(
                 [In] StdStringArray.Ptr pArray,
                 [In] int index,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -3721,6 +4400,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern void V8Value_SetHostObject(
                 [In] V8Value.Ptr pV8Value,
                 [In] IntPtr pObject,
+                [In] int identity,
+                [In] int typeId,
                 [In] V8Value.Subtype subtype,
                 [In] V8Value.Flags flags
             );
@@ -3846,6 +4527,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Isolate_GetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Isolate_SetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Isolate_AwaitDebuggerAndPause(
                 [In] V8Isolate.Handle hIsolate
@@ -3950,6 +4642,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -4034,6 +4728,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Context_GetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_SetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_InvokeWithLock(
                 [In] V8Context.Handle hContext,
@@ -4061,6 +4766,53 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] [MarshalAs(UnmanagedType.I1)] bool globalMembers
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateArray(
+                [In] V8Context.Handle hContext,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pArray
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateObject(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pObject
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_Deserialize(
+                [In] V8Context.Handle hContext,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJson(
+                [In] V8Context.Handle hContext,
+                [In] StdString.Ptr pJson,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJsonUtf8(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pJson,
+                [In] int length,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateFastFunction(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pFunction,
+                [In] V8FastFunctionCallType returnType,
+                [In] StdInt32Array.Ptr pArgTypes,
+                [In] V8Value.Ptr pV8Function
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_AwaitDebuggerAndPause(
                 [In] V8Context.Handle hContext
@@ -4144,6 +4896,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Value.Ptr pResult
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ExecuteBatch(
+                [In] V8Context.Handle hContext,
+                [In] StdInt32Array.Ptr pCommands,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdV8ValueArray.Ptr pResults,
+                [In] StdStringArray.Ptr pErrors
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_Interrupt(
                 [In] V8Context.Handle hContext
@@ -4196,6 +4958,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -4205,7 +4969,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext,
                 [Out] out ulong scriptCount,
                 [Out] out ulong moduleCount,
-                [Out] out ulong moduleCacheSize
+                [Out] out ulong moduleCacheSize,
+                [Out] out ulong propertyNameCacheHitCount,
+                [Out] out ulong propertyNameCacheMissCount,
+                [Out] out ulong objectIdentityCacheHitCount,
+                [Out] out ulong objectIdentityCacheMissCount,
+                [Out] out ulong fastFunctionCallCount
             );
 
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -4219,6 +4988,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_OnEnumerationSettingsChanged(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_InvalidateHostMemberCache(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             [return: MarshalAs(UnmanagedType.I1)]
             private static extern bool V8Context_BeginCpuProfile(
@@ -4296,6 +5076,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdStringArray.Ptr pNames
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_GetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_SetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_GetIndexedProperty(
                 [In] V8Object.Handle hObject,
@@ -4323,6 +5117,26 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdInt32Array.Ptr pIndices
             );
 
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern V8Object.ArrayExportKind V8Object_ExportArray(
+                [In] V8Object.Handle hObject,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdByteArray.Ptr pPackedValues
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_Serialize(
+                [In] V8Object.Handle hObject,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_ToJson(
+                [In] V8Object.Handle hObject,
+                [In] StdString.Ptr pJson
+            );
+
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_Invoke(
                 [In] V8Object.Handle hObject,
@@ -4421,6 +5235,42 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_Reset();
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_GetSnapshot(
+                [In] StdStringArray.Ptr pNames,
+                [In] StdInt32Array.Ptr pKinds,
+                [In] StdUInt64Array.Ptr pBucketCounts
+            );
+
+            #endregion
+
+            #region trace recorder
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_Clear();
+
+            [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_WriteJson(
+                [In] IntPtr pStream
+            );
+
+            #endregion
+
             #region unit test support
 
             [DllImport("ClearScriptV8.win-x64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -4486,6 +5336,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 Memory_Free(pMemory);
             }
 
+            IntPtr IV8SplitProxyNative.Memory_AllocateTransient(UIntPtr size)
+            {
+                return Memory_AllocateTransient(size);
+            }
+
             #endregion
 
             #region StdString methods
@@ -4497,20 +5352,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdString_GetValue(StdString.Ptr pString)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue>(StdString.Ptr pString, Func<IntPtr, int, TValue> factory)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory) : factory(pValue, length);
             }
 
             TValue IV8SplitProxyNative.StdString_GetValue<TValue, TArg>(StdString.Ptr pString, Func<IntPtr, int, TArg, TValue> factory, in TArg arg)
             {
-                var pValue = StdString_GetValue(pString, out var length);
-                return factory(pValue, length, arg);
+                var pValue = StdString_GetValue(pString, out var length, out var isOneByte);
+                return isOneByte ? StdString.GetValue(pValue, length, factory, arg) : factory(pValue, length, arg);
             }
 
             void IV8SplitProxyNative.StdString_SetValue(StdString.Ptr pString, string value)
@@ -4544,8 +5399,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             string IV8SplitProxyNative.StdStringArray_GetElement(StdStringArray.Ptr pArray, int index)
             {
-                var pValue = StdStringArray_GetElement(pArray, index, out var length);
-                return Marshal.PtrToStringUni(pValue, length);
+                var pValue = StdStringArray_GetElement(pArray, index, out var length, out var isOneByte);
+                return StdString.GetValue(pValue, length, isOneByte);
             }
 
             void IV8SplitProxyNative.StdStringArray_SetElement(StdStringArray.Ptr pArray, int index, string value)
@@ -4786,9 +5641,9 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Value_SetV8Object(pV8Value, hObject, subtype, flags);
             }
 
-            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, V8Value.Subtype subtype, V8Value.Flags flags)
+            void IV8SplitProxyNative.V8Value_SetHostObject(V8Value.Ptr pV8Value, IntPtr pObject, int identity, int typeId, V8Value.Subtype subtype, V8Value.Flags flags)
             {
-                V8Value_SetHostObject(pV8Value, pObject, subtype, flags);
+                V8Value_SetHostObject(pV8Value, pObject, identity, typeId, subtype, flags);
             }
 
             void IV8SplitProxyNative.V8Value_Decode(V8Value.Ptr pV8Value, out V8Value.Decoded decoded)
@@ -4906,6 +5761,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_SetMaxStackUsage(hIsolate, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Isolate_GetMaxStringCacheSize(V8Isolate.Handle hIsolate)
+            {
+                return V8Isolate_GetMaxStringCacheSize(hIsolate);
+            }
+
+            void IV8SplitProxyNative.V8Isolate_SetMaxStringCacheSize(V8Isolate.Handle hIsolate, UIntPtr size)
+            {
+                V8Isolate_SetMaxStringCacheSize(hIsolate, size);
+            }
+
             void IV8SplitProxyNative.V8Isolate_AwaitDebuggerAndPause(V8Isolate.Handle hIsolate)
             {
                 V8Isolate_AwaitDebuggerAndPause(hIsolate);
@@ -5014,13 +5879,13 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Isolate_GetHeapStatistics(hIsolate, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Isolate_GetStatistics(V8Isolate.Handle hIsolate, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Isolate_GetStatistics(hIsolate, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
@@ -5102,6 +5967,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_SetMaxIsolateStackUsage(hContext, size);
             }
 
+            UIntPtr IV8SplitProxyNative.V8Context_GetMaxIsolateStringCacheSize(V8Context.Handle hContext)
+            {
+                return V8Context_GetMaxIsolateStringCacheSize(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_SetMaxIsolateStringCacheSize(V8Context.Handle hContext, UIntPtr size)
+            {
+                V8Context_SetMaxIsolateStringCacheSize(hContext, size);
+            }
+
             void IV8SplitProxyNative.V8Context_InvokeWithLock(V8Context.Handle hContext, IntPtr pAction)
             {
                 V8Context_InvokeWithLock(hContext, pAction);
@@ -5132,6 +6007,81 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object IV8SplitProxyNative.V8Context_CreateArray(V8Context.Handle hContext, object[] values)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                {
+                    using (var arrayScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateArray(hContext, valuesScope.Value, arrayScope.Value);
+                        return V8Value.Get(arrayScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateObject(V8Context.Handle hContext, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        using (var objScope = V8Value.CreateScope())
+                        {
+                            V8Context_CreateObject(hContext, namesScope.Value, valuesScope.Value, objScope.Value);
+                            return V8Value.Get(objScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_Deserialize(V8Context.Handle hContext, byte[] data, object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope(data))
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope(sharedObjects))
+                    {
+                        using (var valueScope = V8Value.CreateScope())
+                        {
+                            V8Context_Deserialize(hContext, dataScope.Value, sharedObjectsScope.Value, valueScope.Value);
+                            return V8Value.Get(valueScope.Value);
+                        }
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJson(V8Context.Handle hContext, string json)
+            {
+                using (var jsonScope = StdString.CreateScope(json))
+                {
+                    using (var valueScope = V8Value.CreateScope())
+                    {
+                        V8Context_ParseJson(hContext, jsonScope.Value, valueScope.Value);
+                        return V8Value.Get(valueScope.Value);
+                    }
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_ParseJsonUtf8(V8Context.Handle hContext, IntPtr pJson, int length)
+            {
+                using (var valueScope = V8Value.CreateScope())
+                {
+                    V8Context_ParseJsonUtf8(hContext, pJson, length, valueScope.Value);
+                    return V8Value.Get(valueScope.Value);
+                }
+            }
+
+            object IV8SplitProxyNative.V8Context_CreateFastFunction(V8Context.Handle hContext, IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes)
+            {
+                using (var argTypesScope = StdInt32Array.CreateScope(argTypes))
+                {
+                    using (var functionScope = V8Value.CreateScope())
+                    {
+                        V8Context_CreateFastFunction(hContext, pFunction, returnType, argTypesScope.Value, functionScope.Value);
+                        return V8Value.Get(functionScope.Value);
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_AwaitDebuggerAndPause(V8Context.Handle hContext)
             {
                 V8Context_AwaitDebuggerAndPause(hContext);
@@ -5242,6 +6192,28 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            void IV8SplitProxyNative.V8Context_ExecuteBatch(V8Context.Handle hContext, int[] commands, string[] names, object[] values, out object[] results, out string[] errors)
+            {
+                using (var commandsScope = StdInt32Array.CreateScope(commands))
+                {
+                    using (var namesScope = StdStringArray.CreateScope(names))
+                    {
+                        using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                        {
+                            using (var resultsScope = StdV8ValueArray.CreateScope())
+                            {
+                                using (var errorsScope = StdStringArray.CreateScope())
+                                {
+                                    V8Context_ExecuteBatch(hContext, commandsScope.Value, namesScope.Value, valuesScope.Value, resultsScope.Value, errorsScope.Value);
+                                    results = StdV8ValueArray.ToArray(resultsScope.Value);
+                                    errors = StdStringArray.ToArray(errorsScope.Value);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             void IV8SplitProxyNative.V8Context_Interrupt(V8Context.Handle hContext)
             {
                 V8Context_Interrupt(hContext);
@@ -5277,22 +6249,22 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_GetIsolateHeapStatistics(hContext, out totalHeapSize, out totalHeapSizeExecutable, out totalPhysicalSize, out totalAvailableSize, out usedHeapSize, out heapSizeLimit, out totalExternalSize);
             }
 
-            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
+            void IV8SplitProxyNative.V8Context_GetIsolateStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong scriptCacheSize, out ulong moduleCount, out ulong stringCacheHitCount, out ulong stringCacheMissCount, out ulong[] postedTaskCounts, out ulong[] invokedTaskCounts)
             {
                 using (var postedTaskCountsScope = StdUInt64Array.CreateScope())
                 {
                     using (var invokedTaskCountsScope = StdUInt64Array.CreateScope())
                     {
-                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
+                        V8Context_GetIsolateStatistics(hContext, out scriptCount, out scriptCacheSize, out moduleCount, out stringCacheHitCount, out stringCacheMissCount, postedTaskCountsScope.Value, invokedTaskCountsScope.Value);
                         postedTaskCounts = StdUInt64Array.ToArray(postedTaskCountsScope.Value);
                         invokedTaskCounts = StdUInt64Array.ToArray(invokedTaskCountsScope.Value);
                     }
                 }
             }
 
-            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize)
+            void IV8SplitProxyNative.V8Context_GetStatistics(V8Context.Handle hContext, out ulong scriptCount, out ulong moduleCount, out ulong moduleCacheSize, out ulong propertyNameCacheHitCount, out ulong propertyNameCacheMissCount, out ulong objectIdentityCacheHitCount, out ulong objectIdentityCacheMissCount, out ulong fastFunctionCallCount)
             {
-                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize);
+                V8Context_GetStatistics(hContext, out scriptCount, out moduleCount, out moduleCacheSize, out propertyNameCacheHitCount, out propertyNameCacheMissCount, out objectIdentityCacheHitCount, out objectIdentityCacheMissCount, out fastFunctionCallCount);
             }
 
             void IV8SplitProxyNative.V8Context_CollectGarbage(V8Context.Handle hContext, bool exhaustive)
@@ -5305,6 +6277,19 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 V8Context_OnAccessSettingsChanged(hContext);
             }
 
+            void IV8SplitProxyNative.V8Context_OnEnumerationSettingsChanged(V8Context.Handle hContext)
+            {
+                V8Context_OnEnumerationSettingsChanged(hContext);
+            }
+
+            void IV8SplitProxyNative.V8Context_InvalidateHostMemberCache(V8Context.Handle hContext, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    V8Context_InvalidateHostMemberCache(hContext, namesScope.Value);
+                }
+            }
+
             bool IV8SplitProxyNative.V8Context_BeginCpuProfile(V8Context.Handle hContext, string name, bool recordSamples)
             {
                 using (var nameScope = StdString.CreateScope(name))
@@ -5403,6 +6388,29 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_GetNamedProperties(V8Object.Handle hObject, string[] names)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_GetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                        return StdV8ValueArray.ToArray(valuesScope.Value);
+                    }
+                }
+            }
+
+            void IV8SplitProxyNative.V8Object_SetNamedProperties(V8Object.Handle hObject, string[] names, object[] values)
+            {
+                using (var namesScope = StdStringArray.CreateScope(names))
+                {
+                    using (var valuesScope = StdV8ValueArray.CreateScope(values))
+                    {
+                        V8Object_SetNamedProperties(hObject, namesScope.Value, valuesScope.Value);
+                    }
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_GetIndexedProperty(V8Object.Handle hObject, int index)
             {
                 using (var valueScope = V8Value.CreateScope())
@@ -5434,6 +6442,45 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 }
             }
 
+            object[] IV8SplitProxyNative.V8Object_ExportArray(V8Object.Handle hObject)
+            {
+                using (var valuesScope = StdV8ValueArray.CreateScope())
+                {
+                    using (var packedValuesScope = StdByteArray.CreateScope())
+                    {
+                        var kind = V8Object_ExportArray(hObject, valuesScope.Value, packedValuesScope.Value);
+                        if (kind == V8Object.ArrayExportKind.Unsupported)
+                        {
+                            return null;
+                        }
+
+                        return (kind == V8Object.ArrayExportKind.Values) ? StdV8ValueArray.ToArray(valuesScope.Value) : V8Object.GetPackedArray(kind, packedValuesScope.Value);
+                    }
+                }
+            }
+
+            byte[] IV8SplitProxyNative.V8Object_Serialize(V8Object.Handle hObject, out object[] sharedObjects)
+            {
+                using (var dataScope = StdByteArray.CreateScope())
+                {
+                    using (var sharedObjectsScope = StdV8ValueArray.CreateScope())
+                    {
+                        V8Object_Serialize(hObject, dataScope.Value, sharedObjectsScope.Value);
+                        sharedObjects = StdV8ValueArray.ToArray(sharedObjectsScope.Value);
+                        return StdByteArray.ToArray(dataScope.Value);
+                    }
+                }
+            }
+
+            string IV8SplitProxyNative.V8Object_ToJson(V8Object.Handle hObject)
+            {
+                using (var jsonScope = StdString.CreateScope())
+                {
+                    V8Object_ToJson(hObject, jsonScope.Value);
+                    return StdString.GetValue(jsonScope.Value);
+                }
+            }
+
             object IV8SplitProxyNative.V8Object_Invoke(V8Object.Handle hObject, bool asConstructor, object[] args)
             {
                 using (var argsScope = StdV8ValueArray.CreateScope(args))
@@ -5547,6 +6594,56 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_SetEnabled(bool enabled)
+            {
+                V8SplitProxyStatistics_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_Reset()
+            {
+                V8SplitProxyStatistics_Reset();
+            }
+
+            void IV8SplitProxyNative.V8SplitProxyStatistics_GetSnapshot(out string[] names, out int[] kinds, out ulong[] bucketCounts)
+            {
+                using (var namesScope = StdStringArray.CreateScope())
+                {
+                    using (var kindsScope = StdInt32Array.CreateScope())
+                    {
+                        using (var bucketCountsScope = StdUInt64Array.CreateScope())
+                        {
+                            V8SplitProxyStatistics_GetSnapshot(namesScope.Value, kindsScope.Value, bucketCountsScope.Value);
+                            names = StdStringArray.ToArray(namesScope.Value);
+                            kinds = StdInt32Array.ToArray(kindsScope.Value);
+                            bucketCounts = StdUInt64Array.ToArray(bucketCountsScope.Value);
+                        }
+                    }
+                }
+            }
+
+            #endregion
+
+            #region trace recorder
+
+            void IV8SplitProxyNative.V8TraceRecorder_SetEnabled(bool enabled)
+            {
+                V8TraceRecorder_SetEnabled(enabled);
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_Clear()
+            {
+                V8TraceRecorder_Clear();
+            }
+
+            void IV8SplitProxyNative.V8TraceRecorder_WriteJson(IntPtr pStream)
+            {
+                V8TraceRecorder_WriteJson(pStream);
+            }
+
+            #endregion
+
             #region unit test support
 
             UIntPtr IV8SplitProxyNative.V8UnitTestSupport_GetTextDigest(string value)
@@ -5603,6 +6700,11 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] IntPtr pMemory
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern IntPtr Memory_AllocateTransient(
+                [In] UIntPtr size
+            );
+
             #endregion
 
             #region StdString methods
@@ -5616,7 +6718,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern IntPtr StdString_GetValue(
                 [In] StdString.Ptr pString,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -5655,7 +6758,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern IntPtr StdStringArray_GetElement(
                 [In] StdStringArray.Ptr pArray,
                 [In] int index,
-                [Out] out int length
+                [Out] out int length,
+                [Out] [MarshalAs(UnmanagedType.I1)] out bool isOneByte
             );
 
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -5918,6 +7022,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
             private static extern void V8Value_SetHostObject(
                 [In] V8Value.Ptr pV8Value,
                 [In] IntPtr pObject,
+                [In] int identity,
+                [In] int typeId,
                 [In] V8Value.Subtype subtype,
                 [In] V8Value.Flags flags
             );
@@ -6043,6 +7149,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Isolate_GetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Isolate_SetMaxStringCacheSize(
+                [In] V8Isolate.Handle hIsolate,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Isolate_AwaitDebuggerAndPause(
                 [In] V8Isolate.Handle hIsolate
@@ -6147,6 +7264,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -6231,6 +7350,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] UIntPtr size
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern UIntPtr V8Context_GetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_SetMaxIsolateStringCacheSize(
+                [In] V8Context.Handle hContext,
+                [In] UIntPtr size
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_InvokeWithLock(
                 [In] V8Context.Handle hContext,
@@ -6258,6 +7388,53 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] [MarshalAs(UnmanagedType.I1)] bool globalMembers
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateArray(
+                [In] V8Context.Handle hContext,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pArray
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateObject(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] V8Value.Ptr pObject
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_Deserialize(
+                [In] V8Context.Handle hContext,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJson(
+                [In] V8Context.Handle hContext,
+                [In] StdString.Ptr pJson,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ParseJsonUtf8(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pJson,
+                [In] int length,
+                [In] V8Value.Ptr pValue
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_CreateFastFunction(
+                [In] V8Context.Handle hContext,
+                [In] IntPtr pFunction,
+                [In] V8FastFunctionCallType returnType,
+                [In] StdInt32Array.Ptr pArgTypes,
+                [In] V8Value.Ptr pV8Function
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_AwaitDebuggerAndPause(
                 [In] V8Context.Handle hContext
@@ -6341,6 +7518,16 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Value.Ptr pResult
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_ExecuteBatch(
+                [In] V8Context.Handle hContext,
+                [In] StdInt32Array.Ptr pCommands,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdV8ValueArray.Ptr pResults,
+                [In] StdStringArray.Ptr pErrors
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Context_Interrupt(
                 [In] V8Context.Handle hContext
@@ -6393,6 +7580,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [Out] out ulong scriptCount,
                 [Out] out ulong scriptCacheSize,
                 [Out] out ulong moduleCount,
+                [Out] out ulong stringCacheHitCount,
+                [Out] out ulong stringCacheMissCount,
                 [In] StdUInt64Array.Ptr pPostedTaskCounts,
                 [In] StdUInt64Array.Ptr pInvokedTaskCounts
             );
@@ -6402,7 +7591,12 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext,
                 [Out] out ulong scriptCount,
                 [Out] out ulong moduleCount,
-                [Out] out ulong moduleCacheSize
+                [Out] out ulong moduleCacheSize,
+                [Out] out ulong propertyNameCacheHitCount,
+                [Out] out ulong propertyNameCacheMissCount,
+                [Out] out ulong objectIdentityCacheHitCount,
+                [Out] out ulong objectIdentityCacheMissCount,
+                [Out] out ulong fastFunctionCallCount
             );
 
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -6416,6 +7610,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] V8Context.Handle hContext
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_OnEnumerationSettingsChanged(
+                [In] V8Context.Handle hContext
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Context_InvalidateHostMemberCache(
+                [In] V8Context.Handle hContext,
+                [In] StdStringArray.Ptr pNames
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             [return: MarshalAs(UnmanagedType.I1)]
             private static extern bool V8Context_BeginCpuProfile(
@@ -6493,6 +7698,20 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdStringArray.Ptr pNames
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_GetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_SetNamedProperties(
+                [In] V8Object.Handle hObject,
+                [In] StdStringArray.Ptr pNames,
+                [In] StdV8ValueArray.Ptr pValues
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_GetIndexedProperty(
                 [In] V8Object.Handle hObject,
@@ -6520,6 +7739,26 @@ namespace Microsoft.ClearScript.V8.SplitProxy
                 [In] StdInt32Array.Ptr pIndices
             );
 
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern V8Object.ArrayExportKind V8Object_ExportArray(
+                [In] V8Object.Handle hObject,
+                [In] StdV8ValueArray.Ptr pValues,
+                [In] StdByteArray.Ptr pPackedValues
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_Serialize(
+                [In] V8Object.Handle hObject,
+                [In] StdByteArray.Ptr pData,
+                [In] StdV8ValueArray.Ptr pSharedObjects
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8Object_ToJson(
+                [In] V8Object.Handle hObject,
+                [In] StdString.Ptr pJson
+            );
+
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
             private static extern void V8Object_Invoke(
                 [In] V8Object.Handle hObject,
@@ -6618,6 +7857,42 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
             #endregion
 
+            #region split proxy statistics
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_Reset();
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8SplitProxyStatistics_GetSnapshot(
+                [In] StdStringArray.Ptr pNames,
+                [In] StdInt32Array.Ptr pKinds,
+                [In] StdUInt64Array.Ptr pBucketCounts
+            );
+
+            #endregion
+
+            #region trace recorder
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_SetEnabled(
+                [In] [MarshalAs(UnmanagedType.I1)] bool enabled
+            );
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_Clear();
+
+            [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
+            private static extern void V8TraceRecorder_WriteJson(
+                [In] IntPtr pStream
+            );
+
+            #endregion
+
             #region unit test support
 
             [DllImport("ClearScriptV8.win-arm64.dll", CallingConvention = CallingConvention.StdCall)]
@@ -24,6 +24,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
         public static void Invoke(Action<IV8SplitProxyNative> action)
         {
+            VerifyNotInFastHostFunctionCall();
+
             var previousScheduledException = MiscHelpers.Exchange(ref V8SplitProxyManaged.ScheduledException, null);
             try
             {
@@ -38,6 +40,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
         public static void Invoke<TArg>(Action<IV8SplitProxyNative, TArg> action, in TArg arg)
         {
+            VerifyNotInFastHostFunctionCall();
+
             var previousScheduledException = MiscHelpers.Exchange(ref V8SplitProxyManaged.ScheduledException, null);
             try
             {
@@ -52,6 +56,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
         public static TResult Invoke<TResult>(Func<IV8SplitProxyNative, TResult> func)
         {
+            VerifyNotInFastHostFunctionCall();
+
             var previousScheduledException = MiscHelpers.Exchange(ref V8SplitProxyManaged.ScheduledException, null);
             try
             {
@@ -67,6 +73,8 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
         public static TResult Invoke<TResult, TArg>(Func<IV8SplitProxyNative, TArg, TResult> func, in TArg arg)
         {
+            VerifyNotInFastHostFunctionCall();
+
             var previousScheduledException = MiscHelpers.Exchange(ref V8SplitProxyManaged.ScheduledException, null);
             try
             {
@@ -152,6 +160,17 @@ namespace Microsoft.ClearScript.V8.SplitProxy
 
         public static TResult InvokeRaw<TResult, TArg>(Func<IV8SplitProxyNative, TArg, TResult> func, in TArg arg) => func(instance, arg);
 
+        private static void VerifyNotInFastHostFunctionCall()
+        {
+            // V8 prohibits reentry during a fast API call; reject the call before it reaches the
+            // isolate rather than failing within an entry point that cannot report the error
+
+            if (V8SplitProxyManaged.InFastHostFunctionCall)
+            {
+                throw new InvalidOperationException("The V8 runtime cannot be accessed from within a fast function callback");
+            }
+        }
+
         private static void ThrowScheduledException()
         {
             if (V8SplitProxyManaged.ScheduledException is not null)
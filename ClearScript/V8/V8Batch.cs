@@ -0,0 +1,189 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+using System.Collections.Generic;
+using Microsoft.ClearScript.Util;
+
+namespace Microsoft.ClearScript.V8
+{
+    /// <summary>
+    /// Represents a sequence of script object operations that can be executed with a single call
+    /// into the V8 runtime.
+    /// </summary>
+    /// <remarks>
+    /// Executing a batch incurs the cost of entering the V8 runtime, acquiring its lock, and
+    /// setting up an execution scope only once for all its operations. Operations are executed
+    /// in the order in which they were added. A failed operation does not prevent subsequent
+    /// operations from executing; instead, its failure is reported via its result. Script
+    /// interruption aborts the entire batch.
+    /// </remarks>
+    /// <seealso cref="V8ScriptEngine.ExecuteBatch"/>
+    public sealed class V8Batch
+    {
+        private readonly List<int> commands = new List<int>();
+        private readonly List<string> names = new List<string>();
+        private readonly List<object> values = new List<object>();
+        private readonly List<V8ScriptItem> targets = new List<V8ScriptItem>();
+
+        /// <summary>
+        /// Gets the number of operations in the batch.
+        /// </summary>
+        public int Count => names.Count;
+
+        /// <summary>
+        /// Adds an operation that gets the value of a script object property.
+        /// </summary>
+        /// <param name="target">The script object whose property to get.</param>
+        /// <param name="name">The name of the property to get.</param>
+        /// <remarks>
+        /// The operation's result value is the property value.
+        /// </remarks>
+        public void GetProperty(ScriptObject target, string name)
+        {
+            Add(CommandKind.GetProperty, target, name, ArrayHelpers.GetEmptyArray<object>());
+        }
+
+        /// <summary>
+        /// Adds an operation that sets the value of a script object property.
+        /// </summary>
+        /// <param name="target">The script object whose property to set.</param>
+        /// <param name="name">The name of the property to set.</param>
+        /// <param name="value">The new property value.</param>
+        /// <remarks>
+        /// The operation's result value is <c>undefined</c>.
+        /// </remarks>
+        public void SetProperty(ScriptObject target, string name, object value)
+        {
+            Add(CommandKind.SetProperty, target, name, new[] { value });
+        }
+
+        /// <summary>
+        /// Adds an operation that deletes a script object property.
+        /// </summary>
+        /// <param name="target">The script object whose property to delete.</param>
+        /// <param name="name">The name of the property to delete.</param>
+        /// <remarks>
+        /// The operation's result value is <c>true</c> if the property was deleted,
+        /// <c>false</c> otherwise.
+        /// </remarks>
+        public void DeleteProperty(ScriptObject target, string name)
+        {
+            Add(CommandKind.DeleteProperty, target, name, ArrayHelpers.GetEmptyArray<object>());
+        }
+
+        /// <summary>
+        /// Adds an operation that invokes a script object method.
+        /// </summary>
+        /// <param name="target">The script object whose method to invoke.</param>
+        /// <param name="name">The name of the method to invoke.</param>
+        /// <param name="args">Optional arguments for method invocation.</param>
+        /// <remarks>
+        /// The operation's result value is the method's return value.
+        /// </remarks>
+        public void InvokeMethod(ScriptObject target, string name, params object[] args)
+        {
+            Add(CommandKind.InvokeMethod, target, name, args ?? ArrayHelpers.GetEmptyArray<object>());
+        }
+
+        /// <summary>
+        /// Adds an operation that invokes a script object as a function.
+        /// </summary>
+        /// <param name="target">The script object to invoke.</param>
+        /// <param name="args">Optional arguments for invocation.</param>
+        /// <remarks>
+        /// The operation's result value is the function's return value.
+        /// </remarks>
+        public void Invoke(ScriptObject target, params object[] args)
+        {
+            Add(CommandKind.Invoke, target, string.Empty, args ?? ArrayHelpers.GetEmptyArray<object>());
+        }
+
+        /// <summary>
+        /// Removes all operations from the batch.
+        /// </summary>
+        public void Clear()
+        {
+            commands.Clear();
+            names.Clear();
+            values.Clear();
+            targets.Clear();
+        }
+
+        internal int[] Commands => commands.ToArray();
+
+        internal string[] Names => names.ToArray();
+
+        internal object[] Values => values.ToArray();
+
+        internal IEnumerable<V8ScriptItem> Targets => targets;
+
+        private void Add(CommandKind kind, ScriptObject target, string name, object[] operands)
+        {
+            MiscHelpers.VerifyNonNullArgument(target, nameof(target));
+            MiscHelpers.VerifyNonNullArgument(name, nameof(name));
+
+            if (target is not V8ScriptItem scriptItem)
+            {
+                throw new ArgumentException("The target must be a V8 script object", nameof(target));
+            }
+
+            commands.Add((int)kind);
+            commands.Add(operands.Length);
+            names.Add(name);
+            values.Add(scriptItem);
+            values.AddRange(operands);
+            targets.Add(scriptItem);
+        }
+
+        #region Nested type: CommandKind
+
+        private enum CommandKind
+        {
+            // IMPORTANT: maintain equivalence with native enum V8Context::BatchCommand
+            GetProperty,
+            SetProperty,
+            DeleteProperty,
+            InvokeMethod,
+            Invoke
+        }
+
+        #endregion
+
+        #region Nested type: Result
+
+        /// <summary>
+        /// Represents the result of a batch operation.
+        /// </summary>
+        public sealed class Result
+        {
+            internal Result(object value, string errorMessage)
+            {
+                Value = value;
+                ErrorMessage = errorMessage;
+            }
+
+            /// <summary>
+            /// Determines whether the operation succeeded.
+            /// </summary>
+            public bool Succeeded => ErrorMessage is null;
+
+            /// <summary>
+            /// Gets the operation's result value.
+            /// </summary>
+            /// <remarks>
+            /// If the operation failed, this property gets the script exception that caused the
+            /// failure, or <c>null</c> if none is available.
+            /// </remarks>
+            public object Value { get; }
+
+            /// <summary>
+            /// Gets the error message for a failed operation, or <c>null</c> if the operation
+            /// succeeded.
+            /// </summary>
+            public string ErrorMessage { get; }
+        }
+
+        #endregion
+    }
+}
@@ -20,6 +20,8 @@ namespace Microsoft.ClearScript.V8
 
         public abstract UIntPtr MaxIsolateStackUsage { get; set; }
 
+        public abstract UIntPtr MaxIsolateStringCacheSize { get; set; }
+
         public abstract void InvokeWithLock(Action action);
 
         public abstract void InvokeWithLock<TArg>(Action<TArg> action, in TArg arg);
@@ -28,6 +30,18 @@ namespace Microsoft.ClearScript.V8
 
         public abstract void AddGlobalItem(string name, object item, bool globalMembers);
 
+        public abstract object CreateArray(object[] values);
+
+        public abstract object CreateObject(string[] names, object[] values);
+
+        public abstract object Deserialize(byte[] data, object[] sharedObjects);
+
+        public abstract object ParseJson(string json);
+
+        public abstract object ParseJson(byte[] utf8Json);
+
+        public abstract object CreateFastFunction(IntPtr pFunction, V8FastFunctionCallType returnType, int[] argTypes);
+
         public abstract void AwaitDebuggerAndPause();
 
         public abstract void CancelAwaitDebugger();
@@ -44,6 +58,8 @@ namespace Microsoft.ClearScript.V8
 
         public abstract object Execute(V8Script script, bool evaluate);
 
+        public abstract void ExecuteBatch(int[] commands, string[] names, object[] values, out object[] results, out string[] errors);
+
         public abstract void Interrupt();
 
         public abstract void CancelInterrupt();
@@ -62,6 +78,10 @@ namespace Microsoft.ClearScript.V8
 
         public abstract void OnAccessSettingsChanged();
 
+        public abstract void OnEnumerationSettingsChanged();
+
+        public abstract void InvalidateHostMemberCache(string[] names);
+
         public abstract bool BeginCpuProfile(string name, V8CpuProfileFlags flags);
 
         public abstract V8CpuProfile EndCpuProfile(string name);
@@ -0,0 +1,272 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+using Microsoft.ClearScript.Util;
+using Microsoft.ClearScript.V8.SplitProxy;
+
+namespace Microsoft.ClearScript.V8
+{
+    internal enum V8FastFunctionCallType
+    {
+        // IMPORTANT: maintain bitwise equivalence with native enum FastHostObjectUtil::CallType
+        Void,
+        Boolean,
+        Int32,
+        Double,
+        String
+    }
+
+    internal abstract class V8FastFunction
+    {
+        protected V8FastFunction(Type returnType, params Type[] argTypes)
+        {
+            ReturnType = GetReturnType(returnType);
+            ArgTypes = Array.ConvertAll(argTypes, static argType => (int)GetArgType(argType));
+        }
+
+        public V8FastFunctionCallType ReturnType { get; }
+
+        public int[] ArgTypes { get; }
+
+        public abstract void Invoke(int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult);
+
+        public static V8FastFunction Create(Action action) => new FastAction(action);
+        public static V8FastFunction Create<T1>(Action<T1> action) => new FastAction<T1>(action);
+        public static V8FastFunction Create<T1, T2>(Action<T1, T2> action) => new FastAction<T1, T2>(action);
+        public static V8FastFunction Create<T1, T2, T3>(Action<T1, T2, T3> action) => new FastAction<T1, T2, T3>(action);
+
+        public static V8FastFunction Create<TResult>(Func<TResult> function) => new FastFunction<TResult>(function);
+        public static V8FastFunction Create<T1, TResult>(Func<T1, TResult> function) => new FastFunction<T1, TResult>(function);
+        public static V8FastFunction Create<T1, T2, TResult>(Func<T1, T2, TResult> function) => new FastFunction<T1, T2, TResult>(function);
+        public static V8FastFunction Create<T1, T2, T3, TResult>(Func<T1, T2, T3, TResult> function) => new FastFunction<T1, T2, T3, TResult>(function);
+
+        protected static T GetArg<T>(in V8FastFunctionCallValue value)
+        {
+            if (typeof(T) == typeof(bool))
+            {
+                return (T)(object)(value.Int32Value != 0);
+            }
+
+            if (typeof(T) == typeof(int))
+            {
+                return (T)(object)value.Int32Value;
+            }
+
+            if (typeof(T) == typeof(double))
+            {
+                return (T)(object)value.DoubleValue;
+            }
+
+            return (T)(object)value.GetString();
+        }
+
+        protected static void SetResult<T>(ref V8FastFunctionCallValue result, T value)
+        {
+            if (typeof(T) == typeof(bool))
+            {
+                result.Int32Value = (bool)(object)value ? 1 : 0;
+            }
+            else if (typeof(T) == typeof(int))
+            {
+                result.Int32Value = (int)(object)value;
+            }
+            else if (typeof(T) == typeof(double))
+            {
+                result.DoubleValue = (double)(object)value;
+            }
+        }
+
+        private static V8FastFunctionCallType GetReturnType(Type type)
+        {
+            if (type == typeof(void))
+            {
+                return V8FastFunctionCallType.Void;
+            }
+
+            if (type == typeof(bool))
+            {
+                return V8FastFunctionCallType.Boolean;
+            }
+
+            if (type == typeof(int))
+            {
+                return V8FastFunctionCallType.Int32;
+            }
+
+            if (type == typeof(double))
+            {
+                return V8FastFunctionCallType.Double;
+            }
+
+            throw new ArgumentException(MiscHelpers.FormatInvariant("Type '{0}' is not a supported fast function return type", type.GetFriendlyName()));
+        }
+
+        private static V8FastFunctionCallType GetArgType(Type type)
+        {
+            if (type == typeof(bool))
+            {
+                return V8FastFunctionCallType.Boolean;
+            }
+
+            if (type == typeof(int))
+            {
+                return V8FastFunctionCallType.Int32;
+            }
+
+            if (type == typeof(double))
+            {
+                return V8FastFunctionCallType.Double;
+            }
+
+            if (type == typeof(string))
+            {
+                return V8FastFunctionCallType.String;
+            }
+
+            throw new ArgumentException(MiscHelpers.FormatInvariant("Type '{0}' is not a supported fast function argument type", type.GetFriendlyName()));
+        }
+
+        #region Nested type: FastAction
+
+        private sealed class FastAction : V8FastFunction
+        {
+            private readonly Action action;
+
+            public FastAction(Action action)
+                : base(typeof(void))
+            {
+                this.action = action;
+            }
+
+            public override void Invoke(int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult)
+            {
+                action();
+            }
+        }
+
+        private sealed class FastAction<T1> : V8FastFunction
+        {
+            private readonly Action<T1> action;
+
+            public FastAction(Action<T1> action)
+                : base(typeof(void), typeof(T1))
+            {
+                this.action = action;
+            }
+
+            public override void Invoke(int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult)
+            {
+                var args = pArgs.ToSpan(argCount);
+                action(GetArg<T1>(args[0]));
+            }
+        }
+
+        private sealed class FastAction<T1, T2> : V8FastFunction
+        {
+            private readonly Action<T1, T2> action;
+
+            public FastAction(Action<T1, T2> action)
+                : base(typeof(void), typeof(T1), typeof(T2))
+            {
+                this.action = action;
+            }
+
+            public override void Invoke(int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult)
+            {
+                var args = pArgs.ToSpan(argCount);
+                action(GetArg<T1>(args[0]), GetArg<T2>(args[1]));
+            }
+        }
+
+        private sealed class FastAction<T1, T2, T3> : V8FastFunction
+        {
+            private readonly Action<T1, T2, T3> action;
+
+            public FastAction(Action<T1, T2, T3> action)
+                : base(typeof(void), typeof(T1), typeof(T2), typeof(T3))
+            {
+                this.action = action;
+            }
+
+            public override void Invoke(int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult)
+            {
+                var args = pArgs.ToSpan(argCount);
+                action(GetArg<T1>(args[0]), GetArg<T2>(args[1]), GetArg<T3>(args[2]));
+            }
+        }
+
+        #endregion
+
+        #region Nested type: FastFunction
+
+        private sealed class FastFunction<TResult> : V8FastFunction
+        {
+            private readonly Func<TResult> function;
+
+            public FastFunction(Func<TResult> function)
+                : base(typeof(TResult))
+            {
+                this.function = function;
+            }
+
+            public override void Invoke(int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult)
+            {
+                SetResult(ref pResult.AsRef(), function());
+            }
+        }
+
+        private sealed class FastFunction<T1, TResult> : V8FastFunction
+        {
+            private readonly Func<T1, TResult> function;
+
+            public FastFunction(Func<T1, TResult> function)
+                : base(typeof(TResult), typeof(T1))
+            {
+                this.function = function;
+            }
+
+            public override void Invoke(int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult)
+            {
+                var args = pArgs.ToSpan(argCount);
+                SetResult(ref pResult.AsRef(), function(GetArg<T1>(args[0])));
+            }
+        }
+
+        private sealed class FastFunction<T1, T2, TResult> : V8FastFunction
+        {
+            private readonly Func<T1, T2, TResult> function;
+
+            public FastFunction(Func<T1, T2, TResult> function)
+                : base(typeof(TResult), typeof(T1), typeof(T2))
+            {
+                this.function = function;
+            }
+
+            public override void Invoke(int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult)
+            {
+                var args = pArgs.ToSpan(argCount);
+                SetResult(ref pResult.AsRef(), function(GetArg<T1>(args[0]), GetArg<T2>(args[1])));
+            }
+        }
+
+        private sealed class FastFunction<T1, T2, T3, TResult> : V8FastFunction
+        {
+            private readonly Func<T1, T2, T3, TResult> function;
+
+            public FastFunction(Func<T1, T2, T3, TResult> function)
+                : base(typeof(TResult), typeof(T1), typeof(T2), typeof(T3))
+            {
+                this.function = function;
+            }
+
+            public override void Invoke(int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult)
+            {
+                var args = pArgs.ToSpan(argCount);
+                SetResult(ref pResult.AsRef(), function(GetArg<T1>(args[0]), GetArg<T2>(args[1]), GetArg<T3>(args[2])));
+            }
+        }
+
+        #endregion
+    }
+}
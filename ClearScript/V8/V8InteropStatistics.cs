@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using Microsoft.ClearScript.V8.SplitProxy;
+
+namespace Microsoft.ClearScript.V8
+{
+    /// <summary>
+    /// Contains call counts and latency histograms for transitions between managed code and the
+    /// native V8 library.
+    /// </summary>
+    /// <remarks>
+    /// Interop statistics are process-wide and are not recorded by default. When recording is
+    /// disabled, its overhead is limited to a single branch per transition.
+    /// </remarks>
+    public class V8InteropStatistics
+    {
+        internal V8InteropStatistics()
+        {
+        }
+
+        /// <summary>
+        /// Enables or disables interop statistics recording.
+        /// </summary>
+        public static bool Enabled
+        {
+            get => enabled;
+
+            set
+            {
+                V8SplitProxyNative.InvokeNoThrow(static (instance, value) => instance.V8SplitProxyStatistics_SetEnabled(value), value);
+                enabled = value;
+            }
+        }
+
+        /// <summary>
+        /// Captures the interop statistics recorded so far.
+        /// </summary>
+        /// <returns>A snapshot of the interop statistics recorded so far.</returns>
+        public static V8InteropStatistics Capture()
+        {
+            var snapshot = V8SplitProxyNative.InvokeNoThrow(
+                static instance =>
+                {
+                    instance.V8SplitProxyStatistics_GetSnapshot(out var names, out var kinds, out var bucketCounts);
+                    return (names, kinds, bucketCounts);
+                }
+            );
+
+            var bucketCount = (snapshot.names.Length > 0) ? snapshot.bucketCounts.Length / snapshot.names.Length : 0;
+            var entries = snapshot.names.Select((name, index) => new Entry
+            {
+                Kind = (EntryKind)snapshot.kinds[index],
+                Name = name,
+                LatencyHistogram = new ArraySegment<ulong>(snapshot.bucketCounts, index * bucketCount, bucketCount).ToArray()
+            });
+
+            return new V8InteropStatistics { Entries = entries.ToArray() };
+        }
+
+        /// <summary>
+        /// Discards the interop statistics recorded so far.
+        /// </summary>
+        public static void Reset()
+        {
+            V8SplitProxyNative.InvokeNoThrow(static instance => instance.V8SplitProxyStatistics_Reset());
+        }
+
+        /// <summary>
+        /// Gets the collection of transition sites for which statistics have been recorded.
+        /// </summary>
+        public IReadOnlyList<Entry> Entries { get; internal set; }
+
+        private static bool enabled;
+
+        #region Nested type: EntryKind
+
+        /// <summary>
+        /// Defines interop transition kinds.
+        /// </summary>
+        public enum EntryKind
+        {
+            /// <summary>
+            /// Indicates a call from the native V8 library into managed code.
+            /// </summary>
+            ManagedMethod,
+
+            /// <summary>
+            /// Indicates a call from managed code into the native V8 library.
+            /// </summary>
+            NativeEntryPoint
+        }
+
+        #endregion
+
+        #region Nested type: Entry
+
+        /// <summary>
+        /// Contains interop statistics for a single transition site.
+        /// </summary>
+        public class Entry
+        {
+            internal Entry()
+            {
+            }
+
+            /// <summary>
+            /// Gets the transition kind.
+            /// </summary>
+            public EntryKind Kind { get; internal set; }
+
+            /// <summary>
+            /// Gets the name of the managed method or native entry point.
+            /// </summary>
+            public string Name { get; internal set; }
+
+            /// <summary>
+            /// Gets the number of recorded calls.
+            /// </summary>
+            public ulong CallCount => LatencyHistogram.Aggregate(0UL, (count, bucketCount) => count + bucketCount);
+
+            /// <summary>
+            /// Gets the latency histogram for the recorded calls.
+            /// </summary>
+            /// <remarks>
+            /// Element <c>N</c> counts calls that took at least 2<sup>N-1</sup> and less than
+            /// 2<sup>N</sup> nanoseconds. Element 0 counts calls below the clock resolution, and
+            /// the last element also counts all calls beyond its range. Latencies are inclusive
+            /// of any nested transitions.
+            /// </remarks>
+            public IReadOnlyList<ulong> LatencyHistogram { get; internal set; }
+        }
+
+        #endregion
+    }
+}
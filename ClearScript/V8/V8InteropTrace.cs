@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System.IO;
+using Microsoft.ClearScript.Util;
+using Microsoft.ClearScript.V8.SplitProxy;
+
+namespace Microsoft.ClearScript.V8
+{
+    /// <summary>
+    /// Records a timeline of script execution, host calls, module loads, and garbage collection
+    /// in the native V8 library.
+    /// </summary>
+    /// <remarks>
+    /// The interop trace is process-wide and is not recorded by default. It retains only the most
+    /// recent events, and when recording is disabled, its overhead is limited to a single branch
+    /// per traced operation.
+    /// </remarks>
+    public static class V8InteropTrace
+    {
+        private static bool enabled;
+
+        /// <summary>
+        /// Enables or disables interop trace recording.
+        /// </summary>
+        public static bool Enabled
+        {
+            get => enabled;
+
+            set
+            {
+                V8SplitProxyNative.InvokeNoThrow(static (instance, value) => instance.V8TraceRecorder_SetEnabled(value), value);
+                enabled = value;
+            }
+        }
+
+        /// <summary>
+        /// Discards the interop trace events recorded so far.
+        /// </summary>
+        public static void Clear()
+        {
+            V8SplitProxyNative.InvokeNoThrow(static instance => instance.V8TraceRecorder_Clear());
+        }
+
+        /// <summary>
+        /// Writes the interop trace events recorded so far to the specified stream.
+        /// </summary>
+        /// <param name="stream">The stream to which to write the interop trace events.</param>
+        /// <remarks>
+        /// The output uses the JSON object form of the
+        /// <see href="https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU">Trace Event Format</see>
+        /// and can be loaded directly into trace viewers such as Perfetto.
+        /// </remarks>
+        public static void WriteJson(Stream stream)
+        {
+            MiscHelpers.VerifyNonNullArgument(stream, nameof(stream));
+
+            using (var streamScope = V8ProxyHelpers.CreateAddRefHostObjectScope(stream))
+            {
+                V8SplitProxyNative.Invoke(static (instance, pStream) => instance.V8TraceRecorder_WriteJson(pStream), streamScope.Value);
+            }
+        }
+    }
+}
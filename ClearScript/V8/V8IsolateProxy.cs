@@ -20,6 +20,8 @@ namespace Microsoft.ClearScript.V8
 
         public abstract UIntPtr MaxStackUsage { get; set; }
 
+        public abstract UIntPtr MaxStringCacheSize { get; set; }
+
         public abstract void AwaitDebuggerAndPause();
 
         public abstract void CancelAwaitDebugger();
@@ -5,6 +5,7 @@ using System;
 using System.Collections.Generic;
 using System.IO;
 using System.Runtime.InteropServices;
+using System.Threading;
 using Microsoft.ClearScript.JavaScript;
 using Microsoft.ClearScript.Util;
 using Microsoft.ClearScript.V8.FastProxy;
@@ -40,6 +41,8 @@ namespace Microsoft.ClearScript.V8
 
         #region host object access
 
+        private static int nextHostObjectTypeId;
+
         public static object GetHostObject(IntPtr pObject)
         {
             return GCHandle.FromIntPtr(pObject).Target;
@@ -166,6 +169,54 @@ namespace Microsoft.ClearScript.V8
             return hostItem.Invocability;
         }
 
+        public static int GetHostObjectTypeId(IntPtr pObject)
+        {
+            return GetHostObjectTypeId(GetHostObject(pObject));
+        }
+
+        public static int GetHostObjectTypeId(object obj)
+        {
+            if ((obj is HostItem hostItem) && (hostItem.Invocability == Invocability.None))
+            {
+                var memberData = hostItem.TypeMemberData;
+                if (memberData is not null)
+                {
+                    if (memberData.TypeId == 0)
+                    {
+                        memberData.TypeId = Interlocked.Increment(ref nextHostObjectTypeId);
+                    }
+
+                    return memberData.TypeId;
+                }
+            }
+
+            return 0;
+        }
+
+        public static int GetExportedHostObjectTypeId(IHostItem hostObject)
+        {
+            // only engines with per-type host object templates consume the type ID
+
+            if ((hostObject is HostItem hostItem) && (hostItem.Engine is V8ScriptEngine engine) && engine.Flags.HasAllFlags(V8ScriptEngineFlags.EnableHostObjectTypeTemplates))
+            {
+                return GetHostObjectTypeId(hostItem);
+            }
+
+            return 0;
+        }
+
+        public static string[] GetHostObjectTypeMemberNames(IntPtr pObject, out string[] extensionMethodNames)
+        {
+            return GetHostObjectTypeMemberNames(GetHostObject(pObject), out extensionMethodNames);
+        }
+
+        public static string[] GetHostObjectTypeMemberNames(object obj, out string[] extensionMethodNames)
+        {
+            var hostItem = (HostItem)obj;
+            extensionMethodNames = hostItem.GetExtensionMethodNames();
+            return hostItem.GetTypeMemberNames();
+        }
+
         public static object GetHostObjectEnumerator(IntPtr pObject)
         {
             return GetHostObjectEnumerator(GetHostObject(pObject));
@@ -300,6 +351,16 @@ namespace Microsoft.ClearScript.V8
             ((V8FastHostItem)obj).Invoke(asConstructor, argCount, pArgs, pResult);
         }
 
+        public static void InvokeFastHostFunction(IntPtr pFunction, int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult)
+        {
+            InvokeFastHostFunction(GetHostObject(pFunction), argCount, pArgs, pResult);
+        }
+
+        public static void InvokeFastHostFunction(object obj, int argCount, V8FastFunctionCallValue.Ptr pArgs, V8FastFunctionCallValue.Ptr pResult)
+        {
+            ((V8FastFunction)obj).Invoke(argCount, pArgs, pResult);
+        }
+
         public static void GetFastHostObjectEnumerator(IntPtr pObject, V8Value.FastResult.Ptr pResult)
         {
             GetFastHostObjectEnumerator(GetHostObject(pObject), pResult);
@@ -322,6 +383,49 @@ namespace Microsoft.ClearScript.V8
 
         #endregion
 
+        #region host enumerator chunking
+
+        public static int GetHostEnumeratorChunk(IntPtr pEnumerator, int maxCount, V8Value.FastResult.Ptr pItems)
+        {
+            return GetHostEnumeratorChunk(GetHostObject(pEnumerator), maxCount, pItems);
+        }
+
+        public static int GetHostEnumeratorChunk(object obj, int maxCount, V8Value.FastResult.Ptr pItems)
+        {
+            if (obj is V8FastHostItem fastHostItem)
+            {
+                return fastHostItem.GetEnumeratorChunk(pItems);
+            }
+
+            if ((obj is HostItem hostItem) && (hostItem.Target.InvokeTarget is ScriptableChunkedEnumerator enumerator))
+            {
+                var engine = (V8ScriptEngine)hostItem.Engine;
+                return engine.HostInvoke(
+                    static ctx => ctx.enumerator.GetChunk(ctx.engine, ctx.maxCount, (ctx.engine, ctx.flags, ctx.pItems), static (state, index, item) => new V8FastResult(state.engine, state.flags, state.pItems.GetElementPtr(index)).SetFromObject(item)),
+                    (engine, flags: hostItem.Flags, enumerator, maxCount, pItems)
+                );
+            }
+
+            return -1;
+        }
+
+        public static object FetchHostAsyncEnumeratorChunk(IntPtr pEnumerator, int maxCount)
+        {
+            return FetchHostAsyncEnumeratorChunk(GetHostObject(pEnumerator), maxCount);
+        }
+
+        public static object FetchHostAsyncEnumeratorChunk(object obj, int maxCount)
+        {
+            if ((obj is HostItem hostItem) && (hostItem.Target.InvokeTarget is IScriptableChunkedAsyncEnumerator enumerator))
+            {
+                return hostItem.Engine.HostInvoke(static ctx => ctx.enumerator.FetchChunkAsync(ctx.maxCount), (enumerator, maxCount));
+            }
+
+            return null;
+        }
+
+        #endregion
+
         #region exception marshaling
 
         public static object MarshalExceptionToScript(IntPtr pSource, Exception exception)
@@ -273,6 +273,36 @@ namespace Microsoft.ClearScript.V8
             }
         }
 
+        /// <summary>
+        /// Gets or sets the maximum number of entries in the runtime's imported string cache.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// When this property is set to a nonzero value, the runtime caches internalized copies
+        /// of short strings imported from the host, allowing repeated imports of the same string
+        /// content to share a single script string. When it is set to the default value, no
+        /// caching is performed.
+        /// </para>
+        /// <para>
+        /// Reducing the value of this property releases excess cache entries at the next string
+        /// import.
+        /// </para>
+        /// </remarks>
+        public UIntPtr MaxStringCacheSize
+        {
+            get
+            {
+                VerifyNotDisposed();
+                return proxy.MaxStringCacheSize;
+            }
+
+            set
+            {
+                VerifyNotDisposed();
+                proxy.MaxStringCacheSize = value;
+            }
+        }
+
         /// <summary>
         /// Gets or sets the V8 runtime's document settings.
         /// </summary>
@@ -1135,6 +1165,8 @@ namespace Microsoft.ClearScript.V8
             public ulong ScriptCount;
             public ulong ScriptCacheSize;
             public ulong ModuleCount;
+            public ulong StringCacheHitCount;
+            public ulong StringCacheMissCount;
             public ulong[] PostedTaskCounts;
             public ulong[] InvokedTaskCounts;
         }
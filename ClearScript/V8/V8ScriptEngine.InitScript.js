@@ -29,6 +29,16 @@ Object.defineProperty(this, 'EngineInternal', { value: (globalObject => {
     const toJson = globalObject.toJson;
     delete globalObject.toJson;
 
+    const getEnumeratorChunk = globalObject.getEnumeratorChunk;
+    delete globalObject.getEnumeratorChunk;
+
+    const fetchAsyncEnumeratorChunk = globalObject.fetchAsyncEnumeratorChunk;
+    delete globalObject.fetchAsyncEnumeratorChunk;
+
+    const minEnumeratorChunkSize = 16;
+    const maxEnumeratorChunkSize = 256;
+    const getNextEnumeratorChunkSize = size => Math.min(size * 2, maxEnumeratorChunkSize);
+
     return Object.freeze({
 
         commandHolder: {},
@@ -150,8 +160,21 @@ Object.defineProperty(this, 'EngineInternal', { value: (globalObject => {
 
         toIterator: bind(function* (enumerator) {
             try {
-                while (enumerator.ScriptableMoveNext()) {
-                    yield enumerator.ScriptableCurrent;
+                let size = minEnumeratorChunkSize;
+                let items = getEnumeratorChunk(enumerator, size);
+                if (items === undefined) {
+                    while (enumerator.ScriptableMoveNext()) {
+                        yield enumerator.ScriptableCurrent;
+                    }
+                }
+                else {
+                    while (items.length > 0) {
+                        for (let index = 0; index < items.length; index++) {
+                            yield items[index];
+                        }
+                        size = getNextEnumeratorChunkSize(size);
+                        items = getEnumeratorChunk(enumerator, size);
+                    }
                 }
             }
             finally {
@@ -161,8 +184,26 @@ Object.defineProperty(this, 'EngineInternal', { value: (globalObject => {
 
         toAsyncIterator: bind(async function* (asyncEnumerator) {
             try {
-                while (await asyncEnumerator.ScriptableMoveNextAsync()) {
-                    yield asyncEnumerator.ScriptableCurrent;
+                let size = minEnumeratorChunkSize;
+                let promise = fetchAsyncEnumeratorChunk(asyncEnumerator, size);
+                if ((promise === null) || (promise === undefined)) {
+                    while (await asyncEnumerator.ScriptableMoveNextAsync()) {
+                        yield asyncEnumerator.ScriptableCurrent;
+                    }
+                }
+                else {
+                    while (true) {
+                        await promise;
+                        const items = getEnumeratorChunk(asyncEnumerator, size);
+                        if (items.length < 1) {
+                            break;
+                        }
+                        for (let index = 0; index < items.length; index++) {
+                            yield items[index];
+                        }
+                        size = getNextEnumeratorChunkSize(size);
+                        promise = fetchAsyncEnumeratorChunk(asyncEnumerator, size);
+                    }
                 }
             }
             finally {
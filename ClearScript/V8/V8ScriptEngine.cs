@@ -51,6 +51,7 @@ namespace Microsoft.ClearScript.V8
         private List<string> documentNames;
         private bool suppressInstanceMethodEnumeration;
         private bool suppressExtensionMethodEnumeration;
+        private ExtensionMethodSummary propertyNamesExtensionMethodSummary;
 
         private CommonJSManager commonJSManager;
         private JsonModuleManager jsonDocumentManager;
@@ -237,7 +238,7 @@ namespace Microsoft.ClearScript.V8
 
             if (flags.HasAllFlags(V8ScriptEngineFlags.EnableStringifyEnhancements))
             {
-                script.SetProperty("toJson", new Func<object, object, string>(new JsonHelper(this).ToJson));
+                script.SetProperty("toJson", new Func<object, object, string>(new JsonHelper().ToJson));
             }
 
             Execute(initScriptInfo, initScript);
@@ -359,6 +360,36 @@ namespace Microsoft.ClearScript.V8
             }
         }
 
+        /// <summary>
+        /// Gets or sets the maximum number of entries in the V8 runtime's imported string cache.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// When this property is set to a nonzero value, the V8 runtime caches internalized copies
+        /// of short strings imported from the host, allowing repeated imports of the same string
+        /// content to share a single script string. When it is set to the default value, no
+        /// caching is performed.
+        /// </para>
+        /// <para>
+        /// Reducing the value of this property releases excess cache entries at the next string
+        /// import.
+        /// </para>
+        /// </remarks>
+        public UIntPtr MaxRuntimeStringCacheSize
+        {
+            get
+            {
+                VerifyNotDisposed();
+                return proxy.MaxIsolateStringCacheSize;
+            }
+
+            set
+            {
+                VerifyNotDisposed();
+                proxy.MaxIsolateStringCacheSize = value;
+            }
+        }
+
         /// <summary>
         /// Enables or disables instance method enumeration.
         /// </summary>
@@ -377,6 +408,7 @@ namespace Microsoft.ClearScript.V8
             {
                 suppressInstanceMethodEnumeration = value;
                 OnEnumerationSettingsChanged();
+                OnHostObjectPropertyNamesChanged();
             }
         }
 
@@ -404,6 +436,7 @@ namespace Microsoft.ClearScript.V8
             {
                 suppressExtensionMethodEnumeration = value;
                 RebuildExtensionMethodSummary();
+                OnHostObjectPropertyNamesChanged();
             }
         }
 
@@ -954,6 +987,311 @@ namespace Microsoft.ClearScript.V8
 
         // ReSharper restore ParameterHidesMember
 
+        /// <summary>
+        /// Serializes a script object by using V8's structured clone algorithm.
+        /// </summary>
+        /// <param name="obj">The script object to serialize.</param>
+        /// <returns>A serialized value that can be deserialized by any V8 script engine.</returns>
+        /// <remarks>
+        /// The specified object must belong to this script engine. Functions, host objects, and
+        /// other objects that do not support structured cloning cannot be serialized.
+        /// </remarks>
+        /// <c><seealso cref="Deserialize"/></c>
+        public V8SerializedValue Serialize(object obj)
+        {
+            VerifyNotDisposed();
+            MiscHelpers.VerifyNonNullArgument(obj, nameof(obj));
+
+            if ((obj is not V8ScriptItem scriptItem) || (scriptItem.Engine != this))
+            {
+                throw new ArgumentException("The argument must be a script object that belongs to this script engine", nameof(obj));
+            }
+
+            return scriptItem.Serialize();
+        }
+
+        /// <summary>
+        /// Deserializes a value created by <c><see cref="Serialize"/></c>.
+        /// </summary>
+        /// <param name="value">The serialized value to deserialize.</param>
+        /// <returns>A new copy of the original object graph, marshaled to the host.</returns>
+        /// <remarks>
+        /// The serialized value can originate from any V8 script engine, including one that uses
+        /// a different V8 runtime.
+        /// </remarks>
+        public object Deserialize(V8SerializedValue value)
+        {
+            VerifyNotDisposed();
+            MiscHelpers.VerifyNonNullArgument(value, nameof(value));
+            return MarshalToHost(ScriptInvoke(static ctx => ctx.proxy.Deserialize(ctx.value.Data, ctx.value.SharedObjects), (proxy, value)), false);
+        }
+
+        /// <summary>
+        /// Parses a JSON string into a script value.
+        /// </summary>
+        /// <param name="json">The JSON string to parse.</param>
+        /// <returns>The parsed value, marshaled to the host.</returns>
+        /// <remarks>
+        /// This method is equivalent to invoking the built-in <c>JSON.parse</c> function without a
+        /// reviver, but it bypasses script compilation and method invocation.
+        /// </remarks>
+        public object ParseJson(string json)
+        {
+            VerifyNotDisposed();
+            MiscHelpers.VerifyNonNullArgument(json, nameof(json));
+            return MarshalToHost(ScriptInvoke(static ctx => ctx.proxy.ParseJson(ctx.json), (proxy, json)), false);
+        }
+
+        /// <summary>
+        /// Parses UTF-8 encoded JSON into a script value.
+        /// </summary>
+        /// <param name="utf8Json">The UTF-8 encoded JSON to parse.</param>
+        /// <returns>The parsed value, marshaled to the host.</returns>
+        /// <remarks>
+        /// This method avoids decoding the input into a managed string. ASCII input is passed to
+        /// the script engine as a one-byte string without an intermediate copy.
+        /// </remarks>
+        public object ParseJson(byte[] utf8Json)
+        {
+            VerifyNotDisposed();
+            MiscHelpers.VerifyNonNullArgument(utf8Json, nameof(utf8Json));
+            return MarshalToHost(ScriptInvoke(static ctx => ctx.proxy.ParseJson(ctx.utf8Json), (proxy, utf8Json)), false);
+        }
+
+        /// <summary>
+        /// Creates a plain script object with the specified properties.
+        /// </summary>
+        /// <param name="names">The names of the properties to create.</param>
+        /// <param name="values">The property values, in the same order as <paramref name="names"/>.</param>
+        /// <returns>The new script object, marshaled to the host.</returns>
+        /// <remarks>
+        /// This method is equivalent to evaluating an object literal, but it requires only one
+        /// call into the script engine. Objects created with the same list of property names
+        /// share their layout within the script engine. If a name appears more than once, the
+        /// last corresponding value is used.
+        /// </remarks>
+        public object CreateScriptObject(string[] names, object[] values)
+        {
+            VerifyNotDisposed();
+            MiscHelpers.VerifyNonNullArgument(names, nameof(names));
+            MiscHelpers.VerifyNonNullArgument(values, nameof(values));
+
+            if (names.Length != values.Length)
+            {
+                throw new ArgumentException("The number of values must match the number of property names", nameof(values));
+            }
+
+            var marshaledValues = values.Select(value => MarshalToScript(value)).ToArray();
+            return MarshalToHost(ScriptInvoke(static ctx => ctx.proxy.CreateObject(ctx.names, ctx.marshaledValues), (proxy, names, marshaledValues)), false);
+        }
+
+        /// <summary>
+        /// Executes a batch of script object operations.
+        /// </summary>
+        /// <param name="batch">The batch of operations to execute.</param>
+        /// <returns>The results of the operations, in the order in which they were added to the batch.</returns>
+        /// <remarks>
+        /// All the script objects targeted by the batch must belong to this script engine.
+        /// </remarks>
+        public IReadOnlyList<V8Batch.Result> ExecuteBatch(V8Batch batch)
+        {
+            VerifyNotDisposed();
+            MiscHelpers.VerifyNonNullArgument(batch, nameof(batch));
+
+            if (batch.Targets.Any(target => target.Engine != this))
+            {
+                throw new ArgumentException("The batch must target only script objects that belong to this script engine", nameof(batch));
+            }
+
+            var commands = batch.Commands;
+            var names = batch.Names;
+            var marshaledValues = batch.Values.Select(value => MarshalToScript(value)).ToArray();
+
+            var (results, errors) = ScriptInvoke(
+                static ctx =>
+                {
+                    ctx.proxy.ExecuteBatch(ctx.commands, ctx.names, ctx.marshaledValues, out var tempResults, out var tempErrors);
+                    return (tempResults, tempErrors);
+                },
+                (proxy, commands, names, marshaledValues)
+            );
+
+            return results.Select((result, index) => new V8Batch.Result(MarshalToHost(result, false), string.IsNullOrEmpty(errors[index]) ? null : errors[index])).ToArray();
+        }
+
+        /// <summary>
+        /// Exposes a host action with the specified signature as a fast script function.
+        /// </summary>
+        /// <param name="itemName">A name for the new global script item that will represent the function.</param>
+        /// <param name="action">The delegate to expose.</param>
+        /// <remarks>
+        /// <para>
+        /// Fast functions are invoked through V8's fast API call mechanism, bypassing the standard
+        /// host object machinery. Optimized script code can call them directly, without allocating
+        /// V8 handles or marshaling arguments through the general-purpose value conversion path.
+        /// </para>
+        /// <para>
+        /// Supported argument types are <c><see cref="bool"/></c>, <c><see cref="int"/></c>,
+        /// <c><see cref="double"/></c>, and <c><see cref="string"/></c>. Supported return types
+        /// are <c><see cref="bool"/></c>, <c><see cref="int"/></c>, and <c><see cref="double"/></c>.
+        /// Script arguments are converted to the specified types by using standard JavaScript
+        /// conversion rules.
+        /// </para>
+        /// <para>
+        /// The callback must not access this script engine. Exceptions thrown by the callback are
+        /// propagated to the calling script code.
+        /// </para>
+        /// </remarks>
+        public void AddFastFunction(string itemName, Action action)
+        {
+            MiscHelpers.VerifyNonNullArgument(action, nameof(action));
+            AddFastFunction(itemName, V8FastFunction.Create(action));
+        }
+
+        /// <summary>
+        /// Exposes a host action with the specified signature as a fast script function.
+        /// </summary>
+        /// <typeparam name="T1">The type of the first argument.</typeparam>
+        /// <param name="itemName">A name for the new global script item that will represent the function.</param>
+        /// <param name="action">The delegate to expose.</param>
+        /// <remarks>
+        /// See <c><see cref="AddFastFunction(string, Action)"/></c> for the supported argument and
+        /// return types and the restrictions that apply to the delegate.
+        /// </remarks>
+        public void AddFastFunction<T1>(string itemName, Action<T1> action)
+        {
+            MiscHelpers.VerifyNonNullArgument(action, nameof(action));
+            AddFastFunction(itemName, V8FastFunction.Create(action));
+        }
+
+        /// <summary>
+        /// Exposes a host action with the specified signature as a fast script function.
+        /// </summary>
+        /// <typeparam name="T1">The type of the first argument.</typeparam>
+        /// <typeparam name="T2">The type of the second argument.</typeparam>
+        /// <param name="itemName">A name for the new global script item that will represent the function.</param>
+        /// <param name="action">The delegate to expose.</param>
+        /// <remarks>
+        /// See <c><see cref="AddFastFunction(string, Action)"/></c> for the supported argument and
+        /// return types and the restrictions that apply to the delegate.
+        /// </remarks>
+        public void AddFastFunction<T1, T2>(string itemName, Action<T1, T2> action)
+        {
+            MiscHelpers.VerifyNonNullArgument(action, nameof(action));
+            AddFastFunction(itemName, V8FastFunction.Create(action));
+        }
+
+        /// <summary>
+        /// Exposes a host action with the specified signature as a fast script function.
+        /// </summary>
+        /// <typeparam name="T1">The type of the first argument.</typeparam>
+        /// <typeparam name="T2">The type of the second argument.</typeparam>
+        /// <typeparam name="T3">The type of the third argument.</typeparam>
+        /// <param name="itemName">A name for the new global script item that will represent the function.</param>
+        /// <param name="action">The delegate to expose.</param>
+        /// <remarks>
+        /// See <c><see cref="AddFastFunction(string, Action)"/></c> for the supported argument and
+        /// return types and the restrictions that apply to the delegate.
+        /// </remarks>
+        public void AddFastFunction<T1, T2, T3>(string itemName, Action<T1, T2, T3> action)
+        {
+            MiscHelpers.VerifyNonNullArgument(action, nameof(action));
+            AddFastFunction(itemName, V8FastFunction.Create(action));
+        }
+
+        /// <summary>
+        /// Exposes a host function with the specified signature as a fast script function.
+        /// </summary>
+        /// <typeparam name="TResult">The return type.</typeparam>
+        /// <param name="itemName">A name for the new global script item that will represent the function.</param>
+        /// <param name="function">The delegate to expose.</param>
+        /// <remarks>
+        /// See <c><see cref="AddFastFunction(string, Action)"/></c> for the supported argument and
+        /// return types and the restrictions that apply to the delegate.
+        /// </remarks>
+        public void AddFastFunction<TResult>(string itemName, Func<TResult> function)
+        {
+            MiscHelpers.VerifyNonNullArgument(function, nameof(function));
+            AddFastFunction(itemName, V8FastFunction.Create(function));
+        }
+
+        /// <summary>
+        /// Exposes a host function with the specified signature as a fast script function.
+        /// </summary>
+        /// <typeparam name="T1">The type of the first argument.</typeparam>
+        /// <typeparam name="TResult">The return type.</typeparam>
+        /// <param name="itemName">A name for the new global script item that will represent the function.</param>
+        /// <param name="function">The delegate to expose.</param>
+        /// <remarks>
+        /// See <c><see cref="AddFastFunction(string, Action)"/></c> for the supported argument and
+        /// return types and the restrictions that apply to the delegate.
+        /// </remarks>
+        public void AddFastFunction<T1, TResult>(string itemName, Func<T1, TResult> function)
+        {
+            MiscHelpers.VerifyNonNullArgument(function, nameof(function));
+            AddFastFunction(itemName, V8FastFunction.Create(function));
+        }
+
+        /// <summary>
+        /// Exposes a host function with the specified signature as a fast script function.
+        /// </summary>
+        /// <typeparam name="T1">The type of the first argument.</typeparam>
+        /// <typeparam name="T2">The type of the second argument.</typeparam>
+        /// <typeparam name="TResult">The return type.</typeparam>
+        /// <param name="itemName">A name for the new global script item that will represent the function.</param>
+        /// <param name="function">The delegate to expose.</param>
+        /// <remarks>
+        /// See <c><see cref="AddFastFunction(string, Action)"/></c> for the supported argument and
+        /// return types and the restrictions that apply to the delegate.
+        /// </remarks>
+        public void AddFastFunction<T1, T2, TResult>(string itemName, Func<T1, T2, TResult> function)
+        {
+            MiscHelpers.VerifyNonNullArgument(function, nameof(function));
+            AddFastFunction(itemName, V8FastFunction.Create(function));
+        }
+
+        /// <summary>
+        /// Exposes a host function with the specified signature as a fast script function.
+        /// </summary>
+        /// <typeparam name="T1">The type of the first argument.</typeparam>
+        /// <typeparam name="T2">The type of the second argument.</typeparam>
+        /// <typeparam name="T3">The type of the third argument.</typeparam>
+        /// <typeparam name="TResult">The return type.</typeparam>
+        /// <param name="itemName">A name for the new global script item that will represent the function.</param>
+        /// <param name="function">The delegate to expose.</param>
+        /// <remarks>
+        /// See <c><see cref="AddFastFunction(string, Action)"/></c> for the supported argument and
+        /// return types and the restrictions that apply to the delegate.
+        /// </remarks>
+        public void AddFastFunction<T1, T2, T3, TResult>(string itemName, Func<T1, T2, T3, TResult> function)
+        {
+            MiscHelpers.VerifyNonNullArgument(function, nameof(function));
+            AddFastFunction(itemName, V8FastFunction.Create(function));
+        }
+
+        /// <summary>
+        /// Invalidates cached script values for the specified host members.
+        /// </summary>
+        /// <param name="memberNames">The names of the host members whose cached values are to be invalidated.</param>
+        /// <remarks>
+        /// <para>
+        /// V8 script engines cache the script representations of certain host members, such as
+        /// methods and read-only fields, on a per-object basis. Use this method to discard cached
+        /// values for specific members after the corresponding host-side members have changed.
+        /// </para>
+        /// <para>
+        /// Unlike changes to properties such as <c><see cref="ScriptEngine.AccessContext"/></c>,
+        /// which invalidate all cached host members, this method leaves cached values for other
+        /// members intact.
+        /// </para>
+        /// </remarks>
+        public void InvalidateHostMemberCache(params string[] memberNames)
+        {
+            VerifyNotDisposed();
+            MiscHelpers.VerifyNonNullArgument(memberNames, nameof(memberNames));
+            ScriptInvoke(static ctx => ctx.proxy.InvalidateHostMemberCache(ctx.memberNames), (proxy, memberNames));
+        }
+
         /// <summary>
         /// Cancels any pending request to interrupt script execution.
         /// </summary>
@@ -1124,6 +1462,14 @@ namespace Microsoft.ClearScript.V8
             }
         }
 
+        private void OnHostObjectPropertyNamesChanged()
+        {
+            // host object property name arrays are cached by the V8 context
+
+            propertyNamesExtensionMethodSummary = ExtensionMethodSummary;
+            ScriptInvoke(static proxy => proxy.OnEnumerationSettingsChanged(), proxy);
+        }
+
         private string BaseExecuteCommand(string command) => base.ExecuteCommand(command);
 
         // ReSharper disable ParameterHidesMember
@@ -1570,6 +1916,36 @@ namespace Microsoft.ClearScript.V8
             );
         }
 
+        private void AddFastFunction(string itemName, V8FastFunction function)
+        {
+            VerifyNotDisposed();
+            MiscHelpers.VerifyNonNullArgument(itemName, nameof(itemName));
+
+            ScriptInvoke(
+                static ctx =>
+                {
+                    object v8Function;
+
+                    var pFunction = V8ProxyHelpers.AddRefHostObject(ctx.function);
+                    try
+                    {
+                        v8Function = ctx.self.proxy.CreateFastFunction(pFunction, ctx.function.ReturnType, ctx.function.ArgTypes);
+                    }
+                    catch
+                    {
+                        V8ProxyHelpers.ReleaseHostObject(pFunction);
+                        throw;
+                    }
+
+                    using ((IDisposable)v8Function)
+                    {
+                        ctx.self.proxy.AddGlobalItem(ctx.itemName, v8Function, false);
+                    }
+                },
+                (self: this, itemName, function)
+            );
+        }
+
         internal override object MarshalToScript(object obj, HostItemFlags flags)
         {
             return MarshalToScriptInternal(obj, flags, null);
@@ -1699,17 +2075,38 @@ namespace Microsoft.ClearScript.V8
                 {
                     if (marshaledArrayMap?.TryGetValue(array, out var scriptArray) != true)
                     {
-                        var v8Internal = (V8ScriptItem)script.GetProperty("EngineInternal");
-                        scriptArray = (V8ScriptItem)V8ScriptItem.Wrap(this, v8Internal.InvokeMethod(false, "createArray"));
-                        (marshaledArrayMap ?? (marshaledArrayMap = new Dictionary<Array, V8ScriptItem>())).Add(array, scriptArray);
+                        // A null map entry indicates that the array is being marshaled. If a nested
+                        // element refers back to it, a placeholder is created and populated below.
+
+                        (marshaledArrayMap ?? (marshaledArrayMap = new Dictionary<Array, V8ScriptItem>())).Add(array, null);
 
                         var elementType = array.GetType().GetElementType();
-                        var upperBound = array.GetUpperBound(0);
-                        for (var index = array.GetLowerBound(0); index <= upperBound; index++)
+                        var lowerBound = array.GetLowerBound(0);
+                        var values = new object[array.Length];
+                        for (var index = 0; index < values.Length; index++)
+                        {
+                            var result = PrepareResult(array.GetValue(lowerBound + index), elementType, ScriptMemberFlags.None, false);
+                            values[index] = MarshalToScriptInternal(result, flags, marshaledArrayMap);
+                        }
+
+                        scriptArray = marshaledArrayMap[array];
+                        if ((scriptArray is null) && (lowerBound == 0))
                         {
-                            var result = PrepareResult(array.GetValue(index), elementType, ScriptMemberFlags.None, false);
-                            scriptArray.SetProperty(false, index, MarshalToScriptInternal(result, flags, marshaledArrayMap));
+                            scriptArray = (V8ScriptItem)V8ScriptItem.Wrap(this, ScriptInvoke(static ctx => ctx.proxy.CreateArray(ctx.values), (proxy, values)));
+                            marshaledArrayMap[array] = scriptArray;
                         }
+                        else
+                        {
+                            scriptArray = scriptArray ?? CreateArrayPlaceholder(array, marshaledArrayMap);
+                            for (var index = 0; index < values.Length; index++)
+                            {
+                                scriptArray.SetProperty(false, lowerBound + index, values[index]);
+                            }
+                        }
+                    }
+                    else if (scriptArray is null)
+                    {
+                        scriptArray = CreateArrayPlaceholder(array, marshaledArrayMap);
                     }
 
                     obj = scriptArray;
@@ -1734,6 +2131,19 @@ namespace Microsoft.ClearScript.V8
                 return V8FastHostItem.Wrap(this, fastObject, flags);
             }
 
+            if (hostTarget is HostType)
+            {
+                // exposing a host type may extend the extension method table
+
+                var hostTypeItem = HostItem.Wrap(this, hostTarget, flags);
+                if (ExtensionMethodSummary != propertyNamesExtensionMethodSummary)
+                {
+                    OnHostObjectPropertyNamesChanged();
+                }
+
+                return hostTypeItem;
+            }
+
             return HostItem.Wrap(this, hostTarget ?? obj, flags);
         }
 
@@ -1794,13 +2204,14 @@ namespace Microsoft.ClearScript.V8
                 {
                     if (marshaledArrayMap?.TryGetValue(scriptItem, out var array) != true)
                     {
-                        array = new object[((IList)scriptItem).Count];
+                        var values = scriptItem.ExportArray();
+                        array = values ?? new object[((IList)scriptItem).Count];
                         (marshaledArrayMap ?? (marshaledArrayMap = new Dictionary<V8ScriptItem, object[]>())).Add(scriptItem, array);
 
                         var length = array.Length;
                         for (var index = 0; index < length; index++)
                         {
-                            array[index] = MarshalToHostInternal(scriptItem.GetProperty(false, index), false, marshaledArrayMap);
+                            array[index] = MarshalToHostInternal((values != null) ? values[index] : scriptItem.GetProperty(false, index), false, marshaledArrayMap);
                         }
                     }
 
@@ -1811,6 +2222,14 @@ namespace Microsoft.ClearScript.V8
             return wrappedObject;
         }
 
+        private V8ScriptItem CreateArrayPlaceholder(Array array, Dictionary<Array, V8ScriptItem> marshaledArrayMap)
+        {
+            var v8Internal = (V8ScriptItem)script.GetProperty("EngineInternal");
+            var scriptArray = (V8ScriptItem)V8ScriptItem.Wrap(this, v8Internal.InvokeMethod(false, "createArray"));
+            marshaledArrayMap[array] = scriptArray;
+            return scriptArray;
+        }
+
         internal override object Execute(UniqueDocumentInfo documentInfo, string code, bool evaluate)
         {
             VerifyNotDisposed();
@@ -2160,6 +2579,11 @@ namespace Microsoft.ClearScript.V8
             public ulong ScriptCount;
             public ulong ModuleCount;
             public ulong ModuleCacheSize;
+            public ulong PropertyNameCacheHitCount;
+            public ulong PropertyNameCacheMissCount;
+            public ulong ObjectIdentityCacheHitCount;
+            public ulong ObjectIdentityCacheMissCount;
+            public ulong FastFunctionCallCount;
             public int CommonJSModuleCacheSize;
         }
 
@@ -2202,14 +2626,19 @@ namespace Microsoft.ClearScript.V8
         /// <exclude/>
         public sealed class JsonHelper : JsonConverter
         {
-            private readonly ScriptObject stringify;
             private readonly HashSet<object> cycleDetectionSet = new();
 
             /// <exclude/>
+            public JsonHelper()
+            {
+            }
+
+            /// <exclude/>
+            [Obsolete("Script objects are now stringified without the script engine's JSON.stringify function. Use JsonHelper() instead.")]
+            // ReSharper disable once UnusedParameter.Local
             public JsonHelper(V8ScriptEngine engine)
+                : this()
             {
-                var json = (ScriptObject)engine.script.GetProperty("JSON");
-                stringify = (ScriptObject)json.GetProperty("stringify");
             }
 
             /// <exclude/>
@@ -2235,8 +2664,13 @@ namespace Microsoft.ClearScript.V8
             /// <exclude/>
             public override void WriteJson(JsonWriter writer, object value, JsonSerializer serializer)
             {
-                var result = stringify.Invoke(false, value);
-                writer.WriteRawValue(result as string ?? "null");
+                // V8 stringifies the value natively, still running any toJSON methods and getters
+                // it encounters but bypassing a script-level replacement of JSON.stringify. It
+                // renders values that have no JSON representation (such as functions) as
+                // "undefined"; emit null for those.
+
+                var result = ((V8ScriptItem)value).ToJson();
+                writer.WriteRawValue((result == "undefined") ? "null" : result);
             }
 
             /// <exclude/>
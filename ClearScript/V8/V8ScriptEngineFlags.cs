@@ -122,7 +122,10 @@ namespace Microsoft.ClearScript.V8
         /// Specifies that
         /// <c><see href="https://developer.mozilla.org/en-US/docs/Web/JavaScript/Reference/Global_Objects/JSON/stringify">JSON.stringify</see></c>
         /// enhancements are to be enabled. These enhancements add support for host objects via the
-        /// <see href="https://www.newtonsoft.com/json">Json.NET</see> library.
+        /// <see href="https://www.newtonsoft.com/json">Json.NET</see> library. Script objects
+        /// nested within host objects are stringified natively; their <c>toJSON</c> methods and
+        /// property getters are still invoked, but a script-level replacement of
+        /// <c>JSON.stringify</c> is not.
         /// </summary>
         EnableStringifyEnhancements = 0x00000800,
 
@@ -168,7 +171,25 @@ namespace Microsoft.ClearScript.V8
         /// argument or property value. Excessive copying of array contents can also impact
         /// application performance and/or memory consumption. Caution is recommended.
         /// </summary>
-        EnableArrayConversion = 0x00010000
+        EnableArrayConversion = 0x00010000,
+
+        /// <summary>
+        /// Specifies that the script engine is to track script objects that have been passed to
+        /// the host. When a tracked object is passed to the host again, the script engine reuses
+        /// its existing native handle instead of allocating a new one. Tracking is weak and does
+        /// not extend object lifetime. This option can reduce allocation and garbage collection
+        /// overhead when the host repeatedly accesses the same script objects.
+        /// </summary>
+        EnableObjectIdentityCache = 0x00020000,
+
+        /// <summary>
+        /// Specifies that the script engine is to expose the members of ordinary host objects via
+        /// per-type templates. Host objects of the same .NET type share a JavaScript hidden class
+        /// whose properties correspond to the type's fields, properties, methods, and events,
+        /// allowing V8 to optimize repeated member access. Other host object members, such as
+        /// extension methods and dynamic members, remain accessible through the usual slower path.
+        /// </summary>
+        EnableHostObjectTypeTemplates = 0x00040000
     }
 
     internal static class V8ScriptEngineFlagsHelpers
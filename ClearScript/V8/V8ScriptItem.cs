@@ -111,6 +111,61 @@ namespace Microsoft.ClearScript.V8
             engine.ScriptInvoke(static ctx => ctx.self.target.SetProperty(ctx.index, ctx.marshalValue ? ctx.self.engine.MarshalToScript(ctx.value) : ctx.value), (self: this, marshalValue, index, value));
         }
 
+        public object[] ExportArray()
+        {
+            VerifyNotDisposed();
+            return engine.ScriptInvoke(static target => target.ExportArray(), target);
+        }
+
+        public V8SerializedValue Serialize()
+        {
+            VerifyNotDisposed();
+            return engine.ScriptInvoke(
+                static target =>
+                {
+                    var data = target.Serialize(out var sharedObjects);
+                    return new V8SerializedValue(data, sharedObjects);
+                },
+                target
+            );
+        }
+
+        public string ToJson()
+        {
+            VerifyNotDisposed();
+            return engine.ScriptInvoke(static target => target.ToJson(), target);
+        }
+
+        public object[] GetProperties(string[] names)
+        {
+            VerifyNotDisposed();
+
+            var values = engine.ScriptInvoke(static ctx => ctx.target.GetProperties(ctx.names), (target, names));
+            for (var index = 0; index < values.Length; index++)
+            {
+                var value = engine.MarshalToHost(values[index], false);
+                if ((value is V8ScriptItem valueScriptItem) && (valueScriptItem.engine == engine))
+                {
+                    valueScriptItem.holder = this;
+                }
+
+                values[index] = value;
+            }
+
+            return values;
+        }
+
+        public void SetProperties(string[] names, object[] values)
+        {
+            VerifyNotDisposed();
+            if (values.Length != names.Length)
+            {
+                throw new ArgumentException("The number of values must match the number of property names", nameof(values));
+            }
+
+            engine.ScriptInvoke(static ctx => ctx.self.target.SetProperties(ctx.names, ctx.self.engine.MarshalToScript(ctx.values)), (self: this, names, values));
+        }
+
         public object InvokeMethod(bool marshalResult, string name, params object[] args)
         {
             VerifyNotDisposed();
@@ -392,7 +447,7 @@ namespace Microsoft.ClearScript.V8
 
             private IEnumerable<string> PropertyKeys => GetPropertyKeys();
 
-            private IEnumerable<KeyValuePair<string, object>> KeyValuePairs => PropertyKeys.Select(name => new KeyValuePair<string, object>(name, GetProperty(name)));
+            private IEnumerable<KeyValuePair<string, object>> KeyValuePairs => GetKeyValuePairs();
 
             private string[] GetPropertyKeys()
             {
@@ -400,6 +455,13 @@ namespace Microsoft.ClearScript.V8
                 return engine.ScriptInvoke(static target => target.GetPropertyNames(true), target);
             }
 
+            private KeyValuePair<string, object>[] GetKeyValuePairs()
+            {
+                var names = GetPropertyKeys();
+                var values = GetProperties(names);
+                return names.Select((name, index) => new KeyValuePair<string, object>(name, values[index])).ToArray();
+            }
+
             IEnumerator<KeyValuePair<string, object>> IEnumerable<KeyValuePair<string, object>>.GetEnumerator()
             {
                 // ReSharper disable once NotDisposedResourceIsReturned
@@ -470,7 +532,7 @@ namespace Microsoft.ClearScript.V8
 
             ICollection<string> IDictionary<string, object>.Keys => PropertyKeys.ToList();
 
-            ICollection<object> IDictionary<string, object>.Values => PropertyKeys.Select(name => GetProperty(name)).ToList();
+            ICollection<object> IDictionary<string, object>.Values => GetProperties(GetPropertyKeys()).ToList();
 
             #endregion
         }
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+
+namespace Microsoft.ClearScript.V8
+{
+    /// <summary>
+    /// Represents a JavaScript object graph serialized by V8's structured clone algorithm.
+    /// </summary>
+    /// <remarks>
+    /// A serialized value can be deserialized by any V8 script engine, including one that uses
+    /// a different V8 runtime. Shared array buffers within the object graph are not copied; their
+    /// contents remain shared with the original object graph and any deserialized copies.
+    /// </remarks>
+    /// <seealso cref="V8ScriptEngine.Serialize"/>
+    /// <seealso cref="V8ScriptEngine.Deserialize"/>
+    public sealed class V8SerializedValue : IDisposable
+    {
+        private readonly byte[] data;
+        private object[] sharedObjects;
+
+        internal V8SerializedValue(byte[] data, object[] sharedObjects)
+        {
+            this.data = data;
+            this.sharedObjects = sharedObjects;
+        }
+
+        /// <summary>
+        /// Gets the size of the serialized data in bytes.
+        /// </summary>
+        /// <remarks>
+        /// The reported size does not include the contents of shared array buffers.
+        /// </remarks>
+        public int Size => data.Length;
+
+        internal byte[] Data => data;
+
+        internal object[] SharedObjects => sharedObjects ?? throw new ObjectDisposedException(ToString());
+
+        #region IDisposable implementation
+
+        /// <summary>
+        /// Releases the resources used by the serialized value.
+        /// </summary>
+        /// <remarks>
+        /// After this method is called, the serialized value can no longer be deserialized.
+        /// </remarks>
+        public void Dispose()
+        {
+            var tempSharedObjects = sharedObjects;
+            sharedObjects = null;
+
+            if (tempSharedObjects is not null)
+            {
+                foreach (var sharedObject in tempSharedObjects)
+                {
+                    (sharedObject as IDisposable)?.Dispose();
+                }
+            }
+        }
+
+        #endregion
+    }
+}
@@ -27,7 +27,7 @@ namespace Microsoft.ClearScript.Test
             {
                 if ((arg == "-b") || (arg == "--burn"))
                 {
-                    burn = argQueue.TryDequeue(out var choiceString) && uint.TryParse(choiceString, out choice) && (choice >= 1) && (choice <= 2);
+                    burn = argQueue.TryDequeue(out var choiceString) && uint.TryParse(choiceString, out choice) && (choice >= 1) && (choice <= 3);
                 }
                 else if ((arg == "-d") || (arg == "--disable-background-work"))
                 {
@@ -46,7 +46,8 @@ namespace Microsoft.ClearScript.Test
                 {
                     Console.WriteLine("1. SunSpider - V8 (default)");
                     Console.WriteLine("2. SunSpider - V8 (no GlobalMembers support)");
-                    Console.WriteLine("3. Exit");
+                    Console.WriteLine("3. Interop - V8");
+                    Console.WriteLine("4. Exit");
                     Console.WriteLine();
                 }
 
@@ -86,6 +87,11 @@ namespace Microsoft.ClearScript.Test
                             break;
 
                         case 3:
+                            Run(() => new V8ScriptEngine(), Interop.RunSuite, burn);
+                            done = true;
+                            break;
+
+                        case 4:
                             done = true;
                             exit = true;
                             break;
@@ -28,7 +28,7 @@ namespace Microsoft.ClearScript.Test
             {
                 if ((arg == "-b") || (arg == "--burn"))
                 {
-                    burn = argQueue.TryDequeue(out var choiceString) && uint.TryParse(choiceString, out choice) && (choice >= 1) && (choice <= 3);
+                    burn = argQueue.TryDequeue(out var choiceString) && uint.TryParse(choiceString, out choice) && (choice >= 1) && (choice <= 4);
                 }
                 else if ((arg == "-d") || (arg == "--disable-background-work"))
                 {
@@ -48,7 +48,8 @@ namespace Microsoft.ClearScript.Test
                     Console.WriteLine("1. SunSpider - JScript");
                     Console.WriteLine("2. SunSpider - V8 (default)");
                     Console.WriteLine("3. SunSpider - V8 (no GlobalMembers support)");
-                    Console.WriteLine("4. Exit");
+                    Console.WriteLine("4. Interop - V8");
+                    Console.WriteLine("5. Exit");
                     Console.WriteLine();
                 }
 
@@ -93,6 +94,11 @@ namespace Microsoft.ClearScript.Test
                             break;
 
                         case 4:
+                            Run(() => new V8ScriptEngine(), Interop.RunSuite, burn);
+                            done = true;
+                            break;
+
+                        case 5:
                             done = true;
                             exit = true;
                             break;
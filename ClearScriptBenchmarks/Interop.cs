@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+using System.Diagnostics;
+
+namespace Microsoft.ClearScript.Test
+{
+    internal static class Interop
+    {
+        private const int iterationCount = 1000000;
+        private const int repeatCount = 5;
+
+        public static void RunSuite(ScriptEngine engine, bool quiet)
+        {
+            var host = new Host();
+            engine.AccessContext = typeof(Interop);
+            engine.AddHostObject("host", host);
+            engine.Execute(@"
+                function getProperty(count) { let sum = 0; for (let i = 0; i < count; i++) sum += host.Value; return sum; }
+                function setProperty(count) { for (let i = 0; i < count; i++) host.Value = i; }
+                function invokeMethod(count) { let sum = 0; for (let i = 0; i < count; i++) sum += host.Increment(i); return sum; }
+                function invokeEmptyMethod(count) { for (let i = 0; i < count; i++) host.Nop(); }
+                function runEmptyLoop(count) { const nop = () => {}; for (let i = 0; i < count; i++) nop(); }
+                scriptObject = { value: 123 };
+            ");
+
+            Run(engine, "Host property get", () => engine.Script.getProperty(iterationCount), quiet);
+            Run(engine, "Host property set", () => engine.Script.setProperty(iterationCount), quiet);
+            Run(engine, "Host method invocation", () => engine.Script.invokeMethod(iterationCount), quiet);
+
+            // isolate a single crossing: an empty host method with no arguments or result, net of
+            // the cost of an equivalent script loop
+
+            var loopTime = Measure(engine, () => engine.Script.runEmptyLoop(iterationCount));
+            var crossingTime = Measure(engine, () => engine.Script.invokeEmptyMethod(iterationCount));
+            if (!quiet) Console.WriteLine("Empty host method invocation: {0:0.0} ns per crossing", Math.Max(crossingTime - loopTime, 0));
+
+            var scriptObject = (ScriptObject)engine.Script.scriptObject;
+            Run(engine, "Script property get", () =>
+            {
+                for (var i = 0; i < iterationCount; i++)
+                {
+                    scriptObject.GetProperty("value");
+                }
+            }, quiet);
+        }
+
+        private static void Run(ScriptEngine engine, string name, Action action, bool quiet)
+        {
+            var best = Measure(engine, action);
+            if (!quiet) Console.WriteLine("{0}: {1:0.0} ns per crossing", name, best);
+        }
+
+        private static double Measure(ScriptEngine engine, Action action)
+        {
+            // warm up
+            action();
+
+            var best = double.MaxValue;
+            for (var repeatIndex = 0; repeatIndex < repeatCount; repeatIndex++)
+            {
+                engine.CollectGarbage(true);
+                var stopWatch = Stopwatch.StartNew();
+                action();
+                best = Math.Min(best, stopWatch.Elapsed.TotalMilliseconds * 1000000 / iterationCount);
+            }
+
+            return best;
+        }
+
+        // ReSharper disable UnusedMember.Local
+
+        private sealed class Host
+        {
+            public int Value { get; set; } = 1;
+
+            public int Increment(int value)
+            {
+                return value + 1;
+            }
+
+            public void Nop()
+            {
+            }
+        }
+
+        // ReSharper restore UnusedMember.Local
+    }
+}
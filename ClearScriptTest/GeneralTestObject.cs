@@ -63,4 +63,13 @@ namespace Microsoft.ClearScript.Test
 
         #endregion
     }
+
+    public static class GeneralTestObjectExtensions
+    {
+        [ScriptMember("valueOf")]
+        public static int GetValue(this GeneralTestObject self)
+        {
+            return self.Age;
+        }
+    }
 }
@@ -113,6 +113,31 @@ namespace Microsoft.ClearScript.Test
             Assert.AreEqual(barSecond, engine.Evaluate("second"));
         }
 
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_AddHostObject_GlobalMembers_Index()
+        {
+            engine.AddHostObject("foo", HostItemFlags.GlobalMembers, new { first = 123, second = 456 });
+            Assert.AreEqual(456, engine.Evaluate("second"));
+            Assert.AreEqual("undefined", engine.Evaluate("typeof third"));
+            Assert.AreEqual("object", engine.Evaluate("typeof Math"));
+
+            var bag = new PropertyBag();
+            engine.AddHostObject("bar", HostItemFlags.GlobalMembers, bag);
+            Assert.AreEqual(456, engine.Evaluate("second"));
+
+            bag["second"] = 789;
+            bag["third"] = 987;
+            Assert.AreEqual(123, engine.Evaluate("first"));
+            Assert.AreEqual(789, engine.Evaluate("second"));
+            Assert.AreEqual(987, engine.Evaluate("third"));
+
+            bag.Remove("second");
+            Assert.AreEqual(456, engine.Evaluate("second"));
+
+            engine.AddHostObject("baz", HostItemFlags.GlobalMembers, new { first = 321 });
+            Assert.AreEqual(321, engine.Evaluate("first"));
+        }
+
         [TestMethod, TestCategory("V8ScriptEngine")]
         [ExpectedException(typeof(ScriptEngineException))]
         public void V8ScriptEngine_AddHostObject_DefaultAccess()
@@ -795,6 +820,33 @@ namespace Microsoft.ClearScript.Test
             // ReSharper restore RedundantAssignment
         }
 
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_CollectGarbage_HostObject_Batch()
+        {
+            const int count = 4096;
+            var weakRefs = new WeakReference[count];
+
+            new Action(() =>
+            {
+                var objects = new object[count];
+                for (var index = 0; index < count; index++)
+                {
+                    objects[index] = new object();
+                    weakRefs[index] = new WeakReference(objects[index]);
+                }
+
+                engine.Script.objects = objects;
+                engine.Execute("wrappers = []; for (let i = 0; i < objects.Length; i++) wrappers.push(objects[i]); objects = null;");
+            })();
+
+            engine.Execute("wrappers = null");
+            engine.CollectGarbage(true);
+
+            GC.Collect(GC.MaxGeneration, GCCollectionMode.Forced);
+            GC.WaitForPendingFinalizers();
+            Assert.IsFalse(weakRefs.Any(wr => wr.IsAlive));
+        }
+
         [TestMethod, TestCategory("V8ScriptEngine")]
         public void V8ScriptEngine_Parallel()
         {
@@ -2400,6 +2452,23 @@ namespace Microsoft.ClearScript.Test
             TestUtil.AssertException<ScriptEngineException>(() => engine.Evaluate("new (bar.toFunction())()"));
         }
 
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_toFunction_Delegate_Cached()
+        {
+            var foo = new Func<int, double>(arg => arg * Math.PI);
+            engine.Script.foo = foo;
+            Assert.IsTrue((bool)engine.Evaluate("foo.toFunction() === foo.toFunction()"));
+
+            engine.Execute("fooFunction = foo.toFunction()");
+            engine.Script.foo = foo;
+            Assert.IsTrue((bool)engine.Evaluate("foo.toFunction() === fooFunction"));
+            Assert.AreEqual(789 * Math.PI, engine.Evaluate("fooFunction(789)"));
+
+            engine.Script.bar = new Func<int, double>(arg => arg * Math.E);
+            Assert.IsFalse((bool)engine.Evaluate("bar.toFunction() === fooFunction"));
+            Assert.AreEqual(789 * Math.E, engine.Evaluate("bar.toFunction()(789)"));
+        }
+
         [TestMethod, TestCategory("V8ScriptEngine")]
         public void V8ScriptEngine_toFunction_Method()
         {
@@ -2468,6 +2537,49 @@ namespace Microsoft.ClearScript.Test
             }
         }
 
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_Iteration_Chunked()
+        {
+            var list = Enumerable.Range(0, 1000).ToList();
+            engine.Script.list = list;
+            Assert.AreEqual(list.Sum(), engine.Evaluate("let sum = 0; for (let item of list) sum += item; sum"));
+            Assert.AreEqual(list.Count, engine.Evaluate("Array.from(list).length"));
+            Assert.AreEqual(5, engine.Evaluate("let count = 0; for (let item of list) { if (++count === 5) break; } count"));
+
+            var source = TestEnumerable.Create(Enumerable.Range(0, 100).Select(index => index.ToString()).ToArray());
+            engine.AddRestrictedHostObject("source", source);
+            Assert.AreEqual("0123", engine.Evaluate("let result = ''; for (let item of source) { if (item === '4') break; result += item; } result"));
+            Assert.AreEqual(1, ((TestEnumerable.IDisposableEnumeratorFactory)source).DisposedEnumeratorCount);
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_Iteration_Chunked_Lazy()
+        {
+            var fetchCount = 0;
+
+            IEnumerable<int> Generate()
+            {
+                for (var index = 0; index < 100; index++)
+                {
+                    ++fetchCount;
+                    if (index == 10)
+                    {
+                        throw new InvalidOperationException("Lazy enumeration failed");
+                    }
+
+                    yield return index;
+                }
+            }
+
+            engine.Script.generate = new Func<IEnumerable<int>>(Generate);
+            Assert.AreEqual(5, engine.Evaluate("let count = 0; for (let item of generate()) { if (++count === 5) break; } count"));
+            Assert.AreEqual(5, fetchCount);
+
+            fetchCount = 0;
+            Assert.AreEqual(10, engine.Evaluate("let seen = 0; try { for (let item of generate()) ++seen; } catch (exception) { } seen"));
+            Assert.AreEqual(11, fetchCount);
+        }
+
         [TestMethod, TestCategory("V8ScriptEngine")]
         public void V8ScriptEngine_Iteration_GlobalRenaming()
         {
@@ -3100,6 +3212,32 @@ namespace Microsoft.ClearScript.Test
             Assert.IsTrue(result.IndexOf("blah", StringComparison.Ordinal) >= 0);
         }
 
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_AsyncIteration_AsyncEnumerable_Chunked()
+        {
+            var items = Enumerable.Range(0, 1000).Select(index => index.ToString()).ToArray();
+            var source = TestEnumerable.CreateAsync(items);
+
+            engine.Script.done = new ManualResetEventSlim();
+            engine.AddRestrictedHostObject("source", source);
+            engine.Execute(@"
+                count = 0;
+                result = '';
+                (async function () {
+                    for await (let item of source) {
+                        ++count;
+                        result += item;
+                    }
+                    done.Set();
+                })();
+            ");
+            engine.Script.done.Wait();
+
+            Assert.AreEqual(items.Length, engine.Script.count);
+            Assert.AreEqual(string.Concat(items), engine.Script.result);
+            Assert.AreEqual(1, ((TestEnumerable.IDisposableEnumeratorFactory)source).DisposedEnumeratorCount);
+        }
+
         [TestMethod, TestCategory("V8ScriptEngine")]
         public void V8ScriptEngine_AsyncIteration_List_GlobalRenaming()
         {
@@ -5033,6 +5171,147 @@ namespace Microsoft.ClearScript.Test
             TestUtil.AssertException<InvalidOperationException>(() => engine.Evaluate("JSON.stringify(hostObject)"));
         }
 
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_ParseJson()
+        {
+            const string json = "{\"foo\":123,\"bar\":\"baz\",\"qux\":[456.789,null,true],\"quux\":\"\u00E9t\u00E9\"}";
+
+            engine.Script.result = engine.ParseJson(json);
+            Assert.AreEqual(json, engine.Evaluate("JSON.stringify(result)"));
+
+            engine.Script.result = engine.ParseJson(Encoding.UTF8.GetBytes(json));
+            Assert.AreEqual(json, engine.Evaluate("JSON.stringify(result)"));
+
+            Assert.AreEqual(123, engine.ParseJson("123"));
+            Assert.AreEqual("foo", engine.ParseJson(Encoding.UTF8.GetBytes("\"foo\"")));
+            Assert.IsNull(engine.ParseJson("null"));
+
+            TestUtil.AssertException<ScriptEngineException>(() => engine.ParseJson("{ foo: 123 }"));
+            TestUtil.AssertException<ScriptEngineException>(() => engine.ParseJson(Encoding.UTF8.GetBytes("[1, 2")));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_ExecuteBatch()
+        {
+            var obj = (ScriptObject)engine.Evaluate("({ foo: 123, add(a, b) { return a + b; }, fail() { throw new RangeError('oops'); } })");
+            var function = (ScriptObject)engine.Evaluate("(function (x) { return x * 2; })");
+
+            var batch = new V8Batch();
+            batch.SetProperty(obj, "bar", "baz");
+            batch.GetProperty(obj, "foo");
+            batch.InvokeMethod(obj, "fail");
+            batch.InvokeMethod(obj, "add", 2, 3);
+            batch.DeleteProperty(obj, "foo");
+            batch.Invoke(function, 21);
+            batch.InvokeMethod(obj, "missing");
+            Assert.AreEqual(7, batch.Count);
+
+            var results = engine.ExecuteBatch(batch);
+            Assert.AreEqual(7, results.Count);
+
+            Assert.IsTrue(results[0].Succeeded);
+            Assert.IsInstanceOfType(results[0].Value, typeof(Undefined));
+            Assert.AreEqual("baz", obj.GetProperty("bar"));
+
+            Assert.IsTrue(results[1].Succeeded);
+            Assert.AreEqual(123, results[1].Value);
+
+            Assert.IsFalse(results[2].Succeeded);
+            Assert.IsTrue(results[2].ErrorMessage.Contains("oops"));
+            Assert.AreEqual("RangeError", ((dynamic)results[2].Value).name);
+
+            Assert.IsTrue(results[3].Succeeded);
+            Assert.AreEqual(5, results[3].Value);
+
+            Assert.IsTrue(results[4].Succeeded);
+            Assert.AreEqual(true, results[4].Value);
+            Assert.IsInstanceOfType(obj.GetProperty("foo"), typeof(Undefined));
+
+            Assert.IsTrue(results[5].Succeeded);
+            Assert.AreEqual(42, results[5].Value);
+
+            Assert.IsFalse(results[6].Succeeded);
+            Assert.AreEqual("TypeError", ((dynamic)results[6].Value).name);
+
+            using (var otherEngine = new V8ScriptEngine())
+            {
+                TestUtil.AssertException<ArgumentException>(() => otherEngine.ExecuteBatch(batch));
+            }
+
+            batch.Clear();
+            Assert.AreEqual(0, engine.ExecuteBatch(batch).Count);
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_InteropStatistics()
+        {
+            engine.Script.bag = new PropertyBag();
+            engine.Execute("function test(count) { for (let i = 0; i < count; i++) bag.foo = i; }");
+
+            V8InteropStatistics.Reset();
+            V8InteropStatistics.Enabled = true;
+            try
+            {
+                engine.Script.test(100);
+            }
+            finally
+            {
+                V8InteropStatistics.Enabled = false;
+            }
+
+            var statistics = V8InteropStatistics.Capture();
+
+            var managedEntry = statistics.Entries.Single(entry => (entry.Kind == V8InteropStatistics.EntryKind.ManagedMethod) && (entry.Name == "SetHostObjectNamedProperty"));
+            Assert.IsTrue(managedEntry.CallCount >= 100);
+            Assert.AreEqual(32, managedEntry.LatencyHistogram.Count);
+
+            var nativeEntry = statistics.Entries.Single(entry => (entry.Kind == V8InteropStatistics.EntryKind.NativeEntryPoint) && (entry.Name == "V8Object_InvokeMethod"));
+            Assert.IsTrue(nativeEntry.CallCount >= 1);
+
+            engine.Script.test(100);
+            Assert.AreEqual(managedEntry.CallCount, V8InteropStatistics.Capture().Entries.Single(entry => entry.Name == managedEntry.Name).CallCount);
+
+            V8InteropStatistics.Reset();
+            Assert.IsFalse(V8InteropStatistics.Capture().Entries.Any(entry => entry.Name == managedEntry.Name));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_InteropTrace()
+        {
+            engine.Script.bag = new PropertyBag();
+
+            V8InteropTrace.Clear();
+            V8InteropTrace.Enabled = true;
+            try
+            {
+                engine.Execute("for (let i = 0; i < 10; i++) bag.foo = i;");
+                engine.CollectGarbage(true);
+            }
+            finally
+            {
+                V8InteropTrace.Enabled = false;
+            }
+
+            string json;
+            using (var stream = new MemoryStream())
+            {
+                V8InteropTrace.WriteJson(stream);
+                json = Encoding.UTF8.GetString(stream.ToArray());
+            }
+
+            engine.Script.trace = engine.Script.JSON.parse(json);
+            Assert.IsTrue((bool)engine.Evaluate("trace.traceEvents.some(event => (event.name === 'Execute') && (event.cat === 'execution') && (event.ph === 'B'))"));
+            Assert.AreEqual(10, engine.Evaluate("trace.traceEvents.filter(event => (event.name === 'SetHostObjectNamedProperty') && (event.ph === 'E')).length"));
+            Assert.IsTrue((bool)engine.Evaluate("trace.traceEvents.some(event => event.cat === 'gc')"));
+
+            V8InteropTrace.Clear();
+            using (var stream = new MemoryStream())
+            {
+                V8InteropTrace.WriteJson(stream);
+                Assert.AreEqual("{\"traceEvents\":[],\"displayTimeUnit\":\"ns\"}", Encoding.UTF8.GetString(stream.ToArray()));
+            }
+        }
+
         [TestMethod, TestCategory("V8ScriptEngine")]
         public void V8ScriptEngine_TotalExternalSize()
         {
@@ -5840,6 +6119,419 @@ namespace Microsoft.ClearScript.Test
             Assert.IsTrue(Convert.ToBoolean(engine.Evaluate("array[3][2] === array")));
         }
 
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_StringArgumentExport()
+        {
+            var latin1 = "caf\u00E9 na\u00EFve \u00FF";
+            var utf16 = "snow \u2603 and \uD83D\uDE00";
+            var large = new string('x', 1024 * 1024) + "\u00E9";
+            var consString = string.Concat(Enumerable.Repeat("ab\u03A9", 1000));
+
+            engine.Script.latin1 = latin1;
+            engine.Script.utf16 = utf16;
+            engine.Script.large = large;
+            engine.Script.concat = new Func<object, object, object, object, object, string>((a, b, c, d, e) => string.Concat(a, b, c, d, e));
+            engine.Execute("consString = ''; for (let i = 0; i < 1000; i++) consString += 'ab\u03A9';");
+
+            Assert.AreEqual(latin1 + 123 + utf16 + string.Empty + consString, engine.Evaluate("concat(latin1, 123, utf16, '', consString)"));
+            Assert.AreEqual(large + large.Length, engine.Evaluate("concat(large, large.length)"));
+
+            var bag = new PropertyBag();
+            engine.Script.bag = bag;
+            engine.Execute("bag.latin1 = latin1; bag.utf16 = utf16; bag.large = large; bag.consString = consString; bag.empty = ''");
+            Assert.AreEqual(latin1, bag["latin1"]);
+            Assert.AreEqual(utf16, bag["utf16"]);
+            Assert.AreEqual(large, bag["large"]);
+            Assert.AreEqual(consString, bag["consString"]);
+            Assert.AreEqual(string.Empty, bag["empty"]);
+
+            var array = new object[4];
+            engine.Script.array = array;
+            engine.Execute("array[0] = latin1; array[1] = utf16; array[2] = consString; array[3] = ''");
+            Assert.AreEqual(latin1, array[0]);
+            Assert.AreEqual(utf16, array[1]);
+            Assert.AreEqual(consString, array[2]);
+            Assert.AreEqual(string.Empty, array[3]);
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_OneByteStrings()
+        {
+            const string latin1 = "caf\u00E9 \u00A0\u00FF";
+            const string utf16 = "caf\u00E9 \u2603";
+
+            var bag = new PropertyBag();
+            engine.Script.bag = bag;
+            engine.Execute($"bag['{latin1}'] = '{latin1}'; bag['{utf16}'] = '{utf16}'; bag.ascii = 'foo'");
+            Assert.AreEqual(latin1, bag[latin1]);
+            Assert.AreEqual(utf16, bag[utf16]);
+            Assert.AreEqual("foo", bag["ascii"]);
+
+            Assert.AreEqual(latin1, engine.Evaluate($"'{latin1}'"));
+            Assert.AreEqual(utf16, engine.Evaluate($"'{utf16}'"));
+            Assert.AreEqual(latin1 + utf16, engine.Evaluate($"'{latin1}' + '{utf16}'"));
+
+            engine.Script.echo = new Func<string, string>(value => value);
+            Assert.IsTrue(Convert.ToBoolean(engine.Evaluate($"echo('{latin1}') === '{latin1}'")));
+            Assert.IsTrue(Convert.ToBoolean(engine.Evaluate($"echo('{utf16}') === '{utf16}'")));
+            Assert.IsTrue(Convert.ToBoolean(engine.Evaluate($"Object.keys(bag).includes('{latin1}')")));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_PropertyNameCache()
+        {
+            engine.Script.bag = new PropertyBag { ["foo"] = 0 };
+            engine.Execute("bag.foo = bag.foo");
+
+            var statistics = engine.GetStatistics();
+            var hitCount = statistics.PropertyNameCacheHitCount;
+            var missCount = statistics.PropertyNameCacheMissCount;
+
+            engine.Execute("for (let i = 0; i < 100; i++) bag.foo = bag.foo + 1");
+            Assert.AreEqual(101, engine.Evaluate("bag.foo"));
+
+            statistics = engine.GetStatistics();
+            Assert.IsTrue(statistics.PropertyNameCacheHitCount - hitCount >= 200);
+            Assert.AreEqual(missCount, statistics.PropertyNameCacheMissCount);
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_StringCache()
+        {
+            engine.Script.bag = new PropertyBag { ["foo"] = "bar" };
+            engine.Execute("let test = () => { let count = 0; for (let i = 0; i < 100; i++) { if (bag.foo === 'bar') count++; } return count; }");
+
+            var statistics = engine.GetRuntimeStatistics();
+            var hitCount = statistics.StringCacheHitCount;
+            var missCount = statistics.StringCacheMissCount;
+
+            Assert.AreEqual(100, engine.Evaluate("test()"));
+
+            statistics = engine.GetRuntimeStatistics();
+            Assert.AreEqual(hitCount, statistics.StringCacheHitCount);
+            Assert.AreEqual(missCount, statistics.StringCacheMissCount);
+
+            engine.MaxRuntimeStringCacheSize = (UIntPtr)16;
+            Assert.AreEqual(100, engine.Evaluate("test()"));
+
+            statistics = engine.GetRuntimeStatistics();
+            Assert.AreEqual(hitCount + 99, statistics.StringCacheHitCount);
+            Assert.AreEqual(missCount + 1, statistics.StringCacheMissCount);
+
+            engine.Script.bag["foo"] = new string('x', 1024);
+            Assert.AreEqual(0, engine.Evaluate("test()"));
+
+            statistics = engine.GetRuntimeStatistics();
+            Assert.AreEqual(hitCount + 99, statistics.StringCacheHitCount);
+            Assert.AreEqual(missCount + 1, statistics.StringCacheMissCount);
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_NamedPropertyBatch()
+        {
+            var obj = (V8ScriptItem)engine.Evaluate("obj = { a: 123, b: 'foo', c: { d: 456 } }");
+
+            var values = obj.GetProperties(new[] { "a", "b", "c", "x" });
+            Assert.AreEqual(4, values.Length);
+            Assert.AreEqual(123, values[0]);
+            Assert.AreEqual("foo", values[1]);
+            Assert.AreEqual(456, ((ScriptObject)values[2]).GetProperty("d"));
+            Assert.IsInstanceOfType(values[3], typeof(Undefined));
+
+            obj.SetProperties(new[] { "a", "x" }, new object[] { 789, "bar" });
+            Assert.AreEqual(789, engine.Evaluate("obj.a"));
+            Assert.AreEqual("bar", engine.Evaluate("obj.x"));
+
+            var dictionary = (IDictionary<string, object>)obj;
+            Assert.IsTrue(dictionary.Values.SequenceEqual(new object[] { 789, "foo", values[2], "bar" }));
+
+            TestUtil.AssertException<ArgumentException>(() => obj.SetProperties(new[] { "a" }, new object[] { 1, 2 }));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_ArrayExport()
+        {
+            engine.Dispose();
+            engine = new V8ScriptEngine(V8ScriptEngineFlags.EnableDebugging | V8ScriptEngineFlags.EnableArrayConversion);
+
+            var array = (object[])engine.Evaluate("Array.from({ length: 1000 }, (x, i) => i - 500)");
+            Assert.AreEqual(1000, array.Length);
+            Assert.IsTrue(array.Select((value, index) => Equals(value, index - 500)).All(result => result));
+
+            array = (object[])engine.Evaluate("[ 1, 2.5, -3, Math.PI, -0 ]");
+            Assert.AreEqual(5, array.Length);
+            Assert.AreEqual(1, array[0]);
+            Assert.AreEqual(2.5, array[1]);
+            Assert.AreEqual(-3, array[2]);
+            Assert.AreEqual(Math.PI, array[3]);
+
+            array = (object[])engine.Evaluate("[ 1, 2, 'foo', [ 3.5, 4 ], , true ]");
+            Assert.AreEqual(6, array.Length);
+            Assert.AreEqual(1, array[0]);
+            Assert.AreEqual(2, array[1]);
+            Assert.AreEqual("foo", array[2]);
+            Assert.IsTrue(((object[])array[3]).SequenceEqual(new object[] { 3.5, 4 }));
+            Assert.IsInstanceOfType(array[4], typeof(Undefined));
+            Assert.AreEqual(true, array[5]);
+
+            array = (object[])engine.Evaluate("[]");
+            Assert.AreEqual(0, array.Length);
+
+            array = (object[])engine.Evaluate("(() => { const a = [ 1, 2.5 ]; a[1024 * 1024] = 'foo'; return a; })()");
+            Assert.AreEqual(1024 * 1024 + 1, array.Length);
+            Assert.AreEqual(1, array[0]);
+            Assert.AreEqual(2.5, array[1]);
+            Assert.IsInstanceOfType(array[2], typeof(Undefined));
+            Assert.AreEqual("foo", array[1024 * 1024]);
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_BulkConstruction()
+        {
+            engine.Script.foo = engine.CreateScriptObject(new[] { "a", "b", "c" }, new object[] { 123, "bar", 4.5 });
+            Assert.AreEqual("{\"a\":123,\"b\":\"bar\",\"c\":4.5}", engine.Evaluate("JSON.stringify(foo)"));
+            Assert.AreEqual("a,b,c", engine.Evaluate("Object.keys(foo).join()"));
+
+            engine.Script.foo = engine.CreateScriptObject(new[] { "1", "\u00E9t\u00E9", "x", "x" }, new object[] { 1, 2, 3, 4 });
+            Assert.AreEqual("{\"1\":1,\"\u00E9t\u00E9\":2,\"x\":4}", engine.Evaluate("JSON.stringify(foo)"));
+
+            engine.Script.foo = engine.CreateScriptObject(new string[0], new object[0]);
+            Assert.AreEqual("{}", engine.Evaluate("JSON.stringify(foo)"));
+
+            TestUtil.AssertException<ArgumentException>(() => engine.CreateScriptObject(new[] { "a" }, new object[] { 1, 2 }));
+
+            engine.Dispose();
+            engine = new V8ScriptEngine(V8ScriptEngineFlags.EnableDebugging | V8ScriptEngineFlags.EnableArrayConversion);
+
+            var array = new object[] { 1, "foo", null, new object[] { 2.5, "bar" } };
+            engine.Script.array = array;
+            Assert.AreEqual("[1,\"foo\",null,[2.5,\"bar\"]]", engine.Evaluate("JSON.stringify(array)"));
+
+            var nestedArray = new object[2];
+            array = new object[] { nestedArray };
+            nestedArray[0] = array;
+            nestedArray[1] = nestedArray;
+            engine.Script.array = array;
+            Assert.IsTrue(Convert.ToBoolean(engine.Evaluate("array[0][0] === array")));
+            Assert.IsTrue(Convert.ToBoolean(engine.Evaluate("array[0][1] === array[0]")));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_StructuredClone()
+        {
+            var obj = engine.Evaluate(@"
+                sharedBuffer = new SharedArrayBuffer(16);
+                ({ foo: 123, bar: [ 'baz', 4.5, { qux: true } ], map: new Map([[ 1, 'one' ]]), bytes: new Uint8Array([ 1, 2, 3 ]), shared: new Int32Array(sharedBuffer) })
+            ");
+
+            using (var value = engine.Serialize(obj))
+            {
+                Assert.IsTrue(value.Size > 0);
+
+                using (var otherEngine = new V8ScriptEngine())
+                {
+                    otherEngine.Script.obj = otherEngine.Deserialize(value);
+                    Assert.AreEqual(123, otherEngine.Evaluate("obj.foo"));
+                    Assert.AreEqual("baz,4.5,true", otherEngine.Evaluate("[ obj.bar[0], obj.bar[1], obj.bar[2].qux ].join()"));
+                    Assert.AreEqual("one", otherEngine.Evaluate("obj.map.get(1)"));
+                    Assert.AreEqual("1,2,3", otherEngine.Evaluate("obj.bytes.join()"));
+
+                    otherEngine.Execute("obj.shared[2] = 456");
+                    Assert.AreEqual(456, engine.Evaluate("new Int32Array(sharedBuffer)[2]"));
+                }
+
+                engine.Script.obj = obj;
+                engine.Script.copy = engine.Deserialize(value);
+                Assert.IsFalse(Convert.ToBoolean(engine.Evaluate("copy === obj")));
+                Assert.AreEqual(123, engine.Evaluate("copy.foo"));
+            }
+
+            TestUtil.AssertException<ScriptEngineException>(() => engine.Serialize(engine.Evaluate("({ foo: () => 123 })")));
+            TestUtil.AssertException<ArgumentException>(() => engine.Serialize(123));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_ObjectIdentityCache()
+        {
+            engine.Dispose();
+            engine = new V8ScriptEngine(V8ScriptEngineFlags.EnableDebugging | V8ScriptEngineFlags.EnableObjectIdentityCache);
+
+            engine.Execute("objects = Array.from({ length: 100 }, (x, i) => ({ value: i }))");
+            var objects = (ScriptObject)engine.Script.objects;
+
+            var statistics = engine.GetStatistics();
+            var hitCount = statistics.ObjectIdentityCacheHitCount;
+
+            var first = Enumerable.Range(0, 100).Select(index => (ScriptObject)objects[index]).ToArray();
+            var second = Enumerable.Range(0, 100).Select(index => (ScriptObject)objects[index]).ToArray();
+            Assert.IsTrue(Enumerable.Range(0, 100).All(index => first[index].Equals(second[index]) && Equals(second[index]["value"], index)));
+
+            statistics = engine.GetStatistics();
+            Assert.IsTrue(statistics.ObjectIdentityCacheHitCount - hitCount >= 100);
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_HostObjectTypeTemplates()
+        {
+            engine.Dispose();
+            engine = new V8ScriptEngine(V8ScriptEngineFlags.EnableDebugging | V8ScriptEngineFlags.EnableHostObjectTypeTemplates);
+
+            engine.Script.objects = Enumerable.Range(0, 10).Select(index => new GeneralTestObject("Name" + index, index)).ToArray();
+
+            Assert.AreEqual(45, engine.Evaluate("(function () { let sum = 0; for (let i = 0; i < objects.Length; i++) sum += objects[i].Age; return sum; })()"));
+            Assert.AreEqual("Name3", engine.Evaluate("objects[3].Name"));
+            Assert.IsTrue((bool)engine.Evaluate("'Age' in objects[0]"));
+            Assert.IsTrue((bool)engine.Evaluate("objects[0].ToString === objects[0].ToString"));
+
+            engine.Execute("objects[5].Age = 123");
+            Assert.AreEqual(123, ((GeneralTestObject[])engine.Script.objects)[5].Age);
+
+            TestUtil.AssertException<ScriptEngineException>(() => engine.Execute("objects[5].Age = 'bogus'"));
+            Assert.AreEqual(123, ((GeneralTestObject[])engine.Script.objects)[5].Age);
+
+            var names = (string)engine.Evaluate("Object.keys(objects[0]).sort().join(',')");
+            Assert.IsTrue(names.Contains("Age") && names.Contains("Name"));
+
+            // type template members are non-configurable native data properties; interceptor-backed members are configurable
+            Assert.IsFalse((bool)engine.Evaluate("Object.getOwnPropertyDescriptor(objects[0], 'Age').configurable"));
+
+            using (var plainEngine = new V8ScriptEngine())
+            {
+                plainEngine.Script.obj = new GeneralTestObject("Name", 0);
+                Assert.IsTrue((bool)plainEngine.Evaluate("Object.getOwnPropertyDescriptor(obj, 'Age').configurable"));
+            }
+
+            // extension methods named like Object.prototype members must not be hidden by the prototype chain
+            engine.AddHostType(typeof(GeneralTestObjectExtensions));
+            engine.Script.extended = new GeneralTestObject("Extended", 4);
+            Assert.AreEqual(4, engine.Evaluate("extended.valueOf()"));
+            Assert.AreEqual(14, engine.Evaluate("extended + 10"));
+            Assert.IsTrue((bool)engine.Evaluate("extended.hasOwnProperty === Object.prototype.hasOwnProperty"));
+            Assert.IsTrue((bool)engine.Evaluate("extended.toJSON === Object.getPrototypeOf(extended).toJSON"));
+
+            // only names that the type or its extension methods define get accessors
+            Assert.IsFalse((bool)engine.Evaluate("Object.getOwnPropertyNames(extended).includes('hasOwnProperty')"));
+            Assert.IsTrue((bool)engine.Evaluate("Object.getOwnPropertyNames(extended).includes('valueOf')"));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_FastFunction()
+        {
+            var count = 0;
+            engine.AddFastFunction("add", (int x, int y) => x + y);
+            engine.AddFastFunction("scale", (double x, double factor) => x * factor);
+            engine.AddFastFunction("isLong", (string value, int length) => value.Length > length);
+            engine.AddFastFunction("tick", () => { ++count; });
+            engine.AddFastFunction("fail", (int x) => x > 0 ? throw new InvalidOperationException("Fast function failure") : x);
+
+            Assert.AreEqual(4950, engine.Evaluate("(function () { let sum = 0; for (let i = 0; i < 100; i++) sum = add(sum, i); return sum; })()"));
+            Assert.AreEqual(7.5, engine.Evaluate("scale(2.5, 3)"));
+            Assert.AreEqual(true, engine.Evaluate("isLong('foobar', 3)"));
+            Assert.AreEqual(false, engine.Evaluate("isLong('\u0444\u0443', 3)"));
+            Assert.AreEqual(2, engine.Evaluate("add.length"));
+
+            // run long enough for the optimizing compiler to replace the calls with fast calls
+
+            var fastCallCount = engine.GetStatistics().FastFunctionCallCount;
+            engine.Execute("(function () { for (let i = 0; i < 1000000; i++) tick(); })()");
+            Assert.AreEqual(1000000, count);
+            Assert.IsTrue(engine.GetStatistics().FastFunctionCallCount > fastCallCount);
+
+            Assert.AreEqual(0, engine.Evaluate("fail(0)"));
+            TestUtil.AssertException<ScriptEngineException>(() => engine.Execute("fail(1)"));
+            Assert.IsTrue((bool)engine.Evaluate("(function () { try { fail(1); return false; } catch (exception) { return exception.message.includes('Fast function failure'); } })()"));
+
+            TestUtil.AssertException<ArgumentException>(() => engine.AddFastFunction("bogus", (object value) => 0));
+            TestUtil.AssertException<ArgumentException>(() => engine.AddFastFunction("bogus", () => "foo"));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_FastFunction_Reentry()
+        {
+            engine.AddFastFunction("reenter", (int x) => Convert.ToInt32(engine.Evaluate("x")));
+            engine.Execute("x = 123");
+
+            // reentry must fail the call rather than the process, on both the slow and fast paths
+
+            Assert.IsTrue((bool)engine.Evaluate("(function () { try { reenter(0); return false; } catch (exception) { return exception.message.includes('fast function'); } })()"));
+            Assert.IsTrue((bool)engine.Evaluate("(function () { let failed = 0; for (let i = 0; i < 100000; i++) { try { reenter(i); } catch (exception) { ++failed; } } return failed === 100000; })()"));
+            Assert.AreEqual(123, engine.Evaluate("x"));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_InvalidateHostMemberCache()
+        {
+            var obj = new ReadOnlyFieldTest(123, 456);
+            engine.Script.obj = obj;
+            Assert.AreEqual(123, engine.Evaluate("obj.A"));
+            Assert.AreEqual(456, engine.Evaluate("obj.B"));
+
+            typeof(ReadOnlyFieldTest).GetField("A").SetValue(obj, 789);
+            typeof(ReadOnlyFieldTest).GetField("B").SetValue(obj, 987);
+            Assert.AreEqual(123, engine.Evaluate("obj.A"));
+            Assert.AreEqual(456, engine.Evaluate("obj.B"));
+
+            engine.InvalidateHostMemberCache("A");
+            Assert.AreEqual(789, engine.Evaluate("obj.A"));
+            Assert.AreEqual(456, engine.Evaluate("obj.B"));
+
+            engine.AccessContext = typeof(V8ScriptEngineTest);
+            Assert.AreEqual(789, engine.Evaluate("obj.A"));
+            Assert.AreEqual(987, engine.Evaluate("obj.B"));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_HostObjectPropertyNameCache()
+        {
+            engine.Script.foo = new ReadOnlyFieldTest(123, 456);
+            engine.Script.bar = new ReadOnlyFieldTest(789, 987);
+
+            Assert.AreEqual("A,B", engine.Evaluate("Object.keys(foo).filter(key => key.length === 1).sort().join()"));
+            Assert.AreEqual("A,B", engine.Evaluate("Object.keys(bar).filter(key => key.length === 1).sort().join()"));
+            Assert.IsTrue((bool)engine.Evaluate("Object.keys(foo).includes('ToString')"));
+            Assert.IsTrue((bool)engine.Evaluate("'A' in foo"));
+            Assert.IsFalse((bool)engine.Evaluate("'C' in foo"));
+            Assert.AreEqual("{\"A\":789,\"B\":987}", engine.Evaluate("JSON.stringify(bar, ['A', 'B'])"));
+
+            engine.SuppressInstanceMethodEnumeration = true;
+            Assert.AreEqual("A,B", engine.Evaluate("Object.keys(foo).sort().join()"));
+            Assert.AreEqual("A,B", engine.Evaluate("Object.keys(bar).sort().join()"));
+
+            engine.SuppressInstanceMethodEnumeration = false;
+            Assert.IsTrue((bool)engine.Evaluate("Object.keys(bar).includes('ToString')"));
+
+            engine.Script.list = new List<int> { 123 };
+            Assert.IsFalse((bool)engine.Evaluate("Object.keys(list).includes('Select')"));
+            engine.AddHostType(typeof(Enumerable));
+            Assert.IsTrue((bool)engine.Evaluate("Object.keys(list).includes('Select')"));
+
+            engine.SuppressExtensionMethodEnumeration = true;
+            Assert.IsFalse((bool)engine.Evaluate("Object.keys(list).includes('Select')"));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_HostObjectWrapperCache()
+        {
+            var foo = new PropertyBag { ["A"] = 123 };
+            var bar = new Func<int, int>(arg => arg * 2);
+            engine.Script.getFoo = new Func<object>(() => foo);
+            engine.Script.getBar = new Func<object>(() => bar);
+
+            Assert.IsTrue((bool)engine.Evaluate("getFoo() === getFoo()"));
+            Assert.IsTrue((bool)engine.Evaluate("getBar() === getBar()"));
+            Assert.IsFalse((bool)engine.Evaluate("getFoo() === getBar()"));
+            Assert.AreEqual(246, engine.Evaluate("getBar()(getFoo().A)"));
+
+            engine.Execute("savedFoo = getFoo()");
+            engine.CollectGarbage(true);
+            Assert.IsTrue((bool)engine.Evaluate("getFoo() === savedFoo"));
+
+            engine.Execute("savedFoo = undefined");
+            engine.CollectGarbage(true);
+            Assert.AreEqual(123, engine.Evaluate("getFoo().A"));
+            Assert.IsTrue((bool)engine.Evaluate("getFoo() === getFoo()"));
+        }
+
         // ReSharper restore InconsistentNaming
 
         #endregion
@@ -6207,6 +6899,18 @@ namespace Microsoft.ClearScript.Test
             }
         }
 
+        public class ReadOnlyFieldTest
+        {
+            public readonly int A;
+            public readonly int B;
+
+            public ReadOnlyFieldTest(int a, int b)
+            {
+                A = a;
+                B = b;
+            }
+        }
+
         public class SingleThreadSynchronizationContext : SynchronizationContext
         {
             private readonly BlockingCollection<(SendOrPostCallback, object)> queue = new();
@@ -0,0 +1,206 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Arena
+//-----------------------------------------------------------------------------
+
+// Every block is preceded by a header that identifies the arena and chunk that own it, so a
+// block can be freed without knowing where it came from. Each chunk tracks its live blocks and
+// becomes reusable as soon as the last of them is freed, regardless of the order in which blocks
+// are freed. Blocks that the arena can't provide are allocated on the heap with an empty header.
+// An arena belongs to an isolate; an owned block must be freed on a thread that holds that
+// isolate's lock, and before the isolate is destroyed.
+
+class Arena final
+{
+    PROHIBIT_COPY(Arena)
+
+public:
+
+    Arena():
+        m_ChunkIndex(0)
+    {
+    }
+
+    ~Arena()
+    {
+    #ifdef _DEBUG
+        for (const auto& chunk : m_Chunks)
+        {
+            _ASSERTE(chunk.LiveCount < 1);
+        }
+    #endif // _DEBUG
+    }
+
+    void* Allocate(size_t size)
+    {
+        size = HeaderSize + GetAlignedSize(size);
+        if (size > (HeaderSize + Constants::MaxArenaBlockSize))
+        {
+            return nullptr;
+        }
+
+        if ((m_ChunkIndex >= m_Chunks.size()) || ((Constants::ArenaChunkSize - m_Chunks[m_ChunkIndex].Used) < size))
+        {
+            if (!TrySwitchChunk())
+            {
+                return nullptr;
+            }
+        }
+
+        auto& chunk = m_Chunks[m_ChunkIndex];
+        auto pHeader = reinterpret_cast<BlockHeader*>(chunk.upBase.get() + chunk.Used);
+        pHeader->pArena = this;
+        pHeader->ChunkIndex = m_ChunkIndex;
+
+        chunk.Used += size;
+        chunk.LiveCount++;
+        return reinterpret_cast<uint8_t*>(pHeader) + HeaderSize;
+    }
+
+    static void* AllocateUnowned(size_t size)
+    {
+        auto pHeader = static_cast<BlockHeader*>(::calloc(1, HeaderSize + GetAlignedSize(size)));
+        if (pHeader == nullptr)
+        {
+            return nullptr;
+        }
+
+        pHeader->pArena = nullptr;
+        return reinterpret_cast<uint8_t*>(pHeader) + HeaderSize;
+    }
+
+    static const Arena* GetOwner(const void* pvBlock)
+    {
+        return (pvBlock != nullptr) ? GetHeader(pvBlock)->pArena : nullptr;
+    }
+
+    static void Free(const void* pvBlock)
+    {
+        if (pvBlock != nullptr)
+        {
+            auto pHeader = GetHeader(pvBlock);
+            if (pHeader->pArena == nullptr)
+            {
+                ::free(const_cast<BlockHeader*>(pHeader));
+            }
+            else
+            {
+                pHeader->pArena->Release(pHeader->ChunkIndex);
+            }
+        }
+    }
+
+    void Trim()
+    {
+        // release the memory of unused chunks other than the current one
+
+        for (auto chunkIndex : m_FreeChunkIndices)
+        {
+            m_Chunks[chunkIndex].upBase.reset();
+        }
+    }
+
+private:
+
+    struct BlockHeader final
+    {
+        Arena* pArena;
+        size_t ChunkIndex;
+    };
+
+    struct ChunkDeleter final
+    {
+        void operator()(uint8_t* pBase) const
+        {
+            ::free(pBase);
+        }
+    };
+
+    using UniqueChunkPtr = std::unique_ptr<uint8_t, ChunkDeleter>;
+
+    struct Chunk final
+    {
+        UniqueChunkPtr upBase;
+        size_t Used;
+        size_t LiveCount;
+    };
+
+    static const size_t Alignment = alignof(std::max_align_t);
+    static const size_t HeaderSize = (sizeof(BlockHeader) + (Alignment - 1)) & ~(Alignment - 1);
+
+    static const BlockHeader* GetHeader(const void* pvBlock)
+    {
+        return reinterpret_cast<const BlockHeader*>(static_cast<const uint8_t*>(pvBlock) - HeaderSize);
+    }
+
+    static size_t GetAlignedSize(size_t size)
+    {
+        return (std::max(size, static_cast<size_t>(1)) + (Alignment - 1)) & ~(Alignment - 1);
+    }
+
+    bool TrySwitchChunk()
+    {
+        size_t chunkIndex;
+        if (!m_FreeChunkIndices.empty())
+        {
+            chunkIndex = m_FreeChunkIndices.back();
+            if (!m_Chunks[chunkIndex].upBase)
+            {
+                auto pBase = static_cast<uint8_t*>(::malloc(Constants::ArenaChunkSize));
+                if (pBase == nullptr)
+                {
+                    return false;
+                }
+
+                m_Chunks[chunkIndex].upBase.reset(pBase);
+            }
+
+            m_FreeChunkIndices.pop_back();
+        }
+        else
+        {
+            auto pBase = static_cast<uint8_t*>(::malloc(Constants::ArenaChunkSize));
+            if (pBase == nullptr)
+            {
+                return false;
+            }
+
+            chunkIndex = m_Chunks.size();
+            m_Chunks.push_back({ UniqueChunkPtr(pBase), 0, 0 });
+        }
+
+        // the previous chunk stays allocated until its live blocks are freed
+
+        if ((m_ChunkIndex < m_Chunks.size()) && (m_ChunkIndex != chunkIndex) && (m_Chunks[m_ChunkIndex].LiveCount < 1))
+        {
+            m_Chunks[m_ChunkIndex].Used = 0;
+            m_FreeChunkIndices.push_back(m_ChunkIndex);
+        }
+
+        m_ChunkIndex = chunkIndex;
+        return true;
+    }
+
+    void Release(size_t chunkIndex)
+    {
+        auto& chunk = m_Chunks[chunkIndex];
+        _ASSERTE(chunk.LiveCount > 0);
+
+        if (--chunk.LiveCount < 1)
+        {
+            chunk.Used = 0;
+            if (chunkIndex != m_ChunkIndex)
+            {
+                m_FreeChunkIndices.push_back(chunkIndex);
+            }
+        }
+    }
+
+    std::vector<Chunk> m_Chunks;
+    std::vector<size_t> m_FreeChunkIndices;
+    size_t m_ChunkIndex;
+};
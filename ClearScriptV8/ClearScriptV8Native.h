@@ -27,6 +27,10 @@
 #include "HostObjectHolderImpl.h"
 #include "HighResolutionClock.h"
 #include "Timer.h"
+#include "Arena.h"
+#include "V8Instrumentation.h"
+#include "V8SplitProxyStatistics.h"
+#include "V8TraceRecorder.h"
 #include "V8IsolateImpl.h"
 #include "V8ContextImpl.h"
 #include "V8WeakContextBinding.h"
@@ -12,9 +12,12 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
 #include <cmath>
 #include <codecvt>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <list>
@@ -278,4 +281,23 @@ using StdBool = int8_t;
 struct Constants final: StaticBase
 {
     static const size_t MaxInlineArgCount = 16;
+    static const size_t MaxPropertyNameCacheSize = 1024;
+    static const size_t MaxObjectShapeCacheSize = 256;
+    static const size_t MaxObjectShapePropertyCount = 64;
+    static const size_t MaxObjectIdentityCacheSize = 16 * 1024;
+    static const size_t MaxHostObjectTypeTemplateCacheSize = 256;
+    static const size_t MaxHostObjectPropertyNamesCacheSize = 256;
+    static const size_t MaxFastFunctionArgCount = 3;
+    static const size_t MaxHostMemberInvalidationCount = 256;
+    static const size_t MaxHostEnumeratorChunkSize = 256;
+    static const uint32_t MaxArrayExportLength = 1024 * 1024;
+    static const size_t MaxGlobalMemberIndexSize = 1024;
+    static const size_t MaxSplitProxyStatisticsSiteCount = 512;
+    static const size_t MaxTraceEventCount = 64 * 1024;
+    static const size_t EntityHandleSlabChunkSize = 4096;
+    static const size_t MaxEntityHandleSlabChunkCount = 256;
+    static const int MaxCachedStringLength = 64;
+    static const int MinSharedStringLength = 256;
+    static const size_t ArenaChunkSize = 64 * 1024;
+    static const size_t MaxArenaBlockSize = 16 * 1024;
 };
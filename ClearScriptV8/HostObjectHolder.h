@@ -11,11 +11,18 @@ class HostObjectHolder
 {
 public:
 
+    // a holder created without a type ID defers to HostObjectUtil::GetTypeId
+
+    static const int32_t UnknownTypeId = -1;
+
     virtual HostObjectHolder* Clone() const = 0;
 
     virtual void* GetObject() const = 0;
     virtual uint8_t GetSubtype() const = 0;
     virtual uint16_t GetFlags() const = 0;
+    virtual int32_t GetIdentity() const = 0;
+    virtual int32_t GetTypeId() const = 0;
+    virtual void* DetachObject() = 0;
 
     virtual ~HostObjectHolder() {}
 };
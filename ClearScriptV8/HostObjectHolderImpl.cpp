@@ -7,8 +7,10 @@
 // HostObjectHolderImpl implementation
 //-----------------------------------------------------------------------------
 
-HostObjectHolderImpl::HostObjectHolderImpl(void* pvObject, uint8_t subtype, uint16_t flags):
+HostObjectHolderImpl::HostObjectHolderImpl(void* pvObject, int32_t identity, int32_t typeId, uint8_t subtype, uint16_t flags):
     m_pvObject(pvObject),
+    m_Identity(identity),
+    m_TypeId(typeId),
     m_Subtype(subtype),
     m_Flags(flags)
 {
@@ -18,7 +20,7 @@ HostObjectHolderImpl::HostObjectHolderImpl(void* pvObject, uint8_t subtype, uint
 
 HostObjectHolderImpl* HostObjectHolderImpl::Clone() const
 {
-    return new HostObjectHolderImpl(HostObjectUtil::AddRef(m_pvObject), m_Subtype, m_Flags);
+    return new HostObjectHolderImpl(HostObjectUtil::AddRef(m_pvObject), m_Identity, m_TypeId, m_Subtype, m_Flags);
 }
 
 //-----------------------------------------------------------------------------
@@ -37,6 +39,20 @@ uint16_t HostObjectHolderImpl::GetFlags() const
 
 //-----------------------------------------------------------------------------
 
+int32_t HostObjectHolderImpl::GetIdentity() const
+{
+    return m_Identity;
+}
+
+//-----------------------------------------------------------------------------
+
+int32_t HostObjectHolderImpl::GetTypeId() const
+{
+    return m_TypeId;
+}
+
+//-----------------------------------------------------------------------------
+
 void* HostObjectHolderImpl::GetObject() const
 {
     return m_pvObject;
@@ -44,7 +60,19 @@ void* HostObjectHolderImpl::GetObject() const
 
 //-----------------------------------------------------------------------------
 
+void* HostObjectHolderImpl::DetachObject()
+{
+    auto pvObject = m_pvObject;
+    m_pvObject = nullptr;
+    return pvObject;
+}
+
+//-----------------------------------------------------------------------------
+
 HostObjectHolderImpl::~HostObjectHolderImpl()
 {
-    HostObjectUtil::Release(m_pvObject);
+    if (m_pvObject != nullptr)
+    {
+        HostObjectUtil::Release(m_pvObject);
+    }
 }
@@ -13,19 +13,24 @@ class HostObjectHolderImpl final: public HostObjectHolder
 
 public:
 
-    HostObjectHolderImpl(void* pvObject, uint8_t subtype, uint16_t flags);
+    HostObjectHolderImpl(void* pvObject, int32_t identity, int32_t typeId, uint8_t subtype, uint16_t flags);
 
     virtual HostObjectHolderImpl* Clone() const override;
 
     virtual void* GetObject() const override;
     virtual uint8_t GetSubtype() const override;
     virtual uint16_t GetFlags() const override;
+    virtual int32_t GetIdentity() const override;
+    virtual int32_t GetTypeId() const override;
+    virtual void* DetachObject() override;
 
     ~HostObjectHolderImpl();
 
 private:
 
     void* m_pvObject;
+    int32_t m_Identity;
+    int32_t m_TypeId;
     uint8_t m_Subtype;
     uint16_t m_Flags;
 };
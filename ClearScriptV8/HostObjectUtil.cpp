@@ -21,6 +21,13 @@ void HostObjectUtil::Release(void* pvObject)
 
 //-----------------------------------------------------------------------------
 
+void HostObjectUtil::Release(const std::vector<void*>& objectPtrs)
+{
+    V8_SPLIT_PROXY_MANAGED_INVOKE_VOID_NOTHROW(ReleaseHostObjects, objectPtrs);
+}
+
+//-----------------------------------------------------------------------------
+
 HostObjectUtil::Invocability HostObjectUtil::GetInvocability(void* pvObject)
 {
     return V8_SPLIT_PROXY_MANAGED_INVOKE(Invocability, GetHostObjectInvocability, pvObject);
@@ -28,6 +35,20 @@ HostObjectUtil::Invocability HostObjectUtil::GetInvocability(void* pvObject)
 
 //-----------------------------------------------------------------------------
 
+int32_t HostObjectUtil::GetTypeId(void* pvObject)
+{
+    return V8_SPLIT_PROXY_MANAGED_INVOKE(int32_t, GetHostObjectTypeId, pvObject);
+}
+
+//-----------------------------------------------------------------------------
+
+void HostObjectUtil::GetTypeMemberNames(void* pvObject, std::vector<StdString>& names, std::vector<StdString>& extensionMethodNames)
+{
+    V8_SPLIT_PROXY_MANAGED_INVOKE_VOID(GetHostObjectTypeMemberNames, pvObject, names, extensionMethodNames);
+}
+
+//-----------------------------------------------------------------------------
+
 V8Value HostObjectUtil::GetProperty(void* pvObject, const StdString& name, bool& isCacheable)
 {
     V8Value value(V8Value::Nonexistent);
@@ -186,37 +207,38 @@ V8Value HostObjectUtil::GetAsyncEnumerator(void* pvObject)
 
 //-----------------------------------------------------------------------------
 
-void* HostObjectUtil::CreateV8ObjectCache()
+bool HostObjectUtil::GetEnumeratorChunk(void* pvEnumerator, size_t maxCount, std::vector<V8Value>& items)
 {
-    return V8_SPLIT_PROXY_MANAGED_INVOKE_NOTHROW(void*, CreateV8ObjectCache);
-}
+    // The result buffer lives on the stack rather than the heap, and its elements release their
+    // transient storage as soon as this call returns, so streaming a large enumeration doesn't
+    // accumulate memory.
 
-//-----------------------------------------------------------------------------
+    std::array<V8Value::FastResult, Constants::MaxHostEnumeratorChunkSize> results;
+    auto pResults = results.data();
 
-void HostObjectUtil::CacheV8Object(void* pvCache, void* pvObject, void* pvV8Object)
-{
-    V8_SPLIT_PROXY_MANAGED_INVOKE_VOID_NOTHROW(CacheV8Object, pvCache, pvObject, pvV8Object);
-}
-
-//-----------------------------------------------------------------------------
-
-void* HostObjectUtil::GetCachedV8Object(void* pvCache, void* pvObject)
-{
-    return V8_SPLIT_PROXY_MANAGED_INVOKE_NOTHROW(void*, GetCachedV8Object, pvCache, pvObject);
-}
+    maxCount = std::min(maxCount, results.size());
+    auto count = V8_SPLIT_PROXY_MANAGED_INVOKE(int32_t, GetHostEnumeratorChunk, pvEnumerator, static_cast<int32_t>(maxCount), pResults);
+    if (count < 0)
+    {
+        return false;
+    }
 
-//-----------------------------------------------------------------------------
+    items.reserve(count);
+    for (int32_t index = 0; index < count; index++)
+    {
+        items.emplace_back(pResults[index]);
+    }
 
-void HostObjectUtil::GetAllCachedV8Objects(void* pvCache, std::vector<void*>& v8ObjectPtrs)
-{
-    V8_SPLIT_PROXY_MANAGED_INVOKE_VOID_NOTHROW(GetAllCachedV8Objects, pvCache, v8ObjectPtrs);
+    return true;
 }
 
 //-----------------------------------------------------------------------------
 
-bool HostObjectUtil::RemoveV8ObjectCacheEntry(void* pvCache, void* pvObject)
+V8Value HostObjectUtil::FetchAsyncEnumeratorChunk(void* pvEnumerator, size_t maxCount)
 {
-    return V8_SPLIT_PROXY_MANAGED_INVOKE_NOTHROW(StdBool, RemoveV8ObjectCacheEntry, pvCache, pvObject);
+    V8Value result(V8Value::Nonexistent);
+    V8_SPLIT_PROXY_MANAGED_INVOKE_VOID(FetchHostAsyncEnumeratorChunk, pvEnumerator, static_cast<int32_t>(maxCount), result);
+    return result;
 }
 
 //-----------------------------------------------------------------------------
@@ -453,3 +475,10 @@ V8Value FastHostObjectUtil::GetAsyncEnumerator(void* pvObject)
     V8_SPLIT_PROXY_MANAGED_INVOKE_VOID(GetFastHostObjectAsyncEnumerator, pvObject, result);
     return V8Value(result);
 }
+
+//-----------------------------------------------------------------------------
+
+void FastHostObjectUtil::InvokeFunction(void* pvFunction, size_t argCount, const CallValue* pArgs, CallValue& result)
+{
+    V8_SPLIT_PROXY_MANAGED_INVOKE_VOID(InvokeFastHostFunction, pvFunction, static_cast<int32_t>(argCount), pArgs, result);
+}
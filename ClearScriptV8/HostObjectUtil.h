@@ -17,6 +17,7 @@ struct HostObjectUtil final: StaticBase
 {
     static void* AddRef(void* pvObject);
     static void Release(void* pvObject);
+    static void Release(const std::vector<void*>& objectPtrs);
 
     enum class Invocability : int32_t
     {
@@ -28,6 +29,8 @@ struct HostObjectUtil final: StaticBase
     };
 
     static Invocability GetInvocability(void* pvObject);
+    static int32_t GetTypeId(void* pvObject);
+    static void GetTypeMemberNames(void* pvObject, std::vector<StdString>& names, std::vector<StdString>& extensionMethodNames);
 
     static V8Value GetProperty(void* pvObject, const StdString& name, bool& isCacheable);
     static void SetProperty(void* pvObject, const StdString& name, const V8Value& value);
@@ -44,12 +47,8 @@ struct HostObjectUtil final: StaticBase
 
     static V8Value GetEnumerator(void* pvObject);
     static V8Value GetAsyncEnumerator(void* pvObject);
-
-    static void* CreateV8ObjectCache();
-    static void CacheV8Object(void* pvCache, void* pvObject, void* pvV8Object);
-    static void* GetCachedV8Object(void* pvCache, void* pvObject);
-    static void GetAllCachedV8Objects(void* pvCache, std::vector<void*>& v8ObjectPtrs);
-    static bool RemoveV8ObjectCacheEntry(void* pvCache, void* pvObject);
+    static bool GetEnumeratorChunk(void* pvEnumerator, size_t maxCount, std::vector<V8Value>& items);
+    static V8Value FetchAsyncEnumeratorChunk(void* pvEnumerator, size_t maxCount);
 
     enum class DebugDirective
     {
@@ -109,4 +108,29 @@ struct FastHostObjectUtil final: StaticBase
 
     static V8Value GetEnumerator(void* pvObject);
     static V8Value GetAsyncEnumerator(void* pvObject);
+
+    enum class CallType : int32_t
+    {
+        // IMPORTANT: maintain bitwise equivalence with managed enum V8.V8FastFunctionCallType
+        Void,
+        Boolean,
+        Int32,
+        Double,
+        String
+    };
+
+    union CallValue
+    {
+        // IMPORTANT: maintain bitwise equivalence with managed struct V8.SplitProxy.V8FastFunctionCallValue
+        int32_t Int32Value;
+        double DoubleValue;
+        struct
+        {
+            const void* pData;
+            int32_t Length;
+            int32_t IsOneByte;
+        } StringValue;
+    };
+
+    static void InvokeFunction(void* pvFunction, size_t argCount, const CallValue* pArgs, CallValue& result);
 };
@@ -19,6 +19,20 @@ uint32_t StdString::GetDigestAsUInt32() const
     uint32_t digest { 2166136261UL };
     const uint32_t prime { 16777619UL };
 
+    if (m_IsOneByte)
+    {
+        // produce the same digest as for the equivalent two-byte string
+
+        for (auto ch : m_OneByteValue)
+        {
+            digest ^= static_cast<uint8_t>(ch);
+            digest *= prime;
+            digest *= prime;
+        }
+
+        return digest;
+    }
+
     auto pBytes = reinterpret_cast<const uint8_t*>(m_Value.data());
     size_t length { m_Value.length() * sizeof(StdChar) };
 
@@ -38,6 +52,20 @@ uint64_t StdString::GetDigestAsUInt64() const
     uint64_t digest { 14695981039346656037ULL };
     const uint64_t prime { 1099511628211ULL };
 
+    if (m_IsOneByte)
+    {
+        // produce the same digest as for the equivalent two-byte string
+
+        for (auto ch : m_OneByteValue)
+        {
+            digest ^= static_cast<uint8_t>(ch);
+            digest *= prime;
+            digest *= prime;
+        }
+
+        return digest;
+    }
+
     auto pBytes = reinterpret_cast<const uint8_t*>(m_Value.data());
     size_t length { m_Value.length() * sizeof(StdChar) };
 
@@ -21,40 +21,49 @@ class StdString final
     //-------------------------------------------------------------------------
 
     using Value = std::basic_string<StdChar>;
+    using OneByteValue = std::string;
     using UTF8Converter = std::wstring_convert<std::codecvt_utf8_utf16<StdChar>, StdChar>;
-    
+
 public:
 
     //-------------------------------------------------------------------------
     // constructors
     //-------------------------------------------------------------------------
 
-    StdString()
+    StdString():
+        m_IsOneByte(false)
     {
     }
 
     StdString(const StdString& that):
-        m_Value(that.m_Value)
+        m_Value(that.m_Value),
+        m_OneByteValue(that.m_OneByteValue),
+        m_IsOneByte(that.m_IsOneByte)
     {
     }
 
     StdString(StdString&& that) noexcept:
-        m_Value(std::move(that.m_Value))
+        m_Value(std::move(that.m_Value)),
+        m_OneByteValue(std::move(that.m_OneByteValue)),
+        m_IsOneByte(that.m_IsOneByte)
     {
     }
 
     explicit StdString(const Value& value):
-        m_Value(value)
+        m_Value(value),
+        m_IsOneByte(false)
     {
     }
 
     explicit StdString(Value&& value):
-        m_Value(std::move(value))
+        m_Value(std::move(value)),
+        m_IsOneByte(false)
     {
     }
 
     explicit StdString(const StdChar* pValue):
-        m_Value(EnsureNonNull(pValue))
+        m_Value(EnsureNonNull(pValue)),
+        m_IsOneByte(false)
     {
     }
 
@@ -63,8 +72,16 @@ public:
     {
     }
 
+    StdString(const uint8_t* pValue, int32_t length):
+        m_OneByteValue(reinterpret_cast<const char*>(pValue), length),
+        m_IsOneByte(true)
+    {
+        // IMPORTANT: one-byte data is interpreted as Latin-1, not UTF-8
+    }
+
     explicit StdString(const std::string& value):
-        m_Value(UTF8Converter().from_bytes(value))
+        m_Value(UTF8Converter().from_bytes(value)),
+        m_IsOneByte(false)
     {
     }
 
@@ -75,30 +92,37 @@ public:
     const StdString& operator=(const StdString& that)
     {
         m_Value = that.m_Value;
+        m_OneByteValue = that.m_OneByteValue;
+        m_IsOneByte = that.m_IsOneByte;
         return *this;
     }
 
     const StdString& operator=(StdString&& that) noexcept
     {
         m_Value = std::move(that.m_Value);
+        m_OneByteValue = std::move(that.m_OneByteValue);
+        m_IsOneByte = that.m_IsOneByte;
         return *this;
     }
 
     const StdString& operator=(const Value& value)
     {
         m_Value = value;
+        ClearOneByteValue();
         return *this;
     }
 
     const StdString& operator=(Value&& value)
     {
         m_Value = std::move(value);
+        ClearOneByteValue();
         return *this;
     }
 
     const StdString& operator=(const StdChar* pValue)
     {
         m_Value = EnsureNonNull(pValue);
+        ClearOneByteValue();
         return *this;
     }
 
@@ -108,24 +132,43 @@ public:
 
     const StdString& operator+=(const StdString& that)
     {
-        m_Value += that.m_Value;
+        if (m_IsOneByte && that.m_IsOneByte)
+        {
+            m_OneByteValue += that.m_OneByteValue;
+        }
+        else
+        {
+            EnsureTwoByte();
+            if (that.m_IsOneByte)
+            {
+                m_Value.append(that.m_OneByteValue.cbegin(), that.m_OneByteValue.cend());
+            }
+            else
+            {
+                m_Value += that.m_Value;
+            }
+        }
+
         return *this;
     }
 
     const StdString& operator+=(const Value& value)
     {
+        EnsureTwoByte();
         m_Value += value;
         return *this;
     }
 
     const StdString& operator+=(const StdChar* pValue)
     {
+        EnsureTwoByte();
         m_Value += EnsureNonNull(pValue);
         return *this;
     }
 
     const StdString& operator+=(StdChar value)
     {
+        EnsureTwoByte();
         m_Value += value;
         return *this;
     }
@@ -134,33 +177,42 @@ public:
     // comparison
     //-------------------------------------------------------------------------
 
-    int Compare(const StdString& that) const { return m_Value.compare(that.m_Value); }
-    int Compare(const Value& value) const { return m_Value.compare(value); }
-    int Compare(const StdChar* pValue) const { return m_Value.compare(pValue); }
+    int Compare(const StdString& that) const
+    {
+        if (m_IsOneByte)
+        {
+            return that.m_IsOneByte ? Compare(m_OneByteValue, that.m_OneByteValue) : Compare(m_OneByteValue, that.m_Value);
+        }
+
+        return that.m_IsOneByte ? Compare(m_Value, that.m_OneByteValue) : m_Value.compare(that.m_Value);
+    }
+
+    int Compare(const Value& value) const { return m_IsOneByte ? Compare(m_OneByteValue, value) : m_Value.compare(value); }
+    int Compare(const StdChar* pValue) const { return m_IsOneByte ? Compare(m_OneByteValue, std::basic_string_view<StdChar>(EnsureNonNull(pValue))) : m_Value.compare(EnsureNonNull(pValue)); }
 
-    bool operator==(const StdString& that) const { return m_Value == that.m_Value; }
-    bool operator==(const Value& value) const { return m_Value == value; }
-    bool operator==(const StdChar* pValue) const { return m_Value == pValue; }
+    bool operator==(const StdString& that) const { return (GetLength() == that.GetLength()) && (Compare(that) == 0); }
+    bool operator==(const Value& value) const { return Compare(value) == 0; }
+    bool operator==(const StdChar* pValue) const { return Compare(pValue) == 0; }
 
-    bool operator!=(const StdString& that) const { return m_Value != that.m_Value; }
-    bool operator!=(const Value& value) const { return m_Value != value; }
-    bool operator!=(const StdChar* pValue) const { return m_Value != pValue; }
+    bool operator!=(const StdString& that) const { return !operator==(that); }
+    bool operator!=(const Value& value) const { return Compare(value) != 0; }
+    bool operator!=(const StdChar* pValue) const { return Compare(pValue) != 0; }
 
-    bool operator<(const StdString& that) const { return m_Value < that.m_Value; }
-    bool operator<(const Value& value) const { return m_Value < value; }
-    bool operator<(const StdChar* pValue) const { return m_Value < pValue; }
+    bool operator<(const StdString& that) const { return Compare(that) < 0; }
+    bool operator<(const Value& value) const { return Compare(value) < 0; }
+    bool operator<(const StdChar* pValue) const { return Compare(pValue) < 0; }
 
-    bool operator<=(const StdString& that) const { return m_Value <= that.m_Value; }
-    bool operator<=(const Value& value) const { return m_Value <= value; }
-    bool operator<=(const StdChar* pValue) const { return m_Value <= pValue; }
+    bool operator<=(const StdString& that) const { return Compare(that) <= 0; }
+    bool operator<=(const Value& value) const { return Compare(value) <= 0; }
+    bool operator<=(const StdChar* pValue) const { return Compare(pValue) <= 0; }
 
-    bool operator>(const StdString& that) const { return m_Value > that.m_Value; }
-    bool operator>(const Value& value) const { return m_Value > value; }
-    bool operator>(const StdChar* pValue) const { return m_Value > pValue; }
+    bool operator>(const StdString& that) const { return Compare(that) > 0; }
+    bool operator>(const Value& value) const { return Compare(value) > 0; }
+    bool operator>(const StdChar* pValue) const { return Compare(pValue) > 0; }
 
-    bool operator>=(const StdString& that) const { return m_Value >= that.m_Value; }
-    bool operator>=(const Value& value) const { return m_Value >= value; }
-    bool operator>=(const StdChar* pValue) const { return m_Value >= pValue; }
+    bool operator>=(const StdString& that) const { return Compare(that) >= 0; }
+    bool operator>=(const Value& value) const { return Compare(value) >= 0; }
+    bool operator>=(const StdChar* pValue) const { return Compare(pValue) >= 0; }
 
     //-------------------------------------------------------------------------
     // miscellaneous
@@ -168,19 +220,40 @@ public:
 
     int GetLength() const
     {
-        return static_cast<int>(m_Value.length());
+        return static_cast<int>(m_IsOneByte ? m_OneByteValue.length() : m_Value.length());
+    }
+
+    bool IsOneByte() const
+    {
+        return m_IsOneByte;
     }
 
     size_t GetDigest() const;
 
     const StdChar* ToCString() const
     {
+        _ASSERTE(!m_IsOneByte);
         return m_Value.c_str();
     }
 
+    const uint8_t* ToOneByteCString() const
+    {
+        _ASSERTE(m_IsOneByte);
+        return reinterpret_cast<const uint8_t*>(m_OneByteValue.c_str());
+    }
+
     std::string ToUTF8() const
     {
-        return UTF8Converter().to_bytes(m_Value);
+        return m_IsOneByte ? UTF8Converter().to_bytes(Value(m_OneByteValue.cbegin(), m_OneByteValue.cend())) : UTF8Converter().to_bytes(m_Value);
+    }
+
+    void EnsureTwoByte()
+    {
+        if (m_IsOneByte)
+        {
+            m_Value.assign(m_OneByteValue.cbegin(), m_OneByteValue.cend());
+            ClearOneByteValue();
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -188,25 +261,41 @@ public:
     //-------------------------------------------------------------------------
 
     StdString(v8::Isolate* pIsolate, v8::Local<v8::Value> hValue):
-        m_Value(GetValue(pIsolate, hValue))
+        m_IsOneByte(false)
     {
+        SetValue(pIsolate, hValue);
     }
 
     explicit StdString(const v8_inspector::StringView& stringView):
-        m_Value(GetValue(stringView))
+        m_Value(GetValue(stringView)),
+        m_IsOneByte(false)
     {
     }
 
     v8::MaybeLocal<v8::String> ToV8String(v8::Isolate* pIsolate, v8::NewStringType type) const
     {
+        if (m_IsOneByte)
+        {
+            return v8::String::NewFromOneByte(pIsolate, ToOneByteCString(), type, GetLength());
+        }
+
         return v8::String::NewFromTwoByte(pIsolate, reinterpret_cast<const uint16_t*>(ToCString()), type, GetLength());
     }
 
     v8_inspector::StringView GetStringView(size_t index = 0, size_t length = SIZE_MAX) const
     {
-        auto valueLength = m_Value.length();
+        // IMPORTANT: The inspector interprets 8-bit string views as UTF-8, so one-byte strings
+        // must be widened by the caller (see EnsureTwoByte) if they might contain non-ASCII data.
+
+        auto valueLength = static_cast<size_t>(GetLength());
         index = std::min(index, valueLength);
         length = std::min(length, valueLength - index);
+
+        if (m_IsOneByte)
+        {
+            return v8_inspector::StringView(ToOneByteCString() + index, length);
+        }
+
         return v8_inspector::StringView(reinterpret_cast<const uint16_t*>(ToCString() + index), length);
     }
 
@@ -219,12 +308,11 @@ private:
     uint32_t GetDigestAsUInt32() const;
     uint64_t GetDigestAsUInt64() const;
 
-    static Value GetValue(v8::Isolate* pIsolate, v8::Local<v8::Value> hValue)
+    void SetValue(v8::Isolate* pIsolate, v8::Local<v8::Value> hValue)
     {
-        Value value;
         if (hValue.IsEmpty())
         {
-            return value;
+            return;
         }
 
         v8::Local<v8::String> hString;
@@ -234,20 +322,58 @@ private:
         }
         else if (!hValue->ToString(pIsolate->GetCurrentContext()).ToLocal(&hString))
         {
-            return value;
+            return;
         }
 
         auto length = hString->Length();
-        value.resize(length);
+        if (hString->IsOneByte())
+        {
+            m_OneByteValue.resize(length);
+            hString->WriteOneByteV2(pIsolate, 0, length, reinterpret_cast<uint8_t*>(m_OneByteValue.data()));
+            m_IsOneByte = true;
+        }
+        else
+        {
+            m_Value.resize(length);
+            hString->WriteV2(pIsolate, 0, length, reinterpret_cast<uint16_t*>(m_Value.data()));
+        }
+    }
+
+    void ClearOneByteValue()
+    {
+        m_OneByteValue.clear();
+        m_IsOneByte = false;
+    }
 
-        hString->WriteV2(pIsolate, 0, length, reinterpret_cast<uint16_t*>(value.data()));
-        return value;
+    template <typename TLeft, typename TRight>
+    static int Compare(const TLeft& left, const TRight& right)
+    {
+        auto leftLength = left.length();
+        auto rightLength = right.length();
+        auto length = std::min(leftLength, rightLength);
+
+        for (size_t index = 0; index < length; index++)
+        {
+            auto leftChar = ToCodeUnit(left[index]);
+            auto rightChar = ToCodeUnit(right[index]);
+            if (leftChar != rightChar)
+            {
+                return (leftChar < rightChar) ? -1 : 1;
+            }
+        }
+
+        return (leftLength < rightLength) ? -1 : ((leftLength > rightLength) ? 1 : 0);
     }
 
+    static uint16_t ToCodeUnit(char value) { return static_cast<uint8_t>(value); }
+    static uint16_t ToCodeUnit(StdChar value) { return value; }
+
     static Value GetValue(const v8_inspector::StringView& stringView);
     static const StdChar* EnsureNonNull(const StdChar* pValue);
 
     Value m_Value;
+    OneByteValue m_OneByteValue;
+    bool m_IsOneByte;
 };
 
 //-----------------------------------------------------------------------------
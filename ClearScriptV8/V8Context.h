@@ -31,7 +31,9 @@ public:
         UseSynchronizationContexts = 0x00002000,
         AddPerformanceObject = 0x00004000,
         SetTimerResolution = 0x00008000,
-        EnableArrayConversion = 0x00010000
+        EnableArrayConversion = 0x00010000,
+        EnableObjectIdentityCache = 0x00020000,
+        EnableHostObjectTypeTemplates = 0x00040000
     };
 
     struct Options final
@@ -45,6 +47,21 @@ public:
         size_t ScriptCount = 0;
         size_t ModuleCount = 0;
         size_t ModuleCacheSize = 0;
+        size_t PropertyNameCacheHitCount = 0;
+        size_t PropertyNameCacheMissCount = 0;
+        size_t ObjectIdentityCacheHitCount = 0;
+        size_t ObjectIdentityCacheMissCount = 0;
+        size_t FastFunctionCallCount = 0;
+    };
+
+    enum class BatchCommand : int32_t
+    {
+        // IMPORTANT: maintain equivalence with managed enum V8.V8Batch.CommandKind
+        GetProperty,
+        SetProperty,
+        DeleteProperty,
+        InvokeMethod,
+        Invoke
     };
 
     static V8Context* Create(const SharedPtr<V8Isolate>& spIsolate, const StdString& name, const Options& options);
@@ -58,6 +75,9 @@ public:
     virtual size_t GetMaxIsolateStackUsage() = 0;
     virtual void SetMaxIsolateStackUsage(size_t value) = 0;
 
+    virtual size_t GetMaxIsolateStringCacheSize() = 0;
+    virtual void SetMaxIsolateStringCacheSize(size_t value) = 0;
+
     typedef void CallWithLockCallback(void* pvAction);
     virtual void CallWithLock(CallWithLockCallback* pCallback, void* pvAction) = 0;
 
@@ -66,6 +86,12 @@ public:
 
     virtual V8Value GetRootObject() = 0;
     virtual void SetGlobalProperty(const StdString& name, const V8Value& value, bool globalMembers) = 0;
+    virtual V8Value CreateV8Array(const std::vector<V8Value>& values) = 0;
+    virtual V8Value CreateV8Object(const std::vector<StdString>& names, const std::vector<V8Value>& values) = 0;
+    virtual V8Value DeserializeValue(const std::vector<uint8_t>& data, const std::vector<V8Value>& sharedObjects) = 0;
+    virtual V8Value ParseJson(const StdString& json) = 0;
+    virtual V8Value ParseJson(const char* pJson, int32_t length) = 0;
+    virtual V8Value CreateFastFunction(void* pvFunction, FastHostObjectUtil::CallType returnType, const std::vector<int32_t>& argTypes) = 0;
 
     virtual void AwaitDebuggerAndPause() = 0;
     virtual void CancelAwaitDebugger() = 0;
@@ -79,6 +105,7 @@ public:
 
     virtual bool CanExecute(const SharedPtr<V8ScriptHolder>& spHolder) = 0;
     virtual V8Value Execute(const SharedPtr<V8ScriptHolder>& spHolder, bool evaluate) = 0;
+    virtual void ExecuteBatch(const std::vector<int32_t>& commands, const std::vector<StdString>& names, const std::vector<V8Value>& values, std::vector<V8Value>& results, std::vector<StdString>& errors) = 0;
 
     virtual void Interrupt() = 0;
     virtual void CancelInterrupt() = 0;
@@ -92,6 +119,8 @@ public:
     virtual Statistics GetStatistics() = 0;
     virtual void CollectGarbage(bool exhaustive) = 0;
     virtual void OnAccessSettingsChanged() = 0;
+    virtual void OnEnumerationSettingsChanged() = 0;
+    virtual void InvalidateHostMemberCache(const std::vector<StdString>& names) = 0;
 
     virtual bool BeginCpuProfile(const StdString& name, v8::CpuProfilingMode mode, bool recordSamples) = 0;
     virtual bool EndCpuProfile(const StdString& name, V8Isolate::CpuProfileCallback* pCallback, void* pvArg) = 0;
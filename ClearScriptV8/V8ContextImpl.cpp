@@ -33,6 +33,16 @@ inline T FromMaybe(FromMaybeScope& /*scope*/, const v8::Maybe<T>& maybe)
 
 //-----------------------------------------------------------------------------
 
+inline void FromMaybe(FromMaybeScope& /*scope*/, const v8::Maybe<void>& maybe)
+{
+    if (maybe.IsNothing())
+    {
+        throw FromMaybeFailure();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 template <typename T>
 inline v8::Local<T> FromMaybe(FromMaybeScope& /*scope*/, const v8::MaybeLocal<T>& maybe)
 {
@@ -233,6 +243,13 @@ inline V8ContextImpl* GetContextImplFromData(const TInfo& info)
 
 //-----------------------------------------------------------------------------
 
+inline V8ContextImpl* GetContextImplFromContext(v8::Local<v8::Context> hContext)
+{
+    return (!hContext.IsEmpty() && (hContext->GetNumberOfEmbedderDataFields() > 1)) ? static_cast<V8ContextImpl*>(hContext->GetAlignedPointerFromEmbedderData(1)) : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
 template <typename TVariable, typename TValue>
 inline void SetIfSameType(TVariable& /*variable*/, TValue /*value*/)
 {
@@ -280,6 +297,84 @@ inline void ProcessVoidCallbackResult(const TInfo& info, TStatus& status)
     ::SetIfSameType(status, v8::Intercepted::kYes);
 }
 
+//-----------------------------------------------------------------------------
+// V8SerializerDelegate
+//-----------------------------------------------------------------------------
+
+class V8SerializerDelegate final: public v8::ValueSerializer::Delegate
+{
+    PROHIBIT_COPY(V8SerializerDelegate)
+
+public:
+
+    explicit V8SerializerDelegate(v8::Isolate* pIsolate):
+        m_pIsolate(pIsolate)
+    {
+    }
+
+    virtual void ThrowDataCloneError(v8::Local<v8::String> hMessage) override
+    {
+        m_pIsolate->ThrowException(v8::Exception::Error(hMessage));
+    }
+
+    virtual v8::Maybe<uint32_t> GetSharedArrayBufferId(v8::Isolate* /*pIsolate*/, v8::Local<v8::SharedArrayBuffer> hSharedArrayBuffer) override
+    {
+        // shared array buffers are not copied; their backing stores travel with the serialized data
+
+        for (size_t index = 0; index < m_SharedArrayBuffers.size(); index++)
+        {
+            if (m_SharedArrayBuffers[index] == hSharedArrayBuffer)
+            {
+                return v8::Just(static_cast<uint32_t>(index));
+            }
+        }
+
+        m_SharedArrayBuffers.push_back(hSharedArrayBuffer);
+        return v8::Just(static_cast<uint32_t>(m_SharedArrayBuffers.size() - 1));
+    }
+
+    const std::vector<v8::Local<v8::SharedArrayBuffer>>& GetSharedArrayBuffers() const
+    {
+        return m_SharedArrayBuffers;
+    }
+
+private:
+
+    v8::Isolate* m_pIsolate;
+    std::vector<v8::Local<v8::SharedArrayBuffer>> m_SharedArrayBuffers;
+};
+
+//-----------------------------------------------------------------------------
+// V8DeserializerDelegate
+//-----------------------------------------------------------------------------
+
+class V8DeserializerDelegate final: public v8::ValueDeserializer::Delegate
+{
+    PROHIBIT_COPY(V8DeserializerDelegate)
+
+public:
+
+    explicit V8DeserializerDelegate(std::vector<v8::Local<v8::SharedArrayBuffer>>&& sharedArrayBuffers):
+        m_SharedArrayBuffers(std::move(sharedArrayBuffers))
+    {
+    }
+
+    virtual v8::MaybeLocal<v8::SharedArrayBuffer> GetSharedArrayBufferFromId(v8::Isolate* pIsolate, uint32_t id) override
+    {
+        if ((id < m_SharedArrayBuffers.size()) && !m_SharedArrayBuffers[id].IsEmpty())
+        {
+            return m_SharedArrayBuffers[id];
+        }
+
+        pIsolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8Literal(pIsolate, "Invalid shared array buffer reference in serialized data")));
+        return v8::MaybeLocal<v8::SharedArrayBuffer>();
+    }
+
+private:
+
+    std::vector<v8::Local<v8::SharedArrayBuffer>> m_SharedArrayBuffers;
+};
+
 //-----------------------------------------------------------------------------
 // V8ContextImpl implementation
 //-----------------------------------------------------------------------------
@@ -380,9 +475,17 @@ V8ContextImpl::V8ContextImpl(SharedPtr<V8IsolateImpl>&& spIsolateImpl, const Std
     m_spIsolateImpl(std::move(spIsolateImpl)),
     m_DateTimeConversionEnabled(::HasFlag(options.Flags, Flags::EnableDateTimeConversion)),
     m_HideHostExceptions(::HasFlag(options.Flags, Flags::HideHostExceptions)),
+    m_ObjectIdentityCacheEnabled(::HasFlag(options.Flags, Flags::EnableObjectIdentityCache)),
+    m_ObjectIdentityCacheSweepSize(0),
+    m_ObjectIdentityCacheMissCount(0),
+    m_HostObjectTypeTemplatesEnabled(::HasFlag(options.Flags, Flags::EnableHostObjectTypeTemplates)),
+    m_HostMemberCacheStamp(0),
+    m_HostMemberCacheBaseStamp(0),
+    m_HostObjectPropertyNamesStamp(0),
+    m_GlobalMemberIndexStamp(0),
+    m_GlobalMemberIndexValid(false),
     m_AllowHostObjectConstructorCall(false),
-    m_ChangedTimerResolution(false),
-    m_pvV8ObjectCache(nullptr)
+    m_ChangedTimerResolution(false)
 {
     VerifyNotOutOfMemory();
 
@@ -445,11 +548,13 @@ V8ContextImpl::V8ContextImpl(SharedPtr<V8IsolateImpl>&& spIsolateImpl, const Std
 
             ASSERT_EVAL(FROM_MAYBE(m_hContext->Global()->Set(m_hContext, CreateString("getPromiseState"), FROM_MAYBE(v8::Function::New(m_hContext, GetPromiseStateCallback, hContextImpl)))));
             ASSERT_EVAL(FROM_MAYBE(m_hContext->Global()->Set(m_hContext, CreateString("getPromiseResult"), FROM_MAYBE(v8::Function::New(m_hContext, GetPromiseResultCallback, hContextImpl)))));
+            ASSERT_EVAL(FROM_MAYBE(m_hContext->Global()->Set(m_hContext, CreateString("getEnumeratorChunk"), FROM_MAYBE(v8::Function::New(m_hContext, GetHostEnumeratorChunk, hContextImpl)))));
+            ASSERT_EVAL(FROM_MAYBE(m_hContext->Global()->Set(m_hContext, CreateString("fetchAsyncEnumeratorChunk"), FROM_MAYBE(v8::Function::New(m_hContext, FetchHostAsyncEnumeratorChunk, hContextImpl)))));
 
             m_hMissingPropertyValue = CreatePersistent(CreateSymbol());
             m_hHostExceptionKey = CreatePersistent(CreateString("hostException"));
             m_hCacheKey = CreatePersistent(CreatePrivate());
-            m_hAccessTokenKey = CreatePersistent(CreatePrivate());
+            m_hHostDelegateFunctionKey = CreatePersistent(CreatePrivate());
             m_hInternalUseOnly = CreatePersistent(CreateString("The invoked function is for ClearScript internal use only"));
             m_hStackKey = CreatePersistent(CreateString("stack"));
             m_hObjectNotInvocable = CreatePersistent(CreateString("The object does not support invocation"));
@@ -466,7 +571,9 @@ V8ContextImpl::V8ContextImpl(SharedPtr<V8IsolateImpl>&& spIsolateImpl, const Std
             hGetHostObjectJsonFunction = CreateFunctionTemplate(GetHostObjectJson, hContextImpl);
             hHostDelegateToFunctionFunction = CreateFunctionTemplate(CreateFunctionForHostDelegate, hContextImpl);
 
-            m_hAccessToken = CreatePersistent(CreateObject());
+            auto hHostObjectCacheTemplate = CreateObjectTemplate();
+            hHostObjectCacheTemplate->SetInternalFieldCount(2);
+            m_hHostObjectCacheTemplate = CreatePersistent(hHostObjectCacheTemplate);
             m_hFlushFunction = CreatePersistent(FROM_MAYBE(v8::Function::New(m_hContext, FlushCallback)));
             m_hTerminationException = CreatePersistent(v8::Exception::Error(CreateString("Script execution was interrupted")));
 
@@ -533,7 +640,6 @@ V8ContextImpl::V8ContextImpl(SharedPtr<V8IsolateImpl>&& spIsolateImpl, const Std
         m_hFastHostFunctionTemplate->InstanceTemplate()->SetHostDelegate(); // instructs our patched V8 typeof implementation to return "function" 
         m_hFastHostFunctionTemplate->PrototypeTemplate()->Set(CreateString("toFunction"), hHostDelegateToFunctionFunction);
 
-        m_pvV8ObjectCache = HostObjectUtil::CreateV8ObjectCache();
         m_spIsolateImpl->AddContext(this, options);
 
     FROM_MAYBE_CATCH
@@ -598,6 +704,20 @@ void V8ContextImpl::SetMaxIsolateStackUsage(size_t value)
 
 //-----------------------------------------------------------------------------
 
+size_t V8ContextImpl::GetMaxIsolateStringCacheSize()
+{
+    return m_spIsolateImpl->GetMaxStringCacheSize();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::SetMaxIsolateStringCacheSize(size_t value)
+{
+    m_spIsolateImpl->SetMaxStringCacheSize(value);
+}
+
+//-----------------------------------------------------------------------------
+
 void V8ContextImpl::CallWithLock(CallWithLockCallback* pCallback, void* pvAction)
 {
     VerifyNotOutOfMemory();
@@ -666,10 +786,238 @@ void V8ContextImpl::SetGlobalProperty(const StdString& name, const V8Value& valu
             }
 
             m_GlobalMembersStack.emplace_back(name, CreatePersistent(hValue));
+            InvalidateGlobalMemberIndex();
+        }
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The V8 runtime cannot perform the requested operation because a script exception is pending")), false);
+
+    FROM_MAYBE_END
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::CreateV8Array(const std::vector<V8Value>& values)
+{
+    BEGIN_CONTEXT_SCOPE
+    FROM_MAYBE_TRY
+
+        std::vector<v8::Local<v8::Value>> elements;
+        elements.reserve(values.size());
+
+        for (const auto& value : values)
+        {
+            elements.push_back(ImportValue(value));
+        }
+
+        return ExportValue(FROM_MAYBE(v8::MaybeLocal<v8::Array>(CreateArray(elements.data(), elements.size()))));
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The V8 runtime cannot perform the requested operation because a script exception is pending")), false);
+
+    FROM_MAYBE_END
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::CreateV8Object(const std::vector<StdString>& names, const std::vector<V8Value>& values)
+{
+    BEGIN_CONTEXT_SCOPE
+    FROM_MAYBE_TRY
+
+        auto count = std::min(names.size(), values.size());
+
+        v8::Local<v8::DictionaryTemplate> hTemplate;
+        if (TryGetObjectShape(names, count, hTemplate))
+        {
+            std::vector<v8::MaybeLocal<v8::Value>> propertyValues;
+            propertyValues.reserve(count);
+
+            for (size_t index = 0; index < count; index++)
+            {
+                propertyValues.push_back(ImportValue(values[index]));
+            }
+
+            return ExportValue(hTemplate->NewInstance(m_hContext, v8::MemorySpan<v8::MaybeLocal<v8::Value>>(propertyValues.data(), propertyValues.size())));
+        }
+
+        auto hObject = CreateObject();
+        for (size_t index = 0; index < count; index++)
+        {
+            ASSERT_EVAL(FROM_MAYBE(hObject->CreateDataProperty(m_hContext, FROM_MAYBE(GetCachedString(names[index])), ImportValue(values[index]))));
+        }
+
+        return ExportValue(hObject);
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The V8 runtime cannot perform the requested operation because a script exception is pending")), false);
+
+    FROM_MAYBE_END
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::DeserializeValue(const std::vector<uint8_t>& data, const std::vector<V8Value>& sharedObjects)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+
+        std::vector<v8::Local<v8::SharedArrayBuffer>> sharedArrayBuffers;
+        sharedArrayBuffers.reserve(sharedObjects.size());
+
+        for (const auto& sharedObject : sharedObjects)
+        {
+            auto hSharedObject = ImportValue(sharedObject);
+            sharedArrayBuffers.push_back(hSharedObject->IsSharedArrayBuffer() ? hSharedObject.As<v8::SharedArrayBuffer>() : v8::Local<v8::SharedArrayBuffer>());
+        }
+
+        auto pIsolate = m_hContext->GetIsolate();
+        V8DeserializerDelegate delegate(std::move(sharedArrayBuffers));
+        v8::ValueDeserializer deserializer(pIsolate, data.data(), data.size(), &delegate);
+
+        VERIFY_MAYBE(deserializer.ReadHeader(m_hContext));
+        return ExportValue(VERIFY_MAYBE(deserializer.ReadValue(m_hContext)));
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::ParseJson(const StdString& json)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+
+        return ExportValue(VERIFY_MAYBE(v8::JSON::Parse(m_hContext, VERIFY_MAYBE(CreateString(json)))));
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::ParseJson(const char* pJson, int32_t length)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+
+        // UTF-8 input goes straight to V8, which scans pure ASCII payloads into a one-byte string
+        // without an intermediate UTF-16 copy.
+
+        auto hJson = VERIFY_MAYBE(v8::String::NewFromUtf8(m_hContext->GetIsolate(), pJson, v8::NewStringType::kNormal, length));
+        return ExportValue(VERIFY_MAYBE(v8::JSON::Parse(m_hContext, hJson)));
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::CreateFastFunction(void* pvFunction, FastHostObjectUtil::CallType returnType, const std::vector<int32_t>& argTypes)
+{
+    BEGIN_CONTEXT_SCOPE
+    FROM_MAYBE_TRY
+
+        auto& entry = m_FastFunctions.emplace_back();
+        entry.pContextImpl = this;
+        entry.pvFunction = pvFunction;
+        entry.ReturnType = returnType;
+
+        auto argCount = argTypes.size();
+        entry.ArgTypes.reserve(argCount);
+        entry.ArgInfo.reserve(argCount + 2);
+        entry.ArgInfo.emplace_back(v8::CTypeInfo::Type::kV8Value);
+
+        for (auto argType : argTypes)
+        {
+            auto callType = static_cast<FastHostObjectUtil::CallType>(argType);
+            entry.ArgTypes.push_back(callType);
+
+            switch (callType)
+            {
+                case FastHostObjectUtil::CallType::Boolean:
+                    entry.ArgInfo.emplace_back(v8::CTypeInfo::Type::kBool);
+                    break;
+
+                case FastHostObjectUtil::CallType::Int32:
+                    entry.ArgInfo.emplace_back(v8::CTypeInfo::Type::kInt32);
+                    break;
+
+                case FastHostObjectUtil::CallType::Double:
+                    entry.ArgInfo.emplace_back(v8::CTypeInfo::Type::kFloat64);
+                    break;
+
+                case FastHostObjectUtil::CallType::String:
+                    entry.ArgInfo.emplace_back(v8::CTypeInfo::Type::kSeqOneByteString);
+                    break;
+
+                default:
+                    m_FastFunctions.pop_back();
+                    throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("Unsupported fast function argument type")), false);
+            }
+        }
+
+        entry.ArgInfo.emplace_back(v8::CTypeInfo::kCallbackOptionsType);
+
+        const void* pvAddress = nullptr;
+        auto returnTypeInfo = v8::CTypeInfo(v8::CTypeInfo::Type::kVoid);
+
+        if (argCount <= Constants::MaxFastFunctionArgCount)
+        {
+            switch (returnType)
+            {
+                case FastHostObjectUtil::CallType::Void:
+                    pvAddress = GetFastFunctionAddress<void>(entry.ArgTypes.data(), argCount);
+                    break;
+
+                case FastHostObjectUtil::CallType::Boolean:
+                    pvAddress = GetFastFunctionAddress<bool>(entry.ArgTypes.data(), argCount);
+                    returnTypeInfo = v8::CTypeInfo(v8::CTypeInfo::Type::kBool);
+                    break;
+
+                case FastHostObjectUtil::CallType::Int32:
+                    pvAddress = GetFastFunctionAddress<int32_t>(entry.ArgTypes.data(), argCount);
+                    returnTypeInfo = v8::CTypeInfo(v8::CTypeInfo::Type::kInt32);
+                    break;
+
+                case FastHostObjectUtil::CallType::Double:
+                    pvAddress = GetFastFunctionAddress<double>(entry.ArgTypes.data(), argCount);
+                    returnTypeInfo = v8::CTypeInfo(v8::CTypeInfo::Type::kFloat64);
+                    break;
+
+                default:
+                    break;
+            }
         }
 
+        if (pvAddress == nullptr)
+        {
+            m_FastFunctions.pop_back();
+            throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("Unsupported fast function signature")), false);
+        }
+
+        entry.upFunctionInfo.reset(new v8::CFunctionInfo(returnTypeInfo, static_cast<unsigned int>(entry.ArgInfo.size()), entry.ArgInfo.data()));
+        entry.Function = v8::CFunction(pvAddress, entry.upFunctionInfo.get());
+
+        auto hTemplate = CreateFunctionTemplate(InvokeFastFunction, CreateExternal(&entry), static_cast<int>(argCount), &entry.Function);
+        auto hFunction = FROM_MAYBE(hTemplate->GetFunction(m_hContext));
+        auto function = ExportValue(hFunction);
+
+        // the entry and its host function reference are released when the function is collected
+
+        entry.hFunction = MakeWeak(CreatePersistent(hFunction), &entry, this, DisposeFastFunction);
+        return function;
+
     FROM_MAYBE_CATCH
 
+        m_FastFunctions.pop_back();
         throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The V8 runtime cannot perform the requested operation because a script exception is pending")), false);
 
     FROM_MAYBE_END
@@ -694,6 +1042,8 @@ void V8ContextImpl::CancelAwaitDebugger()
 
 V8Value V8ContextImpl::Execute(const V8DocumentInfo& documentInfo, const StdString& code, bool evaluate)
 {
+    V8_TRACE_SCOPE(Execution, "Execute");
+
     BEGIN_CONTEXT_SCOPE
     BEGIN_DOCUMENT_SCOPE(documentInfo)
     BEGIN_EXECUTION_SCOPE
@@ -1222,6 +1572,8 @@ bool V8ContextImpl::CanExecute(const SharedPtr<V8ScriptHolder>& spHolder)
 
 V8Value V8ContextImpl::Execute(const SharedPtr<V8ScriptHolder>& spHolder, bool evaluate)
 {
+    V8_TRACE_SCOPE(Execution, "Execute");
+
     BEGIN_CONTEXT_SCOPE
     BEGIN_DOCUMENT_SCOPE(spHolder->GetDocumentInfo())
     BEGIN_EXECUTION_SCOPE
@@ -1348,65 +1700,224 @@ V8Value V8ContextImpl::Execute(const SharedPtr<V8ScriptHolder>& spHolder, bool e
 
 //-----------------------------------------------------------------------------
 
-void V8ContextImpl::Interrupt()
+void V8ContextImpl::ExecuteBatch(const std::vector<int32_t>& commands, const std::vector<StdString>& names, const std::vector<V8Value>& values, std::vector<V8Value>& results, std::vector<StdString>& errors)
 {
-    TerminateExecution(false);
-}
+    // Each command occupies two elements of the command buffer: the command kind and the number
+    // of operands. Each command also consumes one name and, from the value buffer, its target
+    // followed by its operands. The buffer is validated in full before any command is executed.
 
-//-----------------------------------------------------------------------------
+    auto commandCount = commands.size() / 2;
+    auto valueCount = static_cast<size_t>(0);
+    auto valid = ((commands.size() % 2) == 0) && (names.size() == commandCount);
 
-void V8ContextImpl::CancelInterrupt()
-{
-    CancelTerminateExecution();
-}
+    for (size_t commandIndex = 0; valid && (commandIndex < commandCount); commandIndex++)
+    {
+        auto operandCount = commands[(commandIndex * 2) + 1];
+        switch (static_cast<BatchCommand>(commands[commandIndex * 2]))
+        {
+            case BatchCommand::GetProperty:
+            case BatchCommand::DeleteProperty:
+                valid = (operandCount == 0);
+                break;
 
-//-----------------------------------------------------------------------------
+            case BatchCommand::SetProperty:
+                valid = (operandCount == 1);
+                break;
 
-bool V8ContextImpl::GetEnableIsolateInterruptPropagation()
-{
-    return m_spIsolateImpl->GetEnableInterruptPropagation();
-}
+            case BatchCommand::InvokeMethod:
+            case BatchCommand::Invoke:
+                valid = (operandCount >= 0);
+                break;
 
-//-----------------------------------------------------------------------------
+            default:
+                valid = false;
+                break;
+        }
 
-void V8ContextImpl::SetEnableIsolateInterruptPropagation(bool value)
-{
-    m_spIsolateImpl->SetEnableInterruptPropagation(value);
-}
+        valueCount += static_cast<size_t>(operandCount) + 1;
+    }
 
-//-----------------------------------------------------------------------------
+    if (!valid || (valueCount != values.size()))
+    {
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("Invalid batch command buffer")), false);
+    }
 
-bool V8ContextImpl::GetDisableIsolateHeapSizeViolationInterrupt()
-{
-    return m_spIsolateImpl->GetDisableHeapSizeViolationInterrupt();
-}
+    results.clear();
+    results.reserve(commandCount);
+    errors.clear();
+    errors.reserve(commandCount);
 
-//-----------------------------------------------------------------------------
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
 
-void V8ContextImpl::SetDisableIsolateHeapSizeViolationInterrupt(bool value)
-{
-    m_spIsolateImpl->SetDisableHeapSizeViolationInterrupt(value);
-}
+        std::vector<v8::Local<v8::Value>> importedArgs;
+        auto pValue = values.data();
 
-//-----------------------------------------------------------------------------
+        for (size_t commandIndex = 0; commandIndex < commandCount; commandIndex++)
+        {
+            auto command = static_cast<BatchCommand>(commands[commandIndex * 2]);
+            auto operandCount = static_cast<size_t>(commands[(commandIndex * 2) + 1]);
+            const auto& name = names[commandIndex];
 
-void V8ContextImpl::GetIsolateHeapStatistics(v8::HeapStatistics& heapStatistics)
-{
-    m_spIsolateImpl->GetHeapStatistics(heapStatistics);
-}
+            auto pTarget = pValue;
+            auto pOperands = pTarget + 1;
+            pValue = pOperands + operandCount;
 
-//-----------------------------------------------------------------------------
+            // a fresh try-catch per command keeps a failed command from poisoning the rest
 
-V8Isolate::Statistics V8ContextImpl::GetIsolateStatistics()
-{
-    return m_spIsolateImpl->GetStatistics();
-}
+            DISABLE_WARNING(4456) /* declaration hides previous local declaration */
+            V8IsolateImpl::TryCatch t_TryCatch(*m_spIsolateImpl);
+            DEFAULT_WARNING(4456)
 
-//-----------------------------------------------------------------------------
+            try
+            {
+                FROM_MAYBE_TRY
 
-V8ContextImpl::Statistics V8ContextImpl::GetStatistics()
-{
-    _ASSERTE(m_spIsolateImpl->IsCurrent() && m_spIsolateImpl->IsLocked());
+                    auto throwTypeError = [&] (v8::Local<v8::String> hMessage)
+                    {
+                        ThrowException(v8::Exception::TypeError(hMessage));
+                        VERIFY_CHECKPOINT();
+                        throw V8Exception(V8Exception::Type::General, m_Name, CreateStdString(hMessage), EXECUTION_STARTED);
+                    };
+
+                    auto hTarget = ::ValueAsObject(ImportValue(*pTarget));
+                    if (hTarget.IsEmpty())
+                    {
+                        throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("Invalid batch command target")), EXECUTION_STARTED);
+                    }
+
+                    switch (command)
+                    {
+                        case BatchCommand::GetProperty:
+                            results.push_back(ExportValue(VERIFY_MAYBE(hTarget->Get(m_hContext, FROM_MAYBE(GetCachedString(name))))));
+                            break;
+
+                        case BatchCommand::SetProperty:
+                            ASSERT_EVAL(VERIFY_MAYBE(hTarget->Set(m_hContext, FROM_MAYBE(GetCachedString(name)), ImportValue(*pOperands))));
+                            results.emplace_back(V8Value::Undefined);
+                            break;
+
+                        case BatchCommand::DeleteProperty:
+                            results.emplace_back(VERIFY_MAYBE(hTarget->Delete(m_hContext, FROM_MAYBE(GetCachedString(name)))));
+                            break;
+
+                        default:
+                        {
+                            auto hFunction = hTarget;
+                            if (command == BatchCommand::InvokeMethod)
+                            {
+                                hFunction = ::ValueAsObject(VERIFY_MAYBE(hTarget->Get(m_hContext, FROM_MAYBE(GetCachedString(name)))));
+                                if (hFunction.IsEmpty())
+                                {
+                                    throwTypeError(m_hMethodOrPropertyNotFound);
+                                }
+                            }
+
+                            if (!hFunction->IsCallable())
+                            {
+                                throwTypeError((command == BatchCommand::InvokeMethod) ? m_hPropertyValueNotInvocable : m_hObjectNotInvocable);
+                            }
+
+                            importedArgs.clear();
+                            for (size_t operandIndex = 0; operandIndex < operandCount; operandIndex++)
+                            {
+                                importedArgs.push_back(ImportValue(pOperands[operandIndex]));
+                            }
+
+                            results.push_back(ExportValue(VERIFY_MAYBE(hFunction->CallAsFunction(m_hContext, hTarget, static_cast<int>(importedArgs.size()), importedArgs.data()))));
+                            break;
+                        }
+                    }
+
+                    errors.emplace_back();
+
+                FROM_MAYBE_CATCH
+
+                    throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The V8 runtime cannot perform the requested operation because a script exception is pending")), EXECUTION_STARTED);
+
+                FROM_MAYBE_END
+            }
+            catch (const V8Exception& exception)
+            {
+                // interruption and fatal errors abort the batch
+
+                if (exception.GetType() != V8Exception::Type::General)
+                {
+                    throw;
+                }
+
+                results.push_back(exception.GetScriptException());
+                errors.push_back(exception.GetMessage());
+            }
+
+            IGNORE_UNUSED(t_TryCatch);
+        }
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::Interrupt()
+{
+    TerminateExecution(false);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::CancelInterrupt()
+{
+    CancelTerminateExecution();
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8ContextImpl::GetEnableIsolateInterruptPropagation()
+{
+    return m_spIsolateImpl->GetEnableInterruptPropagation();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::SetEnableIsolateInterruptPropagation(bool value)
+{
+    m_spIsolateImpl->SetEnableInterruptPropagation(value);
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8ContextImpl::GetDisableIsolateHeapSizeViolationInterrupt()
+{
+    return m_spIsolateImpl->GetDisableHeapSizeViolationInterrupt();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::SetDisableIsolateHeapSizeViolationInterrupt(bool value)
+{
+    m_spIsolateImpl->SetDisableHeapSizeViolationInterrupt(value);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::GetIsolateHeapStatistics(v8::HeapStatistics& heapStatistics)
+{
+    m_spIsolateImpl->GetHeapStatistics(heapStatistics);
+}
+
+//-----------------------------------------------------------------------------
+
+V8Isolate::Statistics V8ContextImpl::GetIsolateStatistics()
+{
+    return m_spIsolateImpl->GetStatistics();
+}
+
+//-----------------------------------------------------------------------------
+
+V8ContextImpl::Statistics V8ContextImpl::GetStatistics()
+{
+    _ASSERTE(m_spIsolateImpl->IsCurrent() && m_spIsolateImpl->IsLocked());
 
     return m_Statistics;
 }
@@ -1425,8 +1936,8 @@ void V8ContextImpl::OnAccessSettingsChanged()
     BEGIN_CONTEXT_SCOPE
     BEGIN_EXECUTION_SCOPE
 
-        Dispose(m_hAccessToken);
-        m_hAccessToken = CreatePersistent(CreateObject());
+        ClearHostMemberInvalidations();
+        m_HostMemberCacheBaseStamp = ++m_HostMemberCacheStamp;
 
     END_EXECUTION_SCOPE
     END_CONTEXT_SCOPE
@@ -1434,6 +1945,60 @@ void V8ContextImpl::OnAccessSettingsChanged()
 
 //-----------------------------------------------------------------------------
 
+void V8ContextImpl::OnEnumerationSettingsChanged()
+{
+    // Enumeration settings and the extension method table affect only the cached property name
+    // arrays and the extension method accessors on type templates; property caches remain valid.
+    // Existing wrappers keep their templates.
+
+    BEGIN_CONTEXT_SCOPE
+
+        ++m_HostObjectPropertyNamesStamp;
+
+        for (auto it = m_HostObjectTypeTemplateCache.begin(); it != m_HostObjectTypeTemplateCache.end(); it++)
+        {
+            Dispose(it->second);
+        }
+
+        m_HostObjectTypeTemplateCache.clear();
+
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::InvalidateHostMemberCache(const std::vector<StdString>& names)
+{
+    BEGIN_CONTEXT_SCOPE
+    FROM_MAYBE_TRY
+
+        if (!names.empty())
+        {
+            auto stamp = ++m_HostMemberCacheStamp;
+            for (const auto& name : names)
+            {
+                m_HostMemberInvalidations.push_back({ stamp, CreatePersistent(FROM_MAYBE(CreateString(name, v8::NewStringType::kInternalized))) });
+            }
+
+            while (m_HostMemberInvalidations.size() > Constants::MaxHostMemberInvalidationCount)
+            {
+                auto& invalidation = m_HostMemberInvalidations.front();
+                m_HostMemberCacheBaseStamp = invalidation.Stamp;
+                Dispose(invalidation.hName);
+                m_HostMemberInvalidations.pop_front();
+            }
+        }
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The V8 runtime cannot perform the requested operation because a script exception is pending")), false);
+
+    FROM_MAYBE_END
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
 bool V8ContextImpl::BeginCpuProfile(const StdString& name, v8::CpuProfilingMode mode, bool recordSamples)
 {
     return m_spIsolateImpl->BeginCpuProfile(name, mode, recordSamples);
@@ -1552,7 +2117,7 @@ void V8ContextImpl::SetV8ObjectProperty(void* pvObject, const StdString& name, c
     BEGIN_EXECUTION_SCOPE
     FROM_MAYBE_TRY
 
-        ASSERT_EVAL(FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Set(m_hContext, FROM_MAYBE(CreateString(name)), ImportValue(value))));
+        ASSERT_EVAL(FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Set(m_hContext, FROM_MAYBE(GetCachedString(name)), ImportValue(value))));
 
     FROM_MAYBE_CATCH
 
@@ -1593,13 +2158,22 @@ void V8ContextImpl::GetV8ObjectPropertyNames(void* pvObject, bool includeIndices
 
 //-----------------------------------------------------------------------------
 
-V8Value V8ContextImpl::GetV8ObjectProperty(void* pvObject, int index)
+void V8ContextImpl::GetV8ObjectProperties(void* pvObject, const std::vector<StdString>& names, std::vector<V8Value>& values)
 {
     BEGIN_CONTEXT_SCOPE
     BEGIN_EXECUTION_SCOPE
     FROM_MAYBE_TRY
 
-        return ExportValue(FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Get(m_hContext, index)));
+        auto hObject = ::HandleFromPtr<v8::Object>(pvObject);
+
+        auto count = names.size();
+        values.clear();
+        values.reserve(count);
+
+        for (size_t index = 0; index < count; index++)
+        {
+            values.push_back(ExportValue(FROM_MAYBE(hObject->Get(m_hContext, FROM_MAYBE(GetCachedString(names[index]))))));
+        }
 
     FROM_MAYBE_CATCH
 
@@ -1612,13 +2186,19 @@ V8Value V8ContextImpl::GetV8ObjectProperty(void* pvObject, int index)
 
 //-----------------------------------------------------------------------------
 
-void V8ContextImpl::SetV8ObjectProperty(void* pvObject, int index, const V8Value& value)
+void V8ContextImpl::SetV8ObjectProperties(void* pvObject, const std::vector<StdString>& names, const std::vector<V8Value>& values)
 {
     BEGIN_CONTEXT_SCOPE
     BEGIN_EXECUTION_SCOPE
     FROM_MAYBE_TRY
 
-        ASSERT_EVAL(FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Set(m_hContext, index, ImportValue(value))));
+        auto hObject = ::HandleFromPtr<v8::Object>(pvObject);
+
+        auto count = std::min(names.size(), values.size());
+        for (size_t index = 0; index < count; index++)
+        {
+            ASSERT_EVAL(FROM_MAYBE(hObject->Set(m_hContext, FROM_MAYBE(GetCachedString(names[index])), ImportValue(values[index]))));
+        }
 
     FROM_MAYBE_CATCH
 
@@ -1631,111 +2211,162 @@ void V8ContextImpl::SetV8ObjectProperty(void* pvObject, int index, const V8Value
 
 //-----------------------------------------------------------------------------
 
-bool V8ContextImpl::DeleteV8ObjectProperty(void* pvObject, int index)
+V8Value V8ContextImpl::GetV8ObjectProperty(void* pvObject, int index)
 {
     BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
     FROM_MAYBE_TRY
 
-        return FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Delete(m_hContext, index));
+        return ExportValue(FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Get(m_hContext, index)));
 
     FROM_MAYBE_CATCH
 
-        throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The V8 runtime cannot perform the requested operation because a script exception is pending")), false);
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The V8 runtime cannot perform the requested operation because a script exception is pending")), EXECUTION_STARTED);
 
     FROM_MAYBE_END
+    END_EXECUTION_SCOPE
     END_CONTEXT_SCOPE
 }
 
 //-----------------------------------------------------------------------------
 
-void V8ContextImpl::GetV8ObjectPropertyIndices(void* pvObject, std::vector<int>& indices)
+void V8ContextImpl::SetV8ObjectProperty(void* pvObject, int index, const V8Value& value)
 {
     BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+    FROM_MAYBE_TRY
 
-        GetV8ObjectPropertyIndices(::HandleFromPtr<v8::Object>(pvObject), indices, v8::ONLY_ENUMERABLE);
+        ASSERT_EVAL(FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Set(m_hContext, index, ImportValue(value))));
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The V8 runtime cannot perform the requested operation because a script exception is pending")), EXECUTION_STARTED);
 
+    FROM_MAYBE_END
+    END_EXECUTION_SCOPE
     END_CONTEXT_SCOPE
 }
 
 //-----------------------------------------------------------------------------
 
-V8Value V8ContextImpl::InvokeV8Object(void* pvObject, bool asConstructor, const std::vector<V8Value>& args)
+bool V8ContextImpl::DeleteV8ObjectProperty(void* pvObject, int index)
 {
     BEGIN_CONTEXT_SCOPE
-    BEGIN_EXECUTION_SCOPE
-
-        v8::Local<v8::Object> hObject = ::HandleFromPtr<v8::Object>(pvObject);
-        if (!hObject->IsCallable())
-        {
-            FROM_MAYBE_TRY
+    FROM_MAYBE_TRY
 
-                auto hError = v8::Exception::TypeError(m_hObjectNotInvocable).As<v8::Object>();
-                throw V8Exception(V8Exception::Type::General, m_Name, CreateStdString(hError), CreateStdString(FROM_MAYBE(hError->Get(m_hContext, m_hStackKey))), EXECUTION_STARTED, ExportValue(hError), V8Value(V8Value::Undefined));
+        return FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Delete(m_hContext, index));
 
-            FROM_MAYBE_CATCH
+    FROM_MAYBE_CATCH
 
-                throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The object does not support invocation")), EXECUTION_STARTED);
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The V8 runtime cannot perform the requested operation because a script exception is pending")), false);
 
-            FROM_MAYBE_END
-        }
+    FROM_MAYBE_END
+    END_CONTEXT_SCOPE
+}
 
-        std::vector<v8::Local<v8::Value>> importedArgs;
-        ImportValues(args, importedArgs);
+//-----------------------------------------------------------------------------
 
-        if (asConstructor)
-        {
-            return ExportValue(VERIFY_MAYBE(hObject->CallAsConstructor(m_hContext, static_cast<int>(importedArgs.size()), importedArgs.data())));
-        }
+void V8ContextImpl::GetV8ObjectPropertyIndices(void* pvObject, std::vector<int>& indices)
+{
+    BEGIN_CONTEXT_SCOPE
 
-        return ExportValue(VERIFY_MAYBE(hObject->CallAsFunction(m_hContext, hObject, static_cast<int>(importedArgs.size()), importedArgs.data())));
+        GetV8ObjectPropertyIndices(::HandleFromPtr<v8::Object>(pvObject), indices, v8::ONLY_ENUMERABLE);
 
-    END_EXECUTION_SCOPE
     END_CONTEXT_SCOPE
 }
 
 //-----------------------------------------------------------------------------
 
-V8Value V8ContextImpl::InvokeV8ObjectMethod(void* pvObject, const StdString& name, const std::vector<V8Value>& args)
+V8ObjectHelpers::ArrayExportKind V8ContextImpl::ExportV8Array(void* pvObject, std::vector<V8Value>& values, std::vector<uint8_t>& packedValues)
 {
     BEGIN_CONTEXT_SCOPE
     BEGIN_EXECUTION_SCOPE
     FROM_MAYBE_TRY
 
+        values.clear();
+        packedValues.clear();
+
         v8::Local<v8::Object> hObject = ::HandleFromPtr<v8::Object>(pvObject);
+        if (!hObject->IsArray())
+        {
+            return V8ObjectHelpers::ArrayExportKind::Values;
+        }
 
-        auto hMethod = ::ValueAsObject(VERIFY_MAYBE(hObject->Get(m_hContext, FROM_MAYBE(CreateString(name)))));
-        if (hMethod.IsEmpty())
+        auto hArray = hObject.As<v8::Array>();
+        auto length = hArray->Length();
+        if (length > Constants::MaxArrayExportLength)
         {
-            FROM_MAYBE_TRY
+            // the length is script-controlled and says nothing about the element count (e.g.,
+            // a[4e9] = 1); leave large arrays to the host, which retrieves elements individually
 
-                auto hError = v8::Exception::TypeError(m_hMethodOrPropertyNotFound).As<v8::Object>();
-                throw V8Exception(V8Exception::Type::General, m_Name, CreateStdString(hError), CreateStdString(FROM_MAYBE(hError->Get(m_hContext, m_hStackKey))), EXECUTION_STARTED, ExportValue(hError), V8Value(V8Value::Undefined));
+            return V8ObjectHelpers::ArrayExportKind::Unsupported;
+        }
 
-            FROM_MAYBE_CATCH
+        // first pass: attempt to pack numeric elements; the callback neither allocates on the V8
+        // heap nor calls into script, although V8 may invoke accessors to retrieve elements
 
-                throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("Method or property not found")), EXECUTION_STARTED);
+        struct PackedElements final
+        {
+            std::vector<int32_t> Int32Values;
+            std::vector<double> DoubleValues;
+            bool IsDouble = false;
+            bool IsPacked = true;
+        };
 
-            FROM_MAYBE_END
-        }
+        PackedElements packedElements;
+        packedElements.Int32Values.reserve(length);
 
-        if (!hMethod->IsCallable())
+        FROM_MAYBE(hArray->Iterate(m_hContext, [] (uint32_t /*index*/, v8::Local<v8::Value> hElement, void* pvData)
         {
-            FROM_MAYBE_TRY
+            auto& packedElements = *static_cast<PackedElements*>(pvData);
 
-                auto hError = v8::Exception::TypeError(m_hPropertyValueNotInvocable).As<v8::Object>();
-                throw V8Exception(V8Exception::Type::General, m_Name, CreateStdString(hError), CreateStdString(FROM_MAYBE(hError->Get(m_hContext, m_hStackKey))), EXECUTION_STARTED, ExportValue(hError), V8Value(V8Value::Undefined));
+            if (!packedElements.IsDouble && hElement->IsInt32())
+            {
+                packedElements.Int32Values.push_back(hElement.As<v8::Int32>()->Value());
+                return v8::Array::CallbackResult::kContinue;
+            }
 
-            FROM_MAYBE_CATCH
+            if (hElement->IsNumber())
+            {
+                if (!packedElements.IsDouble)
+                {
+                    packedElements.DoubleValues.reserve(packedElements.Int32Values.capacity());
+                    packedElements.DoubleValues.assign(packedElements.Int32Values.cbegin(), packedElements.Int32Values.cend());
+                    packedElements.Int32Values.clear();
+                    packedElements.IsDouble = true;
+                }
 
-                throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The property value does not support invocation")), EXECUTION_STARTED);
+                packedElements.DoubleValues.push_back(hElement.As<v8::Number>()->Value());
+                return v8::Array::CallbackResult::kContinue;
+            }
 
-            FROM_MAYBE_END
+            packedElements.IsPacked = false;
+            return v8::Array::CallbackResult::kBreak;
+        }, &packedElements));
+
+        if (packedElements.IsPacked)
+        {
+            if (packedElements.IsDouble)
+            {
+                auto pBytes = reinterpret_cast<const uint8_t*>(packedElements.DoubleValues.data());
+                packedValues.assign(pBytes, pBytes + (packedElements.DoubleValues.size() * sizeof(double)));
+                return V8ObjectHelpers::ArrayExportKind::Double;
+            }
+
+            auto pBytes = reinterpret_cast<const uint8_t*>(packedElements.Int32Values.data());
+            packedValues.assign(pBytes, pBytes + (packedElements.Int32Values.size() * sizeof(int32_t)));
+            return V8ObjectHelpers::ArrayExportKind::Int32;
         }
 
-        std::vector<v8::Local<v8::Value>> importedArgs;
-        ImportValues(args, importedArgs);
+        // second pass: export arbitrary elements under the current scope
 
-        return ExportValue(VERIFY_MAYBE(hMethod->CallAsFunction(m_hContext, hObject, static_cast<int>(importedArgs.size()), importedArgs.data())));
+        values.reserve(length);
+        for (uint32_t index = 0; index < length; index++)
+        {
+            values.push_back(ExportValue(FROM_MAYBE(hArray->Get(m_hContext, index))));
+        }
+
+        return V8ObjectHelpers::ArrayExportKind::Values;
 
     FROM_MAYBE_CATCH
 
@@ -1748,23 +2379,156 @@ V8Value V8ContextImpl::InvokeV8ObjectMethod(void* pvObject, const StdString& nam
 
 //-----------------------------------------------------------------------------
 
-void V8ContextImpl::GetV8ObjectArrayBufferOrViewInfo(void* pvObject, V8Value& arrayBuffer, size_t& offset, size_t& size, size_t& length)
+void V8ContextImpl::SerializeV8Object(void* pvObject, std::vector<uint8_t>& data, std::vector<V8Value>& sharedObjects)
 {
     BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
 
-        v8::Local<v8::Object> hObject = ::HandleFromPtr<v8::Object>(pvObject);
+        data.clear();
+        sharedObjects.clear();
 
-        if (hObject->IsArrayBuffer())
-        {
-            auto hArrayBuffer = hObject.As<v8::ArrayBuffer>();
-            arrayBuffer = ExportValue(hObject);
-            offset = 0;
-            size = hArrayBuffer->ByteLength();
-            length = size;
-            return;
-        }
+        auto pIsolate = m_hContext->GetIsolate();
+        V8SerializerDelegate delegate(pIsolate);
+        v8::ValueSerializer serializer(pIsolate, &delegate);
 
-        if (hObject->IsSharedArrayBuffer())
+        serializer.WriteHeader();
+        if (VERIFY_MAYBE(serializer.WriteValue(m_hContext, ::HandleFromPtr<v8::Object>(pvObject))))
+        {
+            auto buffer = serializer.Release();
+            data.assign(buffer.first, buffer.first + buffer.second);
+            ::free(buffer.first);
+
+            for (const auto& hSharedArrayBuffer : delegate.GetSharedArrayBuffers())
+            {
+                sharedObjects.push_back(ExportValue(hSharedArrayBuffer));
+            }
+        }
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+StdString V8ContextImpl::StringifyV8Object(void* pvObject)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+
+        return CreateStdString(VERIFY_MAYBE(v8::JSON::Stringify(m_hContext, ::HandleFromPtr<v8::Object>(pvObject))));
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::InvokeV8Object(void* pvObject, bool asConstructor, const std::vector<V8Value>& args)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+
+        v8::Local<v8::Object> hObject = ::HandleFromPtr<v8::Object>(pvObject);
+        if (!hObject->IsCallable())
+        {
+            FROM_MAYBE_TRY
+
+                auto hError = v8::Exception::TypeError(m_hObjectNotInvocable).As<v8::Object>();
+                throw V8Exception(V8Exception::Type::General, m_Name, CreateStdString(hError), CreateStdString(FROM_MAYBE(hError->Get(m_hContext, m_hStackKey))), EXECUTION_STARTED, ExportValue(hError), V8Value(V8Value::Undefined));
+
+            FROM_MAYBE_CATCH
+
+                throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The object does not support invocation")), EXECUTION_STARTED);
+
+            FROM_MAYBE_END
+        }
+
+        std::vector<v8::Local<v8::Value>> importedArgs;
+        ImportValues(args, importedArgs);
+
+        if (asConstructor)
+        {
+            return ExportValue(VERIFY_MAYBE(hObject->CallAsConstructor(m_hContext, static_cast<int>(importedArgs.size()), importedArgs.data())));
+        }
+
+        return ExportValue(VERIFY_MAYBE(hObject->CallAsFunction(m_hContext, hObject, static_cast<int>(importedArgs.size()), importedArgs.data())));
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::InvokeV8ObjectMethod(void* pvObject, const StdString& name, const std::vector<V8Value>& args)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+    FROM_MAYBE_TRY
+
+        v8::Local<v8::Object> hObject = ::HandleFromPtr<v8::Object>(pvObject);
+
+        auto hMethod = ::ValueAsObject(VERIFY_MAYBE(hObject->Get(m_hContext, FROM_MAYBE(CreateString(name)))));
+        if (hMethod.IsEmpty())
+        {
+            FROM_MAYBE_TRY
+
+                auto hError = v8::Exception::TypeError(m_hMethodOrPropertyNotFound).As<v8::Object>();
+                throw V8Exception(V8Exception::Type::General, m_Name, CreateStdString(hError), CreateStdString(FROM_MAYBE(hError->Get(m_hContext, m_hStackKey))), EXECUTION_STARTED, ExportValue(hError), V8Value(V8Value::Undefined));
+
+            FROM_MAYBE_CATCH
+
+                throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("Method or property not found")), EXECUTION_STARTED);
+
+            FROM_MAYBE_END
+        }
+
+        if (!hMethod->IsCallable())
+        {
+            FROM_MAYBE_TRY
+
+                auto hError = v8::Exception::TypeError(m_hPropertyValueNotInvocable).As<v8::Object>();
+                throw V8Exception(V8Exception::Type::General, m_Name, CreateStdString(hError), CreateStdString(FROM_MAYBE(hError->Get(m_hContext, m_hStackKey))), EXECUTION_STARTED, ExportValue(hError), V8Value(V8Value::Undefined));
+
+            FROM_MAYBE_CATCH
+
+                throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The property value does not support invocation")), EXECUTION_STARTED);
+
+            FROM_MAYBE_END
+        }
+
+        std::vector<v8::Local<v8::Value>> importedArgs;
+        ImportValues(args, importedArgs);
+
+        return ExportValue(VERIFY_MAYBE(hMethod->CallAsFunction(m_hContext, hObject, static_cast<int>(importedArgs.size()), importedArgs.data())));
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(SL("The V8 runtime cannot perform the requested operation because a script exception is pending")), EXECUTION_STARTED);
+
+    FROM_MAYBE_END
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::GetV8ObjectArrayBufferOrViewInfo(void* pvObject, V8Value& arrayBuffer, size_t& offset, size_t& size, size_t& length)
+{
+    BEGIN_CONTEXT_SCOPE
+
+        v8::Local<v8::Object> hObject = ::HandleFromPtr<v8::Object>(pvObject);
+
+        if (hObject->IsArrayBuffer())
+        {
+            auto hArrayBuffer = hObject.As<v8::ArrayBuffer>();
+            arrayBuffer = ExportValue(hObject);
+            offset = 0;
+            size = hArrayBuffer->ByteLength();
+            length = size;
+            return;
+        }
+
+        if (hObject->IsSharedArrayBuffer())
         {
             auto hSharedArrayBuffer = hObject.As<v8::SharedArrayBuffer>();
             arrayBuffer = ExportValue(hObject);
@@ -1913,6 +2677,8 @@ v8::MaybeLocal<v8::Promise> V8ContextImpl::ImportModule(v8::Local<v8::Data> hHos
 
 v8::MaybeLocal<v8::Promise> V8ContextImpl::ImportModule(const V8DocumentInfo* pSourceDocumentInfo, v8::Local<v8::String> hSpecifier)
 {
+    V8_TRACE_SCOPE(ModuleLoad, "ImportModule");
+
     BEGIN_CONTEXT_SCOPE
 
         V8IsolateImpl::TryCatch outerTryCatch(*m_spIsolateImpl);
@@ -1986,6 +2752,8 @@ v8::MaybeLocal<v8::Module> V8ContextImpl::ResolveModule(v8::Local<v8::String> hS
 
 v8::MaybeLocal<v8::Module> V8ContextImpl::ResolveModule(v8::Local<v8::String> hSpecifier, const V8DocumentInfo* pSourceDocumentInfo)
 {
+    V8_TRACE_SCOPE(ModuleLoad, "ResolveModule");
+
     BEGIN_CONTEXT_SCOPE
 
         V8IsolateImpl::TryCatch tryCatch(*m_spIsolateImpl);
@@ -2101,13 +2869,10 @@ v8::MaybeLocal<v8::Module> V8ContextImpl::ResolveModule(v8::Local<v8::String> hS
 
 v8::MaybeLocal<v8::Value> V8ContextImpl::PopulateSyntheticModule(v8::Local<v8::Context> hContext, v8::Local<v8::Module> hModule)
 {
-    if (hContext->GetNumberOfEmbedderDataFields() > 1)
+    auto pContextImpl = ::GetContextImplFromContext(hContext);
+    if (pContextImpl != nullptr)
     {
-        auto pContextImpl = static_cast<V8ContextImpl*>(hContext->GetAlignedPointerFromEmbedderData(1));
-        if (pContextImpl != nullptr)
-        {
-            return pContextImpl->PopulateSyntheticModule(hModule);
-        }
+        return pContextImpl->PopulateSyntheticModule(hModule);
     }
 
     return v8::MaybeLocal<v8::Value>();
@@ -2156,28 +2921,22 @@ void V8ContextImpl::Teardown()
 
     m_spIsolateImpl->RemoveContext(this);
 
-    if (m_pvV8ObjectCache != nullptr)
+    for (const auto& pair : m_HostObjectWrapperCache)
     {
-        std::vector<void*> v8ObjectPtrs;
-        HostObjectUtil::GetAllCachedV8Objects(m_pvV8ObjectCache, v8ObjectPtrs);
-        for (auto pvV8Object : v8ObjectPtrs)
-        {
-            auto hObject = ::HandleFromPtr<v8::Object>(pvV8Object);
+        auto hObject = ::HandleFromPtr<v8::Object>(pair.second.pvV8Object);
 
-            auto pHolder = GetHostObjectHolder(hObject);
-            if (pHolder != nullptr)
-            {
-                delete pHolder;
-            }
-
-            ClearWeak(hObject);
-            Dispose(hObject);
+        auto pHolder = GetHostObjectHolder(hObject);
+        if (pHolder != nullptr)
+        {
+            delete pHolder;
         }
 
-        HostObjectUtil::Release(m_pvV8ObjectCache);
-        m_pvV8ObjectCache = nullptr;
+        ClearWeak(hObject);
+        Dispose(hObject);
     }
 
+    m_HostObjectWrapperCache.clear();
+
     for (auto itModule = m_SyntheticModuleData.rbegin(); itModule != m_SyntheticModuleData.rend(); itModule++)
     {
         Dispose(itModule->hModule);
@@ -2190,11 +2949,51 @@ void V8ContextImpl::Teardown()
 
     ClearModuleCache();
 
+    InvalidateGlobalMemberIndex();
+
     for (auto it = m_GlobalMembersStack.rbegin(); it != m_GlobalMembersStack.rend(); it++)
     {
         Dispose(it->second);
     }
 
+    ClearPropertyNameCache();
+
+    for (auto it = m_ObjectShapeCache.begin(); it != m_ObjectShapeCache.end(); it++)
+    {
+        Dispose(it->second.hTemplate);
+    }
+
+    m_ObjectShapeCache.clear();
+    m_ObjectIdentityCache.clear();
+    m_ObjectIdentityCacheSweepSize = 0;
+    m_ObjectIdentityCacheMissCount = 0;
+
+    for (auto it = m_HostObjectTypeTemplateCache.begin(); it != m_HostObjectTypeTemplateCache.end(); it++)
+    {
+        Dispose(it->second);
+    }
+
+    m_HostObjectTypeTemplateCache.clear();
+
+    for (auto it = m_HostObjectPropertyNamesCache.begin(); it != m_HostObjectPropertyNamesCache.end(); it++)
+    {
+        Dispose(it->second.hNameSet);
+        Dispose(it->second.hNames);
+    }
+
+    m_HostObjectPropertyNamesCache.clear();
+
+    for (auto it = m_FastFunctions.begin(); it != m_FastFunctions.end(); it++)
+    {
+        ClearWeak(it->hFunction);
+        Dispose(it->hFunction);
+        HostObjectUtil::Release(it->pvFunction);
+    }
+
+    m_FastFunctions.clear();
+
+    ClearHostMemberInvalidations();
+
     Dispose(m_hAsyncGeneratorConstructor);
     Dispose(m_hGetModuleResultFunction);
     Dispose(m_hToJsonFunction);
@@ -2207,6 +3006,7 @@ void V8ContextImpl::Teardown()
     Dispose(m_hHostObjectTemplate);
     Dispose(m_hTerminationException);
     Dispose(m_hFlushFunction);
+    Dispose(m_hHostObjectCacheTemplate);
     Dispose(m_hSetModuleResultKey);
     Dispose(m_hConstructorKey);
     Dispose(m_hInvalidModuleRequest);
@@ -2215,8 +3015,7 @@ void V8ContextImpl::Teardown()
     Dispose(m_hObjectNotInvocable);
     Dispose(m_hStackKey);
     Dispose(m_hInternalUseOnly);
-    Dispose(m_hAccessToken);
-    Dispose(m_hAccessTokenKey);
+    Dispose(m_hHostDelegateFunctionKey);
     Dispose(m_hCacheKey);
     Dispose(m_hHostExceptionKey);
     Dispose(m_hMissingPropertyValue);
@@ -2295,20 +3094,676 @@ bool V8ContextImpl::SetHostObjectHolder(v8::Local<v8::Object> hObject, HostObjec
         return FROM_MAYBE_DEFAULT(hObject->SetPrivate(m_hContext, GetHostObjectHolderKey(), CreateExternal(pHolder)));
     }
 
-    return false;
-}
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void* V8ContextImpl::GetHostObject(v8::Local<v8::Object> hObject)
+{
+    auto pHolder = GetHostObjectHolder(hObject);
+    if (pHolder != nullptr)
+    {
+        return pHolder->GetObject();
+    }
+
+    return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+std::shared_ptr<const StdString> V8ContextImpl::GetHostPropertyName(v8::Local<v8::String> hName)
+{
+    // Property names aren't necessarily internalized, so entries are matched by content; a
+    // string's identity hash is derived from its content. The cache is cleared when it fills up.
+    // Callers share ownership of the names they receive, so clearing the cache during a
+    // reentrant call leaves them valid.
+
+    auto identityHash = hName->GetIdentityHash();
+
+    auto range = m_PropertyNameCache.equal_range(identityHash);
+    for (auto it = range.first; it != range.second; it++)
+    {
+        if (hName->StringEquals(it->second.hName))
+        {
+            ++m_Statistics.PropertyNameCacheHitCount;
+            return it->second.spName;
+        }
+    }
+
+    ++m_Statistics.PropertyNameCacheMissCount;
+
+    if (m_PropertyNameCache.size() >= Constants::MaxPropertyNameCacheSize)
+    {
+        ClearPropertyNameCache();
+    }
+
+    auto spName = std::make_shared<const StdString>(CreateStdString(hName));
+    m_PropertyNameCache.emplace(identityHash, PropertyNameCacheEntry { CreatePersistent(hName), spName });
+    return spName;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::ClearPropertyNameCache()
+{
+    for (auto it = m_PropertyNameCache.begin(); it != m_PropertyNameCache.end(); it++)
+    {
+        Dispose(it->second.hName);
+    }
+
+    m_PropertyNameCache.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+SharedPtr<V8ObjectRef> V8ContextImpl::GetObjectRef(v8::Local<v8::Object> hObject, int32_t identityHash)
+{
+    if (!m_ObjectIdentityCacheEnabled)
+    {
+        return SharedPtr<V8ObjectRef>(new V8ObjectRef(GetWeakBinding(), ::PtrFromHandle(CreatePersistent(hObject))));
+    }
+
+    // The cache holds weak references, so it never extends the lifetime of an exported object.
+    // Dead entries are discarded as they're encountered.
+
+    auto range = m_ObjectIdentityCache.equal_range(identityHash);
+    for (auto it = range.first; it != range.second;)
+    {
+        auto spObjectRef = it->second.GetTarget();
+        if (spObjectRef.IsEmpty())
+        {
+            it = m_ObjectIdentityCache.erase(it);
+            continue;
+        }
+
+        v8::Local<v8::Object> hCachedObject = ::HandleFromPtr<v8::Object>(spObjectRef->GetObject());
+        if (hCachedObject->StrictEquals(hObject))
+        {
+            ++m_Statistics.ObjectIdentityCacheHitCount;
+            return spObjectRef;
+        }
+
+        ++it;
+    }
+
+    ++m_Statistics.ObjectIdentityCacheMissCount;
+    SharedPtr<V8ObjectRef> spObjectRef(new V8ObjectRef(GetWeakBinding(), ::PtrFromHandle(CreatePersistent(hObject))));
+
+    // A full cache is swept for dead entries, but a sweep is linear in the cache size. To keep
+    // the cost per miss constant when most entries are live, another sweep waits until there
+    // have been as many misses as the previous sweep left entries behind.
+
+    if ((m_ObjectIdentityCache.size() >= Constants::MaxObjectIdentityCacheSize) && (m_ObjectIdentityCacheMissCount >= m_ObjectIdentityCacheSweepSize))
+    {
+        for (auto it = m_ObjectIdentityCache.begin(); it != m_ObjectIdentityCache.end();)
+        {
+            it = it->second.GetTarget().IsEmpty() ? m_ObjectIdentityCache.erase(it) : ++it;
+        }
+
+        m_ObjectIdentityCacheSweepSize = m_ObjectIdentityCache.size();
+        m_ObjectIdentityCacheMissCount = 0;
+    }
+
+    if (m_ObjectIdentityCache.size() < Constants::MaxObjectIdentityCacheSize)
+    {
+        m_ObjectIdentityCache.emplace(identityHash, spObjectRef->CreateWeakRef());
+    }
+
+    ++m_ObjectIdentityCacheMissCount;
+
+    return spObjectRef;
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8ContextImpl::TryGetObjectShape(const std::vector<StdString>& names, size_t count, v8::Local<v8::DictionaryTemplate>& hTemplate)
+{
+    // Dictionary templates give objects with identical property lists a shared hidden class.
+    // Only short lists of unique ASCII non-index names are eligible; others use the slow path.
+
+    if ((count < 1) || (count > Constants::MaxObjectShapePropertyCount))
+    {
+        return false;
+    }
+
+    size_t digest = 0;
+    for (size_t index = 0; index < count; index++)
+    {
+        digest = (digest * 31) + names[index].GetDigest();
+    }
+
+    auto range = m_ObjectShapeCache.equal_range(digest);
+    for (auto it = range.first; it != range.second; it++)
+    {
+        const auto& cachedNames = it->second.Names;
+        if ((cachedNames.size() == count) && std::equal(cachedNames.cbegin(), cachedNames.cend(), names.cbegin()))
+        {
+            hTemplate = it->second.hTemplate;
+            return true;
+        }
+    }
+
+    if (m_ObjectShapeCache.size() >= Constants::MaxObjectShapeCacheSize)
+    {
+        // an uncached template costs more than it saves
+        return false;
+    }
+
+    std::vector<std::string> asciiNames;
+    asciiNames.reserve(count);
+
+    for (size_t index = 0; index < count; index++)
+    {
+        const auto& name = names[index];
+        auto length = name.GetLength();
+        if (length < 1)
+        {
+            return false;
+        }
+
+        std::string asciiName;
+        asciiName.reserve(length);
+
+        for (auto charIndex = 0; charIndex < length; charIndex++)
+        {
+            auto value = name.IsOneByte() ? static_cast<uint16_t>(name.ToOneByteCString()[charIndex]) : static_cast<uint16_t>(name.ToCString()[charIndex]);
+            if ((value > 0x7F) || ((charIndex == 0) && (value >= '0') && (value <= '9')))
+            {
+                return false;
+            }
+
+            asciiName.push_back(static_cast<char>(value));
+        }
+
+        if (std::find(asciiNames.cbegin(), asciiNames.cend(), asciiName) != asciiNames.cend())
+        {
+            return false;
+        }
+
+        asciiNames.push_back(std::move(asciiName));
+    }
+
+    std::vector<std::string_view> nameViews(asciiNames.cbegin(), asciiNames.cend());
+    hTemplate = CreateDictionaryTemplate(nameViews);
+
+    m_ObjectShapeCache.emplace(digest, ObjectShapeCacheEntry { std::vector<StdString>(names.cbegin(), names.cbegin() + count), CreatePersistent(hTemplate) });
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8ContextImpl::TryGetHostObjectTypeTemplate(const HostObjectHolder& holder, v8::Local<v8::FunctionTemplate>& hTemplate)
+{
+    // Host objects of the same type share a template on which the type's members are native data
+    // properties. V8 can cache lookups of such properties, so the named interceptors are set up
+    // as non-masking and handle only names that the type template doesn't define. The type ID
+    // normally arrives with the exported host object, so creating a wrapper needs no host call.
+
+    auto pvObject = holder.GetObject();
+    auto typeId = holder.GetTypeId();
+    if (typeId == HostObjectHolder::UnknownTypeId)
+    {
+        typeId = HostObjectUtil::GetTypeId(pvObject);
+    }
+
+    if (typeId == 0)
+    {
+        return false;
+    }
+
+    auto it = m_HostObjectTypeTemplateCache.find(typeId);
+    if (it != m_HostObjectTypeTemplateCache.end())
+    {
+        hTemplate = it->second;
+        return true;
+    }
+
+    if (m_HostObjectTypeTemplateCache.size() >= Constants::MaxHostObjectTypeTemplateCacheSize)
+    {
+        return false;
+    }
+
+    std::vector<StdString> names;
+    std::vector<StdString> extensionMethodNames;
+    HostObjectUtil::GetTypeMemberNames(pvObject, names, extensionMethodNames);
+
+    auto hContextImpl = CreateExternal(this);
+
+    hTemplate = CreateFunctionTemplate();
+    hTemplate->SetClassName(CreateString("HostObject"));
+    hTemplate->SetCallHandler(HostObjectConstructorCallHandler, hContextImpl);
+    hTemplate->Inherit(m_hHostObjectTemplate);
+
+    auto hInstanceTemplate = hTemplate->InstanceTemplate();
+    hInstanceTemplate->SetHandler(v8::NamedPropertyHandlerConfiguration(GetHostObjectProperty, SetHostObjectProperty, QueryHostObjectProperty, DeleteHostObjectProperty, GetHostObjectPropertyNames, hContextImpl, v8::PropertyHandlerFlags::kNonMasking));
+    hInstanceTemplate->SetHandler(v8::IndexedPropertyHandlerConfiguration(GetHostObjectProperty, SetHostObjectProperty, QueryHostObjectProperty, DeleteHostObjectProperty, GetHostObjectPropertyIndices, hContextImpl));
+
+    auto hMemberNameSet = v8::Set::New(m_hContext->GetIsolate());
+    for (const auto& name : names)
+    {
+        auto hName = FROM_MAYBE_DEFAULT(CreateString(name, v8::NewStringType::kInternalized));
+        if (!hName.IsEmpty() && (hName->Length() > 0) && !FROM_MAYBE_DEFAULT(hMemberNameSet->Has(m_hContext, hName)))
+        {
+            hInstanceTemplate->SetNativeDataProperty(hName, GetHostObjectMember, SetHostObjectMember, hContextImpl, ::CombineFlags(v8::DontEnum, v8::DontDelete));
+            hMemberNameSet = FROM_MAYBE_DEFAULT(hMemberNameSet->Add(m_hContext, hName), hMemberNameSet);
+        }
+    }
+
+    // A non-masking interceptor never sees names that the prototype chain defines, such as
+    // "toString" and "toJSON", so an extension method by such a name would be hidden. Those
+    // names get accessors that try the host object first and fall back to the prototype's value.
+    // Only methods are shadowed; their values don't depend on the receiver.
+
+    if (!extensionMethodNames.empty())
+    {
+        auto hToJSON = CreateString("toJSON");
+        auto hObjectPrototype = CreateObject()->GetPrototypeV2();
+
+        for (const auto& name : extensionMethodNames)
+        {
+            auto hName = FROM_MAYBE_DEFAULT(CreateString(name, v8::NewStringType::kInternalized));
+            if (hName.IsEmpty() || (hName->Length() < 1) || FROM_MAYBE_DEFAULT(hMemberNameSet->Has(m_hContext, hName)))
+            {
+                continue;
+            }
+
+            auto isPrototypeMethod = hName->StringEquals(hToJSON);
+            if (!isPrototypeMethod && hObjectPrototype->IsObject())
+            {
+                auto hValue = FROM_MAYBE_DEFAULT(hObjectPrototype.As<v8::Object>()->Get(m_hContext, hName));
+                isPrototypeMethod = !hValue.IsEmpty() && hValue->IsFunction();
+            }
+
+            if (isPrototypeMethod)
+            {
+                hInstanceTemplate->SetNativeDataProperty(hName, GetHostObjectPrototypeMember, SetHostObjectMember, hContextImpl, ::CombineFlags(v8::DontEnum, v8::DontDelete));
+                hMemberNameSet = FROM_MAYBE_DEFAULT(hMemberNameSet->Add(m_hContext, hName), hMemberNameSet);
+            }
+        }
+    }
+
+    m_HostObjectTypeTemplateCache.emplace(typeId, CreatePersistent(hTemplate));
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+v8::Local<v8::Value> V8ContextImpl::GetHostObjectPropertyValue(v8::Local<v8::Object> hHolder, void* pvObject, v8::Local<v8::String> hName)
+{
+    FROM_MAYBE_TRY
+
+        v8::Local<v8::Value> hValue;
+        if (TryGetCachedHostObjectProperty(hHolder, hName, hValue))
+        {
+            return hValue;
+        }
+
+        bool isCacheable;
+        auto hResult = ImportValue(HostObjectUtil::GetProperty(pvObject, *GetHostPropertyName(hName), isCacheable));
+        if (isCacheable)
+        {
+            CacheHostObjectProperty(hHolder, hName, hResult);
+        }
+
+        return hResult;
+
+    FROM_MAYBE_CATCH
+
+        return v8::Local<v8::Value>();
+
+    FROM_MAYBE_END
+}
+
+//-----------------------------------------------------------------------------
+
+v8::Local<v8::Object> V8ContextImpl::GetHostObjectCache(v8::Local<v8::Object> hHolder, bool create)
+{
+    // Each host object's property cache carries the member cache stamp at which it was last
+    // validated. Member invalidations newer than that stamp are applied lazily, removing only
+    // the affected entries; a cache older than the invalidation log is discarded entirely.
+
+    FROM_MAYBE_TRY
+
+        auto hCache = ::ValueAsObject(FROM_MAYBE(hHolder->GetPrivate(m_hContext, m_hCacheKey)));
+        if (!hCache.IsEmpty())
+        {
+            auto stamp = static_cast<uint32_t>(hCache->GetInternalField(0).As<v8::Value>().As<v8::Integer>()->Value());
+            if (stamp == m_HostMemberCacheStamp)
+            {
+                return hCache;
+            }
+
+            if (stamp >= m_HostMemberCacheBaseStamp)
+            {
+                for (auto it = m_HostMemberInvalidations.rbegin(); (it != m_HostMemberInvalidations.rend()) && (it->Stamp > stamp); it++)
+                {
+                    ASSERT_EVAL(FROM_MAYBE(hCache->Delete(m_hContext, it->hName)));
+                }
+
+                hCache->SetInternalField(0, v8::Integer::NewFromUnsigned(m_hContext->GetIsolate(), m_HostMemberCacheStamp));
+                return hCache;
+            }
+
+            if (!create)
+            {
+                ASSERT_EVAL(FROM_MAYBE(hHolder->DeletePrivate(m_hContext, m_hCacheKey)));
+                return v8::Local<v8::Object>();
+            }
+        }
+        else if (!create)
+        {
+            return hCache;
+        }
+
+        hCache = FROM_MAYBE(m_hHostObjectCacheTemplate->NewInstance(m_hContext));
+        hCache->SetInternalField(0, v8::Integer::NewFromUnsigned(m_hContext->GetIsolate(), m_HostMemberCacheStamp));
+        hCache->SetInternalField(1, GetUndefined());
+        ASSERT_EVAL(FROM_MAYBE(hHolder->SetPrivate(m_hContext, m_hCacheKey, hCache)));
+        return hCache;
+
+    FROM_MAYBE_CATCH
+
+        return v8::Local<v8::Object>();
+
+    FROM_MAYBE_END
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8ContextImpl::TryGetCachedHostObjectProperty(v8::Local<v8::Object> hHolder, v8::Local<v8::String> hName, v8::Local<v8::Value>& hValue)
+{
+    FROM_MAYBE_TRY
+
+        auto hCache = GetHostObjectCache(hHolder, false);
+        if (!hCache.IsEmpty() && FROM_MAYBE(hCache->HasOwnProperty(m_hContext, hName)))
+        {
+            hValue = FROM_MAYBE(hCache->Get(m_hContext, hName));
+            if (hValue->StrictEquals(m_hMissingPropertyValue))
+            {
+                hValue = v8::Local<v8::Value>();
+            }
+
+            return true;
+        }
+
+    FROM_MAYBE_CATCH_CONSUME
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::CacheHostObjectProperty(v8::Local<v8::Object> hHolder, v8::Local<v8::String> hName, v8::Local<v8::Value> hValue)
+{
+    FROM_MAYBE_TRY
+
+        auto hCache = GetHostObjectCache(hHolder, true);
+        if (!hCache.IsEmpty())
+        {
+            ASSERT_EVAL(FROM_MAYBE(hCache->Set(m_hContext, hName, !hValue.IsEmpty() ? hValue : m_hMissingPropertyValue)));
+        }
+
+    FROM_MAYBE_CATCH_CONSUME
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::ClearHostMemberInvalidations()
+{
+    for (auto it = m_HostMemberInvalidations.begin(); it != m_HostMemberInvalidations.end(); it++)
+    {
+        Dispose(it->hName);
+    }
+
+    m_HostMemberInvalidations.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+int32_t V8ContextImpl::GetHostObjectTypeId(v8::Local<v8::Object> hHolder, void* pvObject)
+{
+    // The host object's type ID is kept in its property cache, which is discarded whenever the
+    // access settings change. This limits type ID retrieval to one host call per cache lifetime.
+
+    auto hCache = GetHostObjectCache(hHolder, true);
+    if (hCache.IsEmpty())
+    {
+        return HostObjectUtil::GetTypeId(pvObject);
+    }
+
+    auto hTypeId = hCache->GetInternalField(1).As<v8::Value>();
+    if (hTypeId->IsInt32())
+    {
+        return hTypeId.As<v8::Int32>()->Value();
+    }
+
+    auto typeId = HostObjectUtil::GetTypeId(pvObject);
+    hCache->SetInternalField(1, v8::Integer::New(m_hContext->GetIsolate(), typeId));
+    return typeId;
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8ContextImpl::TryGetCachedHostObjectPropertyNames(v8::Local<v8::Object> hHolder, void* pvObject, int32_t& typeId, v8::Local<v8::Array>& hNames, v8::Local<v8::Set>& hNameSet)
+{
+    // Host objects whose members are fully determined by their type share a prebuilt array of
+    // property names. Entries are validated against the base stamp that governs the property
+    // cache and against a separate stamp that enumeration setting changes advance.
+
+    typeId = GetHostObjectTypeId(hHolder, pvObject);
+    if (typeId != 0)
+    {
+        auto it = m_HostObjectPropertyNamesCache.find(typeId);
+        if ((it != m_HostObjectPropertyNamesCache.end()) && (it->second.Stamp >= m_HostMemberCacheBaseStamp) && (it->second.EnumerationStamp == m_HostObjectPropertyNamesStamp))
+        {
+            hNames = it->second.hNames;
+            hNameSet = it->second.hNameSet;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+v8::Local<v8::Array> V8ContextImpl::GetHostObjectPropertyNameArray(v8::Local<v8::Object> hHolder, void* pvObject)
+{
+    FROM_MAYBE_TRY
+
+        int32_t typeId;
+        v8::Local<v8::Array> hNames;
+        v8::Local<v8::Set> hNameSet;
+        if (TryGetCachedHostObjectPropertyNames(hHolder, pvObject, typeId, hNames, hNameSet))
+        {
+            return hNames;
+        }
+
+        std::vector<StdString> names;
+        HostObjectUtil::GetPropertyNames(pvObject, names);
+        auto nameCount = static_cast<int>(names.size());
+
+        hNames = CreateArray(nameCount);
+        if (typeId == 0)
+        {
+            for (auto index = 0; index < nameCount; index++)
+            {
+                ASSERT_EVAL(FROM_MAYBE(hNames->Set(m_hContext, index, FROM_MAYBE(CreateString(names[index])))));
+            }
+
+            return hNames;
+        }
+
+        hNameSet = v8::Set::New(m_hContext->GetIsolate());
+        for (auto index = 0; index < nameCount; index++)
+        {
+            auto hName = FROM_MAYBE(CreateString(names[index], v8::NewStringType::kInternalized));
+            ASSERT_EVAL(FROM_MAYBE(hNames->Set(m_hContext, index, hName)));
+            hNameSet = FROM_MAYBE(hNameSet->Add(m_hContext, hName));
+        }
+
+        auto it = m_HostObjectPropertyNamesCache.find(typeId);
+        if (it != m_HostObjectPropertyNamesCache.end())
+        {
+            Dispose(it->second.hNameSet);
+            Dispose(it->second.hNames);
+            it->second = { m_HostMemberCacheStamp, m_HostObjectPropertyNamesStamp, CreatePersistent(hNames), CreatePersistent(hNameSet) };
+        }
+        else if (m_HostObjectPropertyNamesCache.size() < Constants::MaxHostObjectPropertyNamesCacheSize)
+        {
+            m_HostObjectPropertyNamesCache.emplace(typeId, HostObjectPropertyNamesEntry { m_HostMemberCacheStamp, m_HostObjectPropertyNamesStamp, CreatePersistent(hNames), CreatePersistent(hNameSet) });
+        }
+
+        return hNames;
+
+    FROM_MAYBE_CATCH
+
+        return v8::Local<v8::Array>();
+
+    FROM_MAYBE_END
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::InvalidateGlobalMemberIndex()
+{
+    for (auto it = m_GlobalMemberIndex.begin(); it != m_GlobalMemberIndex.end(); it++)
+    {
+        Dispose(it->second.hName);
+    }
+
+    m_GlobalMemberIndex.clear();
+    m_GlobalMemberIndexability.clear();
+    m_GlobalMemberIndexValid = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::UpdateGlobalMemberIndex()
+{
+    // Only host objects whose members are fully determined by their type are indexed. Their
+    // property sets can change only along with the host member cache stamp, which therefore
+    // governs the index as well. Other global members are still queried on every lookup.
+
+    if (m_GlobalMemberIndexValid && (m_GlobalMemberIndexStamp == m_HostMemberCacheStamp))
+    {
+        return;
+    }
+
+    InvalidateGlobalMemberIndex();
+
+    std::vector<bool> indexability;
+    indexability.reserve(m_GlobalMembersStack.size());
+
+    for (const auto& member : m_GlobalMembersStack)
+    {
+        auto hMember = CreateLocal(member.second);
+        auto pvObject = GetHostObject(hMember);
+
+        auto indexable = false;
+        if (pvObject != nullptr)
+        {
+            try
+            {
+                indexable = GetHostObjectTypeId(hMember, pvObject) != 0;
+            }
+            catch (const HostException&)
+            {
+            }
+        }
+
+        indexability.push_back(indexable);
+    }
+
+    m_GlobalMemberIndexability = std::move(indexability);
+    m_GlobalMemberIndexStamp = m_HostMemberCacheStamp;
+    m_GlobalMemberIndexValid = true;
+}
+
+//-----------------------------------------------------------------------------
+
+int32_t V8ContextImpl::GetIndexedGlobalMemberOwner(v8::Local<v8::String> hName)
+{
+    FROM_MAYBE_TRY
+
+        auto identityHash = hName->GetIdentityHash();
+
+        auto range = m_GlobalMemberIndex.equal_range(identityHash);
+        for (auto it = range.first; it != range.second; it++)
+        {
+            if ((it->second.hName == hName) || it->second.hName->StrictEquals(hName))
+            {
+                return it->second.OwnerIndex;
+            }
+        }
+
+        auto ownerIndex = -1;
+        for (auto index = static_cast<int32_t>(m_GlobalMembersStack.size()) - 1; index >= 0; index--)
+        {
+            if (m_GlobalMemberIndexability[index] && FROM_MAYBE(m_GlobalMembersStack[index].second->HasOwnProperty(m_hContext, hName)))
+            {
+                ownerIndex = index;
+                break;
+            }
+        }
+
+        // the queries above can call into the host and invalidate the index
+        if (m_GlobalMemberIndexValid && (m_GlobalMemberIndex.size() < Constants::MaxGlobalMemberIndexSize))
+        {
+            m_GlobalMemberIndex.emplace(identityHash, GlobalMemberIndexEntry { CreatePersistent(hName), ownerIndex });
+        }
+
+        return ownerIndex;
+
+    FROM_MAYBE_CATCH
+
+        throw;
+
+    FROM_MAYBE_END
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8ContextImpl::TryGetGlobalMemberOwner(v8::Local<v8::String> hName, v8::Local<v8::Object>& hOwner)
+{
+    if (m_GlobalMembersStack.empty())
+    {
+        return false;
+    }
+
+    UpdateGlobalMemberIndex();
+    auto ownerIndex = GetIndexedGlobalMemberOwner(hName);
+
+    FROM_MAYBE_TRY
+
+        // members above the indexed owner take precedence; only those that aren't indexed need checking
+
+        for (auto index = static_cast<int32_t>(m_GlobalMembersStack.size()) - 1; index > ownerIndex; index--)
+        {
+            if ((index >= static_cast<int32_t>(m_GlobalMemberIndexability.size())) || !m_GlobalMemberIndexability[index])
+            {
+                if (FROM_MAYBE(m_GlobalMembersStack[index].second->HasOwnProperty(m_hContext, hName)))
+                {
+                    hOwner = CreateLocal(m_GlobalMembersStack[index].second);
+                    return true;
+                }
+            }
+        }
+
+        if ((ownerIndex >= 0) && (ownerIndex < static_cast<int32_t>(m_GlobalMembersStack.size())))
+        {
+            hOwner = CreateLocal(m_GlobalMembersStack[ownerIndex].second);
+            return true;
+        }
 
-//-----------------------------------------------------------------------------
+        return false;
 
-void* V8ContextImpl::GetHostObject(v8::Local<v8::Object> hObject)
-{
-    auto pHolder = GetHostObjectHolder(hObject);
-    if (pHolder != nullptr)
-    {
-        return pHolder->GetObject();
-    }
+    FROM_MAYBE_CATCH
 
-    return nullptr;
+        throw;
+
+    FROM_MAYBE_END
 }
 
 //-----------------------------------------------------------------------------
@@ -2431,16 +3886,10 @@ v8::Intercepted V8ContextImpl::GetGlobalProperty(v8::Local<v8::Name> hKey, const
         auto pContextImpl = ::GetContextImplFromHolder(info);
         if (CheckContextImplForGlobalObjectCallback(pContextImpl))
         {
-            const auto& stack = pContextImpl->m_GlobalMembersStack;
-            if (!stack.empty())
+            v8::Local<v8::Object> hOwner;
+            if (pContextImpl->TryGetGlobalMemberOwner(hName, hOwner))
             {
-                for (auto it = stack.rbegin(); it != stack.rend(); it++)
-                {
-                    if (FROM_MAYBE(it->second->HasOwnProperty(pContextImpl->m_hContext, hName)))
-                    {
-                        CALLBACK_RETURN(FROM_MAYBE(it->second->Get(pContextImpl->m_hContext, hName)));
-                    }
-                }
+                CALLBACK_RETURN(FROM_MAYBE(hOwner->Get(pContextImpl->m_hContext, hName)));
             }
         }
 
@@ -2466,17 +3915,11 @@ v8::Intercepted V8ContextImpl::SetGlobalProperty(v8::Local<v8::Name> hKey, v8::L
         auto pContextImpl = ::GetContextImplFromHolder(info);
         if (CheckContextImplForGlobalObjectCallback(pContextImpl))
         {
-            const auto& stack = pContextImpl->m_GlobalMembersStack;
-            if (!stack.empty())
+            v8::Local<v8::Object> hOwner;
+            if (pContextImpl->TryGetGlobalMemberOwner(hName, hOwner))
             {
-                for (auto it = stack.rbegin(); it != stack.rend(); it++)
-                {
-                    if (FROM_MAYBE(it->second->HasOwnProperty(pContextImpl->m_hContext, hName)))
-                    {
-                        ASSERT_EVAL(FROM_MAYBE(it->second->Set(pContextImpl->m_hContext, hName, hValue)));
-                        CALLBACK_RETURN_VOID();
-                    }
-                }
+                ASSERT_EVAL(FROM_MAYBE(hOwner->Set(pContextImpl->m_hContext, hName, hValue)));
+                CALLBACK_RETURN_VOID();
             }
         }
 
@@ -2502,16 +3945,10 @@ v8::Intercepted V8ContextImpl::QueryGlobalProperty(v8::Local<v8::Name> hKey, con
         auto pContextImpl = ::GetContextImplFromHolder(info);
         if (CheckContextImplForGlobalObjectCallback(pContextImpl))
         {
-            const auto& stack = pContextImpl->m_GlobalMembersStack;
-            if (!stack.empty())
+            v8::Local<v8::Object> hOwner;
+            if (pContextImpl->TryGetGlobalMemberOwner(hName, hOwner))
             {
-                for (auto it = stack.rbegin(); it != stack.rend(); it++)
-                {
-                    if (FROM_MAYBE(it->second->HasOwnProperty(pContextImpl->m_hContext, hName)))
-                    {
-                        CALLBACK_RETURN(FROM_MAYBE(it->second->GetPropertyAttributes(pContextImpl->m_hContext, hName)));
-                    }
-                }
+                CALLBACK_RETURN(FROM_MAYBE(hOwner->GetPropertyAttributes(pContextImpl->m_hContext, hName)));
             }
         }
 
@@ -2537,33 +3974,27 @@ v8::Intercepted V8ContextImpl::DeleteGlobalProperty(v8::Local<v8::Name> hKey, co
         auto pContextImpl = ::GetContextImplFromHolder(info);
         if (CheckContextImplForGlobalObjectCallback(pContextImpl))
         {
-            const auto& stack = pContextImpl->m_GlobalMembersStack;
-            if (!stack.empty())
+            v8::Local<v8::Object> hOwner;
+            if (pContextImpl->TryGetGlobalMemberOwner(hName, hOwner))
             {
-                for (auto it = stack.rbegin(); it != stack.rend(); it++)
+                // WORKAROUND: v8::Object::Delete() crashes if a custom property deleter calls
+                // ThrowException(). Interestingly, there is no crash if the same deleter is
+                // invoked directly from script via the delete operator.
+
+                auto pvObject = pContextImpl->GetHostObject(hOwner);
+                if (pvObject != nullptr)
                 {
-                    if (FROM_MAYBE(it->second->HasOwnProperty(pContextImpl->m_hContext, hName)))
+                    try
                     {
-                        // WORKAROUND: v8::Object::Delete() crashes if a custom property deleter calls
-                        // ThrowException(). Interestingly, there is no crash if the same deleter is
-                        // invoked directly from script via the delete operator.
-
-                        auto pvObject = pContextImpl->GetHostObject(it->second);
-                        if (pvObject != nullptr)
-                        {
-                            try
-                            {
-                                CALLBACK_RETURN(HostObjectUtil::DeleteProperty(pvObject, pContextImpl->CreateStdString(hName)));
-                            }
-                            catch (const HostException&)
-                            {
-                                CALLBACK_RETURN(false);
-                            }
-                        }
-
-                        CALLBACK_RETURN(FROM_MAYBE(it->second->Delete(pContextImpl->m_hContext, hName)));
+                        CALLBACK_RETURN(HostObjectUtil::DeleteProperty(pvObject, pContextImpl->CreateStdString(hName)));
+                    }
+                    catch (const HostException&)
+                    {
+                        CALLBACK_RETURN(false);
                     }
                 }
+
+                CALLBACK_RETURN(FROM_MAYBE(hOwner->Delete(pContextImpl->m_hContext, hName)));
             }
         }
 
@@ -2947,6 +4378,91 @@ void V8ContextImpl::GetFastHostObjectAsyncIterator(const v8::FunctionCallbackInf
 
 //-----------------------------------------------------------------------------
 
+void V8ContextImpl::GetHostEnumeratorChunk(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    FROM_MAYBE_TRY
+
+        auto pContextImpl = ::GetContextImplFromData(info);
+        if (pContextImpl != nullptr)
+        {
+            void* pvEnumerator;
+            size_t maxCount;
+            if (TryGetEnumeratorChunkArgs(pContextImpl, info, pvEnumerator, maxCount))
+            {
+                try
+                {
+                    std::vector<V8Value> items;
+                    if (HostObjectUtil::GetEnumeratorChunk(pvEnumerator, maxCount, items))
+                    {
+                        std::vector<v8::Local<v8::Value>> elements;
+                        elements.reserve(items.size());
+
+                        for (const auto& item : items)
+                        {
+                            elements.push_back(pContextImpl->ImportValue(item));
+                        }
+
+                        CALLBACK_RETURN(pContextImpl->CreateArray(elements.data(), elements.size()));
+                    }
+                }
+                catch (const HostException& exception)
+                {
+                    pContextImpl->ThrowScriptException(exception);
+                }
+            }
+        }
+
+    FROM_MAYBE_CATCH_CONSUME
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::FetchHostAsyncEnumeratorChunk(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    FROM_MAYBE_TRY
+
+        auto pContextImpl = ::GetContextImplFromData(info);
+        if (pContextImpl != nullptr)
+        {
+            void* pvEnumerator;
+            size_t maxCount;
+            if (TryGetEnumeratorChunkArgs(pContextImpl, info, pvEnumerator, maxCount))
+            {
+                try
+                {
+                    CALLBACK_RETURN(pContextImpl->ImportValue(HostObjectUtil::FetchAsyncEnumeratorChunk(pvEnumerator, maxCount)));
+                }
+                catch (const HostException& exception)
+                {
+                    pContextImpl->ThrowScriptException(exception);
+                }
+            }
+        }
+
+    FROM_MAYBE_CATCH_CONSUME
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8ContextImpl::TryGetEnumeratorChunkArgs(V8ContextImpl* pContextImpl, const v8::FunctionCallbackInfo<v8::Value>& info, void*& pvEnumerator, size_t& maxCount)
+{
+    if ((info.Length() > 1) && info[0]->IsObject())
+    {
+        pvEnumerator = pContextImpl->GetHostObject(info[0].As<v8::Object>());
+
+        double count;
+        if ((pvEnumerator != nullptr) && ::TryGetValueAsNumber(pContextImpl->m_hContext, info[1], count))
+        {
+            maxCount = static_cast<size_t>(std::min(std::max(count, 1.0), static_cast<double>(Constants::MaxHostEnumeratorChunkSize)));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
 void V8ContextImpl::GetHostObjectJson(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
     FROM_MAYBE_TRY
@@ -2989,63 +4505,302 @@ void V8ContextImpl::CreateFunctionForHostDelegate(const v8::FunctionCallbackInfo
         auto pContextImpl = ::GetContextImplFromData(info);
         if (pContextImpl != nullptr)
         {
-            CALLBACK_RETURN(FROM_MAYBE(v8::Function::New(pContextImpl->m_hContext, InvokeHostDelegate, info.This())));
+            // The function is stored on the holder, so it shares the holder's lifetime; the V8
+            // object cache references holders weakly. Repeat conversions of the same delegate
+            // return the same function, which lets V8 keep its call-site feedback.
+
+            auto hHolder = info.This();
+            auto hFunction = FROM_MAYBE(hHolder->GetPrivate(pContextImpl->m_hContext, pContextImpl->m_hHostDelegateFunctionKey));
+            if (hFunction->IsFunction())
+            {
+                CALLBACK_RETURN(hFunction);
+            }
+
+            auto callback = pContextImpl->m_hHostDelegateTemplate->HasInstance(hHolder) ? InvokeHostDelegateDirect : InvokeHostDelegate;
+            hFunction = FROM_MAYBE(v8::Function::New(pContextImpl->m_hContext, callback, hHolder));
+            ASSERT_EVAL(FROM_MAYBE(hHolder->SetPrivate(pContextImpl->m_hContext, pContextImpl->m_hHostDelegateFunctionKey, hFunction)));
+            CALLBACK_RETURN(hFunction);
+        }
+
+    FROM_MAYBE_CATCH_CONSUME
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::InvokeHostDelegate(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    auto hTarget = ::ValueAsObject(info.Data());
+    if (!hTarget.IsEmpty())
+    {
+        auto argCount = static_cast<size_t>(info.Length());
+
+        if (argCount < 1)
+        {
+            if (info.IsConstructCall())
+            {
+                CALLBACK_RETURN(FROM_MAYBE_DEFAULT(hTarget->CallAsConstructor(info.GetIsolate()->GetCurrentContext(), 0, nullptr)));
+            }
+
+            CALLBACK_RETURN(FROM_MAYBE_DEFAULT(hTarget->CallAsFunction(info.GetIsolate()->GetCurrentContext(), hTarget, 0, nullptr)));
+        }
+
+        if (argCount <= Constants::MaxInlineArgCount)
+        {
+            v8::Local<v8::Value> args[argCount];
+
+            for (size_t index = 0; index < argCount; index++)
+            {
+                args[index] = info[index];
+            }
+
+            if (info.IsConstructCall())
+            {
+                CALLBACK_RETURN(FROM_MAYBE_DEFAULT(hTarget->CallAsConstructor(info.GetIsolate()->GetCurrentContext(), argCount, args)));
+            }
+
+            CALLBACK_RETURN(FROM_MAYBE_DEFAULT(hTarget->CallAsFunction(info.GetIsolate()->GetCurrentContext(), hTarget, argCount, args)));
+        }
+
+        std::vector<v8::Local<v8::Value>> args;
+        args.reserve(argCount);
+
+        for (size_t index = 0; index < argCount; index++)
+        {
+            args.push_back(info[index]);
+        }
+
+        if (info.IsConstructCall())
+        {
+            CALLBACK_RETURN(FROM_MAYBE_DEFAULT(hTarget->CallAsConstructor(info.GetIsolate()->GetCurrentContext(), argCount, args.data())));
+        }
+
+        CALLBACK_RETURN(FROM_MAYBE_DEFAULT(hTarget->CallAsFunction(info.GetIsolate()->GetCurrentContext(), hTarget, argCount, args.data())));
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::InvokeHostDelegateDirect(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    // Functions created for ordinary host delegates invoke the host directly rather than
+    // re-entering V8 through the holder's call handler.
+
+    auto hHolder = ::ValueAsObject(info.Data());
+    if (!hHolder.IsEmpty())
+    {
+        auto pContextImpl = ::GetContextImplFromContext(info.GetIsolate()->GetCurrentContext());
+        if (CheckContextImplForHostObjectCallback(pContextImpl))
+        {
+            auto pvObject = pContextImpl->GetHostObject(hHolder);
+            if (pvObject != nullptr)
+            {
+                pContextImpl->InvokeHostObject(pvObject, info);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::InvokeFastFunction(const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    auto hEntry = ::ValueAsExternal(info.Data());
+    if (hEntry.IsEmpty())
+    {
+        return;
+    }
+
+    auto pEntry = static_cast<FastFunctionEntry*>(hEntry->Value());
+    auto pContextImpl = pEntry->pContextImpl;
+    if (CheckContextImplForGlobalObjectCallback(pContextImpl))
+    {
+        auto argCount = pEntry->ArgTypes.size();
+        FastHostObjectUtil::CallValue args[Constants::MaxFastFunctionArgCount] {};
+        StdString strings[Constants::MaxFastFunctionArgCount];
+
+        FROM_MAYBE_TRY
+
+            for (size_t index = 0; index < argCount; index++)
+            {
+                auto hArg = info[static_cast<int>(index)];
+                switch (pEntry->ArgTypes[index])
+                {
+                    case FastHostObjectUtil::CallType::Boolean:
+                        args[index].Int32Value = hArg->BooleanValue(info.GetIsolate()) ? 1 : 0;
+                        break;
+
+                    case FastHostObjectUtil::CallType::Int32:
+                        args[index].Int32Value = FROM_MAYBE(hArg->Int32Value(pContextImpl->m_hContext));
+                        break;
+
+                    case FastHostObjectUtil::CallType::Double:
+                        args[index].DoubleValue = FROM_MAYBE(hArg->NumberValue(pContextImpl->m_hContext));
+                        break;
+
+                    case FastHostObjectUtil::CallType::String:
+                        strings[index] = pContextImpl->CreateStdString(hArg);
+                        args[index].StringValue.IsOneByte = strings[index].IsOneByte() ? 1 : 0;
+                        args[index].StringValue.pData = strings[index].IsOneByte() ? static_cast<const void*>(strings[index].ToOneByteCString()) : static_cast<const void*>(strings[index].ToCString());
+                        args[index].StringValue.Length = strings[index].GetLength();
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+
+        FROM_MAYBE_CATCH
+
+            return;
+
+        FROM_MAYBE_END
+
+        try
+        {
+            FastHostObjectUtil::CallValue result {};
+            FastHostObjectUtil::InvokeFunction(pEntry->pvFunction, argCount, args, result);
+
+            switch (pEntry->ReturnType)
+            {
+                case FastHostObjectUtil::CallType::Boolean:
+                    info.GetReturnValue().Set(result.Int32Value != 0);
+                    break;
+
+                case FastHostObjectUtil::CallType::Int32:
+                    info.GetReturnValue().Set(result.Int32Value);
+                    break;
+
+                case FastHostObjectUtil::CallType::Double:
+                    info.GetReturnValue().Set(result.DoubleValue);
+                    break;
+
+                default:
+                    break;
+            }
+        }
+        catch (const HostException& exception)
+        {
+            pContextImpl->ThrowScriptException(exception);
         }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::DisposeFastFunction(v8::Isolate* pIsolate, Persistent<v8::Function>* phFunction, FastFunctionEntry* pEntry, V8ContextImpl* pContextImpl)
+{
+    IGNORE_UNUSED(pIsolate);
 
-    FROM_MAYBE_CATCH_CONSUME
+    pContextImpl->m_spIsolateImpl->QueueHostObjectRelease(pEntry->pvFunction);
+    phFunction->Dispose();
+
+    pContextImpl->m_FastFunctions.remove_if([pEntry] (const FastFunctionEntry& entry)
+    {
+        return &entry == pEntry;
+    });
 }
 
 //-----------------------------------------------------------------------------
 
-void V8ContextImpl::InvokeHostDelegate(const v8::FunctionCallbackInfo<v8::Value>& info)
+template <typename TResult, typename... TArgs>
+TResult V8ContextImpl::CallFastFunction(v8::Local<v8::Value> /*hReceiver*/, TArgs... args, v8::FastApiCallbackOptions& options)
 {
-    auto hTarget = ::ValueAsObject(info.Data());
-    if (!hTarget.IsEmpty())
+    auto pEntry = static_cast<FastFunctionEntry*>(options.data.As<v8::External>()->Value());
+
+    FastHostObjectUtil::CallValue callArgs[Constants::MaxFastFunctionArgCount + 1] {};
+    size_t index = 0;
+
+    ([&] (auto&& arg)
     {
-        auto argCount = static_cast<size_t>(info.Length());
+        using TArg = std::decay_t<decltype(arg)>;
+        auto& callArg = callArgs[index++];
 
-        if (argCount < 1)
+        if constexpr (std::is_same_v<TArg, bool>)
         {
-            if (info.IsConstructCall())
-            {
-                CALLBACK_RETURN(FROM_MAYBE_DEFAULT(hTarget->CallAsConstructor(info.GetIsolate()->GetCurrentContext(), 0, nullptr)));
-            }
-
-            CALLBACK_RETURN(FROM_MAYBE_DEFAULT(hTarget->CallAsFunction(info.GetIsolate()->GetCurrentContext(), hTarget, 0, nullptr)));
+            callArg.Int32Value = arg ? 1 : 0;
         }
-
-        if (argCount <= Constants::MaxInlineArgCount)
+        else if constexpr (std::is_same_v<TArg, int32_t>)
         {
-            v8::Local<v8::Value> args[argCount];
+            callArg.Int32Value = arg;
+        }
+        else if constexpr (std::is_same_v<TArg, double>)
+        {
+            callArg.DoubleValue = arg;
+        }
+        else
+        {
+            callArg.StringValue.pData = arg.data;
+            callArg.StringValue.Length = static_cast<int32_t>(arg.length);
+            callArg.StringValue.IsOneByte = 1;
+        }
+    }(args), ...);
 
-            for (size_t index = 0; index < argCount; index++)
-            {
-                args[index] = info[index];
-            }
+    auto pContextImpl = pEntry->pContextImpl;
+    ++pContextImpl->m_Statistics.FastFunctionCallCount;
 
-            if (info.IsConstructCall())
-            {
-                CALLBACK_RETURN(FROM_MAYBE_DEFAULT(hTarget->CallAsConstructor(info.GetIsolate()->GetCurrentContext(), argCount, args)));
-            }
+    FastHostObjectUtil::CallValue result {};
 
-            CALLBACK_RETURN(FROM_MAYBE_DEFAULT(hTarget->CallAsFunction(info.GetIsolate()->GetCurrentContext(), hTarget, argCount, args)));
-        }
+    try
+    {
+        V8IsolateImpl::FastCallScope isolateFastCallScope(*pContextImpl->m_spIsolateImpl);
+        FastHostObjectUtil::InvokeFunction(pEntry->pvFunction, sizeof...(TArgs), callArgs, result);
+    }
+    catch (const HostException& exception)
+    {
+        // V8 no longer offers a fast call fallback; a fast call reports failure by throwing
+        // through its isolate within a handle scope. The reentry guard has been released at this
+        // point, as importing the host exception may require host calls.
 
-        std::vector<v8::Local<v8::Value>> args;
-        args.reserve(argCount);
+        v8::HandleScope handleScope(options.isolate);
+        pContextImpl->ThrowScriptException(exception);
+    }
 
-        for (size_t index = 0; index < argCount; index++)
-        {
-            args.push_back(info[index]);
-        }
+    if constexpr (std::is_same_v<TResult, bool>)
+    {
+        return result.Int32Value != 0;
+    }
+    else if constexpr (std::is_same_v<TResult, int32_t>)
+    {
+        return result.Int32Value;
+    }
+    else if constexpr (std::is_same_v<TResult, double>)
+    {
+        return result.DoubleValue;
+    }
+}
 
-        if (info.IsConstructCall())
+//-----------------------------------------------------------------------------
+
+template <typename TResult, typename... TArgs>
+const void* V8ContextImpl::GetFastFunctionAddress(const FastHostObjectUtil::CallType* pArgTypes, size_t argCount)
+{
+    if (argCount < 1)
+    {
+        return reinterpret_cast<const void*>(&CallFastFunction<TResult, TArgs...>);
+    }
+
+    if constexpr (sizeof...(TArgs) < Constants::MaxFastFunctionArgCount)
+    {
+        switch (*pArgTypes)
         {
-            CALLBACK_RETURN(FROM_MAYBE_DEFAULT(hTarget->CallAsConstructor(info.GetIsolate()->GetCurrentContext(), argCount, args.data())));
-        }
+            case FastHostObjectUtil::CallType::Boolean:
+                return GetFastFunctionAddress<TResult, TArgs..., bool>(pArgTypes + 1, argCount - 1);
 
-        CALLBACK_RETURN(FROM_MAYBE_DEFAULT(hTarget->CallAsFunction(info.GetIsolate()->GetCurrentContext(), hTarget, argCount, args.data())));
+            case FastHostObjectUtil::CallType::Int32:
+                return GetFastFunctionAddress<TResult, TArgs..., int32_t>(pArgTypes + 1, argCount - 1);
+
+            case FastHostObjectUtil::CallType::Double:
+                return GetFastFunctionAddress<TResult, TArgs..., double>(pArgTypes + 1, argCount - 1);
+
+            case FastHostObjectUtil::CallType::String:
+                return GetFastFunctionAddress<TResult, TArgs..., const v8::FastOneByteString&>(pArgTypes + 1, argCount - 1);
+
+            default:
+                break;
+        }
     }
+
+    return nullptr;
 }
 
 //-----------------------------------------------------------------------------
@@ -3074,37 +4829,7 @@ v8::Intercepted V8ContextImpl::GetHostObjectProperty(v8::Local<v8::Name> hKey, c
             {
                 try
                 {
-                    auto hAccessToken = FROM_MAYBE(hHolder->GetPrivate(pContextImpl->m_hContext, pContextImpl->m_hAccessTokenKey));
-                    if (pContextImpl->m_hAccessToken != hAccessToken)
-                    {
-                        ASSERT_EVAL(FROM_MAYBE(hHolder->DeletePrivate(pContextImpl->m_hContext, pContextImpl->m_hCacheKey)));
-                        ASSERT_EVAL(FROM_MAYBE(hHolder->SetPrivate(pContextImpl->m_hContext, pContextImpl->m_hAccessTokenKey, pContextImpl->m_hAccessToken)));
-                    }
-                    else
-                    {
-                        auto hCache = ::ValueAsObject(FROM_MAYBE(hHolder->GetPrivate(pContextImpl->m_hContext, pContextImpl->m_hCacheKey)));
-                        if (!hCache.IsEmpty() && FROM_MAYBE(hCache->HasOwnProperty(pContextImpl->m_hContext, hName)))
-                        {
-                            auto hValue = FROM_MAYBE(hCache->Get(pContextImpl->m_hContext, hName));
-                            CALLBACK_RETURN(!hValue->StrictEquals(pContextImpl->m_hMissingPropertyValue) ? hValue : v8::Local<v8::Value>());
-                        }
-                    }
-
-                    bool isCacheable;
-                    auto hResult = pContextImpl->ImportValue(HostObjectUtil::GetProperty(pvObject, pContextImpl->CreateStdString(hName), isCacheable));
-                    if (isCacheable)
-                    {
-                        auto hCache = ::ValueAsObject(FROM_MAYBE(hHolder->GetPrivate(pContextImpl->m_hContext, pContextImpl->m_hCacheKey)));
-                        if (hCache.IsEmpty())
-                        {
-                            hCache = pContextImpl->CreateObject();
-                            ASSERT_EVAL(FROM_MAYBE(hHolder->SetPrivate(pContextImpl->m_hContext, pContextImpl->m_hCacheKey, hCache)));
-                        }
-
-                        ASSERT_EVAL(FROM_MAYBE(hCache->Set(pContextImpl->m_hContext, hName, !hResult.IsEmpty() ? hResult : pContextImpl->m_hMissingPropertyValue)));
-                    }
-
-                    CALLBACK_RETURN(hResult);
+                    CALLBACK_RETURN(pContextImpl->GetHostObjectPropertyValue(hHolder, pvObject, hName));
                 }
                 catch (const HostException& exception)
                 {
@@ -3138,7 +4863,8 @@ v8::Intercepted V8ContextImpl::SetHostObjectProperty(v8::Local<v8::Name> hKey, v
         {
             try
             {
-                HostObjectUtil::SetProperty(pvObject, pContextImpl->CreateStdString(hName), pContextImpl->ExportValue(hValue));
+                auto spName = pContextImpl->GetHostPropertyName(hName);
+                HostObjectUtil::SetProperty(pvObject, *spName, pContextImpl->ExportValue(hValue));
                 CALLBACK_RETURN_VOID();
             }
             catch (const HostException& exception)
@@ -3166,15 +4892,30 @@ v8::Intercepted V8ContextImpl::QueryHostObjectProperty(v8::Local<v8::Name> hKey,
     auto pContextImpl = ::GetContextImplFromData(info);
     if (CheckContextImplForHostObjectCallback(pContextImpl))
     {
-        auto pvObject = pContextImpl->GetHostObject(info.HolderV2());
+        auto hHolder = info.HolderV2();
+        auto pvObject = pContextImpl->GetHostObject(hHolder);
         if (pvObject != nullptr)
         {
             try
             {
+                int32_t typeId;
+                v8::Local<v8::Array> hNames;
+                v8::Local<v8::Set> hNameSet;
+                if (pContextImpl->TryGetCachedHostObjectPropertyNames(hHolder, pvObject, typeId, hNames, hNameSet))
+                {
+                    if (FROM_MAYBE_DEFAULT(hNameSet->Has(pContextImpl->m_hContext, hName)))
+                    {
+                        CALLBACK_RETURN(v8::None);
+                    }
+
+                    return;
+                }
+
                 std::vector<StdString> names;
                 HostObjectUtil::GetPropertyNames(pvObject, names);
 
-                auto name = pContextImpl->CreateStdString(hName);
+                auto spName = pContextImpl->GetHostPropertyName(hName);
+                const auto& name = *spName;
                 for (auto it = names.begin(); it != names.end(); it++)
                 {
                     if (it->Compare(name) == 0)
@@ -3234,22 +4975,13 @@ void V8ContextImpl::GetHostObjectPropertyNames(const v8::PropertyCallbackInfo<v8
         auto pContextImpl = ::GetContextImplFromData(info);
         if (CheckContextImplForHostObjectCallback(pContextImpl))
         {
-            auto pvObject = pContextImpl->GetHostObject(info.HolderV2());
+            auto hHolder = info.HolderV2();
+            auto pvObject = pContextImpl->GetHostObject(hHolder);
             if (pvObject != nullptr)
             {
                 try
                 {
-                    std::vector<StdString> names;
-                    HostObjectUtil::GetPropertyNames(pvObject, names);
-                    auto nameCount = static_cast<int>(names.size());
-
-                    auto hImportedNames = pContextImpl->CreateArray(nameCount);
-                    for (auto index = 0; index < nameCount; index++)
-                    {
-                        ASSERT_EVAL(FROM_MAYBE(hImportedNames->Set(pContextImpl->m_hContext, index, FROM_MAYBE(pContextImpl->CreateString(names[index])))));
-                    }
-
-                    CALLBACK_RETURN(hImportedNames);
+                    CALLBACK_RETURN(pContextImpl->GetHostObjectPropertyNameArray(hHolder, pvObject));
                 }
                 catch (const HostException& exception)
                 {
@@ -3413,6 +5145,105 @@ void V8ContextImpl::GetHostObjectPropertyIndices(const v8::PropertyCallbackInfo<
 
 //-----------------------------------------------------------------------------
 
+void V8ContextImpl::GetHostObjectMember(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    auto hName = ::ValueAsString(hKey);
+    if (hName.IsEmpty())
+    {
+        return;
+    }
+
+    auto pContextImpl = ::GetContextImplFromData(info);
+    if (CheckContextImplForHostObjectCallback(pContextImpl))
+    {
+        auto hHolder = info.HolderV2();
+        auto pvObject = pContextImpl->GetHostObject(hHolder);
+        if (pvObject != nullptr)
+        {
+            try
+            {
+                auto hResult = pContextImpl->GetHostObjectPropertyValue(hHolder, pvObject, hName);
+                CALLBACK_RETURN(!hResult.IsEmpty() ? hResult : pContextImpl->GetUndefined());
+            }
+            catch (const HostException& exception)
+            {
+                pContextImpl->ThrowScriptException(exception);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::GetHostObjectPrototypeMember(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    auto hName = ::ValueAsString(hKey);
+    if (hName.IsEmpty())
+    {
+        return;
+    }
+
+    auto pContextImpl = ::GetContextImplFromData(info);
+    if (CheckContextImplForHostObjectCallback(pContextImpl))
+    {
+        auto hHolder = info.HolderV2();
+        auto pvObject = pContextImpl->GetHostObject(hHolder);
+        if (pvObject != nullptr)
+        {
+            try
+            {
+                auto hResult = pContextImpl->GetHostObjectPropertyValue(hHolder, pvObject, hName);
+                if (hResult.IsEmpty())
+                {
+                    // the host object has no such member; resolve the name as if this accessor weren't here
+
+                    auto hPrototype = hHolder->GetPrototypeV2();
+                    if (hPrototype->IsObject())
+                    {
+                        hResult = FROM_MAYBE_DEFAULT(hPrototype.As<v8::Object>()->Get(pContextImpl->m_hContext, hName));
+                    }
+                }
+
+                CALLBACK_RETURN(!hResult.IsEmpty() ? hResult : pContextImpl->GetUndefined());
+            }
+            catch (const HostException& exception)
+            {
+                pContextImpl->ThrowScriptException(exception);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::SetHostObjectMember(v8::Local<v8::Name> hKey, v8::Local<v8::Value> hValue, const v8::PropertyCallbackInfo<void>& info)
+{
+    auto hName = ::ValueAsString(hKey);
+    if (hName.IsEmpty())
+    {
+        return;
+    }
+
+    auto pContextImpl = ::GetContextImplFromData(info);
+    if (CheckContextImplForHostObjectCallback(pContextImpl))
+    {
+        auto pvObject = pContextImpl->GetHostObject(info.HolderV2());
+        if (pvObject != nullptr)
+        {
+            try
+            {
+                HostObjectUtil::SetProperty(pvObject, *pContextImpl->GetHostPropertyName(hName), pContextImpl->ExportValue(hValue));
+            }
+            catch (const HostException& exception)
+            {
+                pContextImpl->ThrowScriptException(exception);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 v8::Intercepted V8ContextImpl::GetFastHostObjectProperty(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Value>& info)
 {
     CALLBACK_ENTER
@@ -3437,25 +5268,17 @@ v8::Intercepted V8ContextImpl::GetFastHostObjectProperty(v8::Local<v8::Name> hKe
             {
                 try
                 {
-                    auto hCache = ::ValueAsObject(FROM_MAYBE(hHolder->GetPrivate(pContextImpl->m_hContext, pContextImpl->m_hCacheKey)));
-                    if (!hCache.IsEmpty() && FROM_MAYBE(hCache->HasOwnProperty(pContextImpl->m_hContext, hName)))
+                    v8::Local<v8::Value> hValue;
+                    if (pContextImpl->TryGetCachedHostObjectProperty(hHolder, hName, hValue))
                     {
-                        auto hValue = FROM_MAYBE(hCache->Get(pContextImpl->m_hContext, hName));
-                        CALLBACK_RETURN(!hValue->StrictEquals(pContextImpl->m_hMissingPropertyValue) ? hValue : v8::Local<v8::Value>());
+                        CALLBACK_RETURN(hValue);
                     }
 
                     bool isCacheable;
-                    auto hResult = pContextImpl->ImportValue(FastHostObjectUtil::GetProperty(pvObject, pContextImpl->CreateStdString(hName), isCacheable));
+                    auto hResult = pContextImpl->ImportValue(FastHostObjectUtil::GetProperty(pvObject, *pContextImpl->GetHostPropertyName(hName), isCacheable));
                     if (isCacheable)
                     {
-                        auto hCache = ::ValueAsObject(FROM_MAYBE(hHolder->GetPrivate(pContextImpl->m_hContext, pContextImpl->m_hCacheKey)));
-                        if (hCache.IsEmpty())
-                        {
-                            hCache = pContextImpl->CreateObject();
-                            ASSERT_EVAL(FROM_MAYBE(hHolder->SetPrivate(pContextImpl->m_hContext, pContextImpl->m_hCacheKey, hCache)));
-                        }
-
-                        ASSERT_EVAL(FROM_MAYBE(hCache->Set(pContextImpl->m_hContext, hName, !hResult.IsEmpty() ? hResult : pContextImpl->m_hMissingPropertyValue)));
+                        pContextImpl->CacheHostObjectProperty(hHolder, hName, hResult);
                     }
 
                     CALLBACK_RETURN(hResult);
@@ -3492,7 +5315,8 @@ v8::Intercepted V8ContextImpl::SetFastHostObjectProperty(v8::Local<v8::Name> hKe
         {
             try
             {
-                FastHostObjectUtil::SetProperty(pvObject, pContextImpl->CreateStdString(hName), pContextImpl->ExportValue(hValue));
+                auto spName = pContextImpl->GetHostPropertyName(hName);
+                FastHostObjectUtil::SetProperty(pvObject, *spName, pContextImpl->ExportValue(hValue));
                 CALLBACK_RETURN_VOID();
             }
             catch (const HostException& exception)
@@ -3525,7 +5349,7 @@ v8::Intercepted V8ContextImpl::QueryFastHostObjectProperty(v8::Local<v8::Name> h
         {
             try
             {
-                auto flags = FastHostObjectUtil::QueryProperty(pvObject, pContextImpl->CreateStdString(hName));
+                auto flags = FastHostObjectUtil::QueryProperty(pvObject, *pContextImpl->GetHostPropertyName(hName));
                 if (::HasFlag(flags, FastHostObjectUtil::PropertyFlags::Available))
                 {
                     auto attrs = v8::None;
@@ -3798,42 +5622,49 @@ void V8ContextImpl::InvokeHostObject(const v8::FunctionCallbackInfo<v8::Value>&
         auto pvObject = pContextImpl->GetHostObject(info.This());
         if (pvObject != nullptr)
         {
-            try
-            {
-                auto argCount = static_cast<size_t>(info.Length());
-
-                if (argCount < 1)
-                {
-                    CALLBACK_RETURN(pContextImpl->ImportValue(HostObjectUtil::Invoke(pvObject, info.IsConstructCall(), 0, nullptr)));
-                }
-
-                if (argCount <= Constants::MaxInlineArgCount)
-                {
-                    NonexistentV8Value exportedArgs[argCount];
+            pContextImpl->InvokeHostObject(pvObject, info);
+        }
+    }
+}
 
-                    for (size_t index = 0; index < argCount; index++)
-                    {
-                        exportedArgs[index] = pContextImpl->ExportValue(info[index]);
-                    }
+//-----------------------------------------------------------------------------
 
-                    CALLBACK_RETURN(pContextImpl->ImportValue(HostObjectUtil::Invoke(pvObject, info.IsConstructCall(), argCount, exportedArgs)));
-                }
+void V8ContextImpl::InvokeHostObject(void* pvObject, const v8::FunctionCallbackInfo<v8::Value>& info)
+{
+    try
+    {
+        auto argCount = static_cast<size_t>(info.Length());
 
-                std::vector<V8Value> exportedArgs;
-                exportedArgs.reserve(argCount);
+        if (argCount < 1)
+        {
+            CALLBACK_RETURN(ImportValue(HostObjectUtil::Invoke(pvObject, info.IsConstructCall(), 0, nullptr)));
+        }
 
-                for (size_t index = 0; index < argCount; index++)
-                {
-                    exportedArgs.push_back(pContextImpl->ExportValue(info[index]));
-                }
+        if (argCount <= Constants::MaxInlineArgCount)
+        {
+            NonexistentV8Value exportedArgs[argCount];
 
-                CALLBACK_RETURN(pContextImpl->ImportValue(HostObjectUtil::Invoke(pvObject, info.IsConstructCall(), argCount, exportedArgs.data())));
-            }
-            catch (const HostException& exception)
+            for (size_t index = 0; index < argCount; index++)
             {
-                pContextImpl->ThrowScriptException(exception);
+                exportedArgs[index] = ExportValue(info[index]);
             }
+
+            CALLBACK_RETURN(ImportValue(HostObjectUtil::Invoke(pvObject, info.IsConstructCall(), argCount, exportedArgs)));
+        }
+
+        std::vector<V8Value> exportedArgs;
+        exportedArgs.reserve(argCount);
+
+        for (size_t index = 0; index < argCount; index++)
+        {
+            exportedArgs.push_back(ExportValue(info[index]));
         }
+
+        CALLBACK_RETURN(ImportValue(HostObjectUtil::Invoke(pvObject, info.IsConstructCall(), argCount, exportedArgs.data())));
+    }
+    catch (const HostException& exception)
+    {
+        ThrowScriptException(exception);
     }
 }
 
@@ -4011,11 +5842,17 @@ void V8ContextImpl::GetPromiseResultCallback(const v8::FunctionCallbackInfo<v8::
 
 //-----------------------------------------------------------------------------
 
-void V8ContextImpl::DisposeWeakHandle(v8::Isolate* pIsolate, Persistent<v8::Object>* phObject, HostObjectHolder* pHolder, void* pvV8ObjectCache)
+void V8ContextImpl::DisposeWeakHandle(v8::Isolate* pIsolate, Persistent<v8::Object>* phObject, HostObjectHolder* pHolder, V8ContextImpl* pContextImpl)
 {
     IGNORE_UNUSED(pIsolate);
 
-    ASSERT_EVAL(HostObjectUtil::RemoveV8ObjectCacheEntry(pvV8ObjectCache, pHolder->GetObject()));
+    auto it = pContextImpl->m_HostObjectWrapperCache.find(pHolder->GetIdentity());
+    if ((it != pContextImpl->m_HostObjectWrapperCache.end()) && (it->second.pvV8Object == ::PtrFromHandle(*phObject)))
+    {
+        pContextImpl->m_HostObjectWrapperCache.erase(it);
+    }
+
+    pContextImpl->m_spIsolateImpl->QueueHostObjectRelease(pHolder->DetachObject());
     delete pHolder;
 
     phObject->Dispose();
@@ -4282,7 +6119,15 @@ v8::Local<v8::Value> V8ContextImpl::ImportValue(const V8Value& value)
             const StdString* pString;
             if (value.AsString(pString))
             {
-                return FROM_MAYBE(CreateString(*pString));
+                return FROM_MAYBE(GetCachedString(*pString));
+            }
+        }
+
+        {
+            V8StringBuffer* pBuffer;
+            if (value.AsStringBuffer(pBuffer))
+            {
+                return FROM_MAYBE(CreateString(*pBuffer));
             }
         }
 
@@ -4292,13 +6137,15 @@ v8::Local<v8::Value> V8ContextImpl::ImportValue(const V8Value& value)
             V8Value::Flags flags;
             if (value.AsHostObject(pHolder, subtype, flags))
             {
-                auto pvV8Object = HostObjectUtil::GetCachedV8Object(m_pvV8ObjectCache, pHolder->GetObject());
-                if (pvV8Object != nullptr)
+                auto identity = pHolder->GetIdentity();
+                auto it = m_HostObjectWrapperCache.find(identity);
+                if (it != m_HostObjectWrapperCache.end())
                 {
-                    return CreateLocal(::HandleFromPtr<v8::Object>(pvV8Object));
+                    return CreateLocal(::HandleFromPtr<v8::Object>(it->second.pvV8Object));
                 }
 
                 v8::Local<v8::Object> hObject;
+                v8::Local<v8::FunctionTemplate> hTypeTemplate;
 
                 if (::HasFlag(flags, V8Value::Flags::Fast))
                 {
@@ -4315,6 +6162,12 @@ v8::Local<v8::Value> V8ContextImpl::ImportValue(const V8Value& value)
                         END_PULSE_VALUE_SCOPE
                     }
                 }
+                else if (m_HostObjectTypeTemplatesEnabled && TryGetHostObjectTypeTemplate(*pHolder, hTypeTemplate))
+                {
+                    BEGIN_PULSE_VALUE_SCOPE(&m_AllowHostObjectConstructorCall, true)
+                        hObject = FROM_MAYBE(hTypeTemplate->InstanceTemplate()->NewInstance(m_hContext));
+                    END_PULSE_VALUE_SCOPE
+                }
                 else
                 {
                     auto invocability = HostObjectUtil::GetInvocability(pHolder->GetObject());
@@ -4338,10 +6191,17 @@ v8::Local<v8::Value> V8ContextImpl::ImportValue(const V8Value& value)
                     }
                 }
 
+                // the template lookups above can call into the host; use the existing wrapper if one was created reentrantly
+
+                it = m_HostObjectWrapperCache.find(identity);
+                if (it != m_HostObjectWrapperCache.end())
+                {
+                    return CreateLocal(::HandleFromPtr<v8::Object>(it->second.pvV8Object));
+                }
+
                 ASSERT_EVAL(SetHostObjectHolder(hObject, pHolder = pHolder->Clone()));
-                ASSERT_EVAL(FROM_MAYBE(hObject->SetPrivate(m_hContext, m_hAccessTokenKey, m_hAccessToken)));
-                pvV8Object = ::PtrFromHandle(MakeWeak(CreatePersistent(hObject), pHolder, m_pvV8ObjectCache, DisposeWeakHandle));
-                HostObjectUtil::CacheV8Object(m_pvV8ObjectCache, pHolder->GetObject(), pvV8Object);
+                auto pvV8Object = ::PtrFromHandle(MakeWeak(CreatePersistent(hObject), pHolder, this, DisposeWeakHandle));
+                m_HostObjectWrapperCache.emplace(identity, HostObjectWrapperEntry { pvV8Object });
 
                 return hObject;
             }
@@ -4477,7 +6337,7 @@ V8Value V8ContextImpl::ExportValue(v8::Local<v8::Value> hValue)
         auto hString = ::ValueAsString(hValue);
         if (!hString.IsEmpty())
         {
-            return V8Value(new StdString(CreateStdString(hString)));
+            return CreateStringValue(hString);
         }
 
         if (m_DateTimeConversionEnabled && hValue->IsDate())
@@ -4658,7 +6518,8 @@ V8Value V8ContextImpl::ExportValue(v8::Local<v8::Value> hValue)
                 }
             }
 
-            return V8Value(new V8ObjectHolderImpl(GetWeakBinding(), ::PtrFromHandle(CreatePersistent(hObject)), hObject->GetIdentityHash(), spSharedObjectInfo), subtype, flags);
+            auto identityHash = hObject->GetIdentityHash();
+            return V8Value(new V8ObjectHolderImpl(GetObjectRef(hObject, identityHash), identityHash, spSharedObjectInfo), subtype, flags);
         }
 
     FROM_MAYBE_CATCH_CONSUME
@@ -8,6 +8,7 @@
 //-----------------------------------------------------------------------------
 
 class V8WeakContextBinding;
+class V8ObjectRef;
 
 //-----------------------------------------------------------------------------
 // V8ContextImpl
@@ -34,11 +35,20 @@ public:
     virtual size_t GetMaxIsolateStackUsage() override;
     virtual void SetMaxIsolateStackUsage(size_t value) override;
 
+    virtual size_t GetMaxIsolateStringCacheSize() override;
+    virtual void SetMaxIsolateStringCacheSize(size_t value) override;
+
     virtual void CallWithLock(CallWithLockCallback* pCallback, void* pvAction) override;
     virtual void CallWithLockWithArg(CallWithLockWithArgCallback* pCallback, void* pvAction, void* pvArg) override;
 
     virtual V8Value GetRootObject() override;
     virtual void SetGlobalProperty(const StdString& name, const V8Value& value, bool globalMembers) override;
+    virtual V8Value CreateV8Array(const std::vector<V8Value>& values) override;
+    virtual V8Value CreateV8Object(const std::vector<StdString>& names, const std::vector<V8Value>& values) override;
+    virtual V8Value DeserializeValue(const std::vector<uint8_t>& data, const std::vector<V8Value>& sharedObjects) override;
+    virtual V8Value ParseJson(const StdString& json) override;
+    virtual V8Value ParseJson(const char* pJson, int32_t length) override;
+    virtual V8Value CreateFastFunction(void* pvFunction, FastHostObjectUtil::CallType returnType, const std::vector<int32_t>& argTypes) override;
 
     virtual void AwaitDebuggerAndPause() override;
     virtual void CancelAwaitDebugger() override;
@@ -52,6 +62,7 @@ public:
 
     virtual bool CanExecute(const SharedPtr<V8ScriptHolder>& spHolder) override;
     virtual V8Value Execute(const SharedPtr<V8ScriptHolder>& spHolder, bool evaluate) override;
+    virtual void ExecuteBatch(const std::vector<int32_t>& commands, const std::vector<StdString>& names, const std::vector<V8Value>& values, std::vector<V8Value>& results, std::vector<StdString>& errors) override;
 
     virtual void Interrupt() override;
     virtual void CancelInterrupt() override;
@@ -65,6 +76,8 @@ public:
     virtual Statistics GetStatistics() override;
     virtual void CollectGarbage(bool exhaustive) override;
     virtual void OnAccessSettingsChanged() override;
+    virtual void OnEnumerationSettingsChanged() override;
+    virtual void InvalidateHostMemberCache(const std::vector<StdString>& names) override;
 
     virtual bool BeginCpuProfile(const StdString& name, v8::CpuProfilingMode mode, bool recordSamples) override;
     virtual bool EndCpuProfile(const StdString& name, V8Isolate::CpuProfileCallback* pCallback, void* pvArg) override;
@@ -82,11 +95,16 @@ public:
     void SetV8ObjectProperty(void* pvObject, const StdString& name, const V8Value& value);
     bool DeleteV8ObjectProperty(void* pvObject, const StdString& name);
     void GetV8ObjectPropertyNames(void* pvObject, bool includeIndices, std::vector<StdString>& names);
+    void GetV8ObjectProperties(void* pvObject, const std::vector<StdString>& names, std::vector<V8Value>& values);
+    void SetV8ObjectProperties(void* pvObject, const std::vector<StdString>& names, const std::vector<V8Value>& values);
 
     V8Value GetV8ObjectProperty(void* pvObject, int index);
     void SetV8ObjectProperty(void* pvObject, int index, const V8Value& value);
     bool DeleteV8ObjectProperty(void* pvObject, int index);
     void GetV8ObjectPropertyIndices(void* pvObject, std::vector<int>& indices);
+    V8ObjectHelpers::ArrayExportKind ExportV8Array(void* pvObject, std::vector<V8Value>& values, std::vector<uint8_t>& packedValues);
+    void SerializeV8Object(void* pvObject, std::vector<uint8_t>& data, std::vector<V8Value>& sharedObjects);
+    StdString StringifyV8Object(void* pvObject);
 
     V8Value InvokeV8Object(void* pvObject, bool asConstructor, const std::vector<V8Value>& args);
     V8Value InvokeV8ObjectMethod(void* pvObject, const StdString& name, const std::vector<V8Value>& args);
@@ -132,6 +150,55 @@ private:
         Persistent<v8::Value> hValue;
     };
 
+    struct PropertyNameCacheEntry final
+    {
+        Persistent<v8::String> hName;
+        std::shared_ptr<const StdString> spName;
+    };
+
+    struct ObjectShapeCacheEntry final
+    {
+        std::vector<StdString> Names;
+        Persistent<v8::DictionaryTemplate> hTemplate;
+    };
+
+    struct HostObjectPropertyNamesEntry final
+    {
+        uint32_t Stamp;
+        uint32_t EnumerationStamp;
+        Persistent<v8::Array> hNames;
+        Persistent<v8::Set> hNameSet;
+    };
+
+    struct GlobalMemberIndexEntry final
+    {
+        Persistent<v8::String> hName;
+        int32_t OwnerIndex;
+    };
+
+    struct HostObjectWrapperEntry final
+    {
+        void* pvV8Object;
+    };
+
+    struct HostMemberInvalidation final
+    {
+        uint32_t Stamp;
+        Persistent<v8::String> hName;
+    };
+
+    struct FastFunctionEntry final
+    {
+        V8ContextImpl* pContextImpl;
+        void* pvFunction;
+        FastHostObjectUtil::CallType ReturnType;
+        std::vector<FastHostObjectUtil::CallType> ArgTypes;
+        std::vector<v8::CTypeInfo> ArgInfo;
+        std::unique_ptr<v8::CFunctionInfo> upFunctionInfo;
+        v8::CFunction Function;
+        Persistent<v8::Function> hFunction;
+    };
+
     struct SyntheticModuleEntry final
     {
         Persistent<v8::Module> hModule;
@@ -224,11 +291,26 @@ private:
         return m_spIsolateImpl->CreateString(value, type);
     }
 
+    v8::MaybeLocal<v8::String> GetCachedString(const StdString& value)
+    {
+        return m_spIsolateImpl->GetCachedString(value);
+    }
+
     virtual StdString CreateStdString(v8::Local<v8::Value> hValue) override
     {
         return m_spIsolateImpl->CreateStdString(hValue);
     }
 
+    V8Value CreateStringValue(v8::Local<v8::String> hString)
+    {
+        return m_spIsolateImpl->CreateStringValue(hString);
+    }
+
+    v8::MaybeLocal<v8::String> CreateString(V8StringBuffer& buffer)
+    {
+        return m_spIsolateImpl->CreateString(buffer);
+    }
+
     v8::Local<v8::Symbol> CreateSymbol(v8::Local<v8::String> hName = v8::Local<v8::String>())
     {
         return m_spIsolateImpl->CreateSymbol(hName);
@@ -244,6 +326,11 @@ private:
         return m_spIsolateImpl->CreateArray(length);
     }
 
+    v8::Local<v8::Array> CreateArray(v8::Local<v8::Value>* pElements, size_t length)
+    {
+        return m_spIsolateImpl->CreateArray(pElements, length);
+    }
+
     v8::Local<v8::PrimitiveArray> CreatePrimitiveArray(int length)
     {
         return m_spIsolateImpl->CreatePrimitiveArray(length);
@@ -269,11 +356,21 @@ private:
         return m_spIsolateImpl->CreateObjectTemplate();
     }
 
+    v8::Local<v8::DictionaryTemplate> CreateDictionaryTemplate(const std::vector<std::string_view>& names)
+    {
+        return m_spIsolateImpl->CreateDictionaryTemplate(names);
+    }
+
     v8::Local<v8::FunctionTemplate> CreateFunctionTemplate(v8::FunctionCallback callback = 0, v8::Local<v8::Value> data = v8::Local<v8::Value>(), v8::Local<v8::Signature> signature = v8::Local<v8::Signature>(), int length = 0)
     {
         return m_spIsolateImpl->CreateFunctionTemplate(callback, data, signature, length);
     }
 
+    v8::Local<v8::FunctionTemplate> CreateFunctionTemplate(v8::FunctionCallback callback, v8::Local<v8::Value> data, int length, const v8::CFunction* pCFunction)
+    {
+        return m_spIsolateImpl->CreateFunctionTemplate(callback, data, length, pCFunction);
+    }
+
     v8::Local<v8::SharedArrayBuffer> CreateSharedArrayBuffer(const std::shared_ptr<v8::BackingStore>& spBackingStore)
     {
         return m_spIsolateImpl->CreateSharedArrayBuffer(spBackingStore);
@@ -420,6 +517,24 @@ private:
     HostObjectHolder* GetHostObjectHolder(v8::Local<v8::Object> hObject);
     bool SetHostObjectHolder(v8::Local<v8::Object> hObject, HostObjectHolder* pHolder);
     void* GetHostObject(v8::Local<v8::Object> hObject);
+    std::shared_ptr<const StdString> GetHostPropertyName(v8::Local<v8::String> hName);
+    void ClearPropertyNameCache();
+    bool TryGetObjectShape(const std::vector<StdString>& names, size_t count, v8::Local<v8::DictionaryTemplate>& hTemplate);
+    SharedPtr<V8ObjectRef> GetObjectRef(v8::Local<v8::Object> hObject, int32_t identityHash);
+    bool TryGetHostObjectTypeTemplate(const HostObjectHolder& holder, v8::Local<v8::FunctionTemplate>& hTemplate);
+    v8::Local<v8::Value> GetHostObjectPropertyValue(v8::Local<v8::Object> hHolder, void* pvObject, v8::Local<v8::String> hName);
+    v8::Local<v8::Object> GetHostObjectCache(v8::Local<v8::Object> hHolder, bool create);
+    bool TryGetCachedHostObjectProperty(v8::Local<v8::Object> hHolder, v8::Local<v8::String> hName, v8::Local<v8::Value>& hValue);
+    void CacheHostObjectProperty(v8::Local<v8::Object> hHolder, v8::Local<v8::String> hName, v8::Local<v8::Value> hValue);
+    void ClearHostMemberInvalidations();
+    int32_t GetHostObjectTypeId(v8::Local<v8::Object> hHolder, void* pvObject);
+    bool TryGetCachedHostObjectPropertyNames(v8::Local<v8::Object> hHolder, void* pvObject, int32_t& typeId, v8::Local<v8::Array>& hNames, v8::Local<v8::Set>& hNameSet);
+    v8::Local<v8::Array> GetHostObjectPropertyNameArray(v8::Local<v8::Object> hHolder, void* pvObject);
+
+    void InvalidateGlobalMemberIndex();
+    void UpdateGlobalMemberIndex();
+    int32_t GetIndexedGlobalMemberOwner(v8::Local<v8::String> hName);
+    bool TryGetGlobalMemberOwner(v8::Local<v8::String> hName, v8::Local<v8::Object>& hOwner);
 
     static bool CheckContextImplForGlobalObjectCallback(V8ContextImpl* pContextImpl);
     static bool CheckContextImplForHostObjectCallback(V8ContextImpl* pContextImpl);
@@ -444,9 +559,21 @@ private:
     static void GetHostObjectAsyncIterator(const v8::FunctionCallbackInfo<v8::Value>& info);
     static void GetFastHostObjectIterator(const v8::FunctionCallbackInfo<v8::Value>& info);
     static void GetFastHostObjectAsyncIterator(const v8::FunctionCallbackInfo<v8::Value>& info);
+    static void GetHostEnumeratorChunk(const v8::FunctionCallbackInfo<v8::Value>& info);
+    static void FetchHostAsyncEnumeratorChunk(const v8::FunctionCallbackInfo<v8::Value>& info);
+    static bool TryGetEnumeratorChunkArgs(V8ContextImpl* pContextImpl, const v8::FunctionCallbackInfo<v8::Value>& info, void*& pvEnumerator, size_t& maxCount);
     static void GetHostObjectJson(const v8::FunctionCallbackInfo<v8::Value>& info);
     static void CreateFunctionForHostDelegate(const v8::FunctionCallbackInfo<v8::Value>& info);
     static void InvokeHostDelegate(const v8::FunctionCallbackInfo<v8::Value>& info);
+    static void InvokeHostDelegateDirect(const v8::FunctionCallbackInfo<v8::Value>& info);
+    static void InvokeFastFunction(const v8::FunctionCallbackInfo<v8::Value>& info);
+    static void DisposeFastFunction(v8::Isolate* pIsolate, Persistent<v8::Function>* phFunction, FastFunctionEntry* pEntry, V8ContextImpl* pContextImpl);
+
+    template <typename TResult, typename... TArgs>
+    static TResult CallFastFunction(v8::Local<v8::Value> hReceiver, TArgs... args, v8::FastApiCallbackOptions& options);
+
+    template <typename TResult, typename... TArgs>
+    static const void* GetFastFunctionAddress(const FastHostObjectUtil::CallType* pArgTypes, size_t argCount);
 
     static v8::Intercepted GetHostObjectProperty(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Value>& info);
     static v8::Intercepted SetHostObjectProperty(v8::Local<v8::Name> hKey, v8::Local<v8::Value> hValue, const v8::PropertyCallbackInfo<void>& info);
@@ -460,6 +587,10 @@ private:
     static v8::Intercepted DeleteHostObjectProperty(uint32_t index, const v8::PropertyCallbackInfo<v8::Boolean>& info);
     static void GetHostObjectPropertyIndices(const v8::PropertyCallbackInfo<v8::Array>& info);
 
+    static void GetHostObjectMember(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Value>& info);
+    static void GetHostObjectPrototypeMember(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Value>& info);
+    static void SetHostObjectMember(v8::Local<v8::Name> hKey, v8::Local<v8::Value> hValue, const v8::PropertyCallbackInfo<void>& info);
+
     static v8::Intercepted GetFastHostObjectProperty(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Value>& info);
     static v8::Intercepted SetFastHostObjectProperty(v8::Local<v8::Name> hKey, v8::Local<v8::Value> hValue, const v8::PropertyCallbackInfo<void>& info);
     static v8::Intercepted QueryFastHostObjectProperty(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Integer>& info);
@@ -473,6 +604,7 @@ private:
     static void GetFastHostObjectPropertyIndices(const v8::PropertyCallbackInfo<v8::Array>& info);
 
     static void InvokeHostObject(const v8::FunctionCallbackInfo<v8::Value>& info);
+    void InvokeHostObject(void* pvObject, const v8::FunctionCallbackInfo<v8::Value>& info);
     static void InvokeFastHostObject(const v8::FunctionCallbackInfo<v8::Value>& info);
 
     static void FlushCallback(const v8::FunctionCallbackInfo<v8::Value>& info);
@@ -488,7 +620,7 @@ private:
     static v8::MaybeLocal<v8::Value> PopulateSyntheticModule(v8::Local<v8::Context> hContext, v8::Local<v8::Module> hModule);
     v8::MaybeLocal<v8::Value> PopulateSyntheticModule(v8::Local<v8::Module> hModule);
 
-    static void DisposeWeakHandle(v8::Isolate* pIsolate, Persistent<v8::Object>* phObject, HostObjectHolder* pHolder, void* pvV8ObjectCache);
+    static void DisposeWeakHandle(v8::Isolate* pIsolate, Persistent<v8::Object>* phObject, HostObjectHolder* pHolder, V8ContextImpl* pContextImpl);
 
     bool TryGetCachedModuleInfo(uint64_t uniqueId, V8DocumentInfo& documentInfo);
     bool TryGetCachedModuleInfo(v8::Local<v8::Module> hModule, V8DocumentInfo& documentInfo);
@@ -521,13 +653,14 @@ private:
     SharedPtr<V8IsolateImpl> m_spIsolateImpl;
     Persistent<v8::Context> m_hContext;
     std::vector<std::pair<StdString, Persistent<v8::Object>>> m_GlobalMembersStack;
+    std::vector<bool> m_GlobalMemberIndexability;
+    std::unordered_multimap<int, GlobalMemberIndexEntry> m_GlobalMemberIndex;
     Persistent<v8::Symbol> m_hIsHostObjectKey;
     Persistent<v8::Symbol> m_hModuleResultKey;
     Persistent<v8::Symbol> m_hMissingPropertyValue;
     Persistent<v8::String> m_hHostExceptionKey;
     Persistent<v8::Private> m_hCacheKey;
-    Persistent<v8::Private> m_hAccessTokenKey;
-    Persistent<v8::Object> m_hAccessToken;
+    Persistent<v8::Private> m_hHostDelegateFunctionKey;
     Persistent<v8::String> m_hInternalUseOnly;
     Persistent<v8::String> m_hStackKey;
     Persistent<v8::String> m_hObjectNotInvocable;
@@ -541,6 +674,7 @@ private:
     Persistent<v8::FunctionTemplate> m_hHostDelegateTemplate;
     Persistent<v8::FunctionTemplate> m_hFastHostObjectTemplate;
     Persistent<v8::FunctionTemplate> m_hFastHostFunctionTemplate;
+    Persistent<v8::ObjectTemplate> m_hHostObjectCacheTemplate;
     Persistent<v8::Function> m_hToIteratorFunction;
     Persistent<v8::Function> m_hToAsyncIteratorFunction;
     Persistent<v8::Function> m_hToJsonFunction;
@@ -551,12 +685,28 @@ private:
     SharedPtr<V8WeakContextBinding> m_spWeakBinding;
     std::list<ModuleCacheEntry> m_ModuleCache;
     std::list<SyntheticModuleEntry> m_SyntheticModuleData;
+    std::list<FastFunctionEntry> m_FastFunctions;
+    std::list<HostMemberInvalidation> m_HostMemberInvalidations;
+    std::unordered_multimap<int, PropertyNameCacheEntry> m_PropertyNameCache;
+    std::unordered_multimap<size_t, ObjectShapeCacheEntry> m_ObjectShapeCache;
+    std::unordered_multimap<int32_t, WeakRef<V8ObjectRef>> m_ObjectIdentityCache;
+    std::unordered_map<int32_t, Persistent<v8::FunctionTemplate>> m_HostObjectTypeTemplateCache;
+    std::unordered_map<int32_t, HostObjectPropertyNamesEntry> m_HostObjectPropertyNamesCache;
+    std::unordered_map<int32_t, HostObjectWrapperEntry> m_HostObjectWrapperCache;
     Statistics m_Statistics;
     bool m_DateTimeConversionEnabled;
     bool m_HideHostExceptions;
+    bool m_ObjectIdentityCacheEnabled;
+    size_t m_ObjectIdentityCacheSweepSize;
+    size_t m_ObjectIdentityCacheMissCount;
+    bool m_HostObjectTypeTemplatesEnabled;
+    uint32_t m_HostMemberCacheStamp;
+    uint32_t m_HostMemberCacheBaseStamp;
+    uint32_t m_HostObjectPropertyNamesStamp;
+    uint32_t m_GlobalMemberIndexStamp;
+    bool m_GlobalMemberIndexValid;
     bool m_AllowHostObjectConstructorCall;
     bool m_ChangedTimerResolution;
-    void* m_pvV8ObjectCache;
     double m_RelativeTimeOrigin;
 };
 
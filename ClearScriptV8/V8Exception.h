@@ -39,6 +39,21 @@ public:
     {
     }
 
+    Type GetType() const
+    {
+        return m_Type;
+    }
+
+    const StdString& GetMessage() const
+    {
+        return m_Message;
+    }
+
+    const V8Value& GetScriptException() const
+    {
+        return m_ScriptException;
+    }
+
     void ScheduleScriptEngineException() const noexcept;
 
 private:
@@ -0,0 +1,10 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+
+//-----------------------------------------------------------------------------
+// V8Instrumentation implementation
+//-----------------------------------------------------------------------------
+
+std::atomic<uint32_t> V8Instrumentation::ms_Flags { 0 };
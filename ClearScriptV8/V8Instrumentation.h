@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8Instrumentation
+//-----------------------------------------------------------------------------
+
+// Crossing statistics and trace recording share a single flag word, so an uninstrumented crossing
+// pays one relaxed load regardless of how many instruments it passes through.
+
+class V8Instrumentation final: StaticBase
+{
+public:
+
+    enum class Flags: uint32_t
+    {
+        None = 0,
+        Statistics = 0x00000001,
+        Trace = 0x00000002
+    };
+
+    static Flags GetFlags() noexcept
+    {
+        return static_cast<Flags>(ms_Flags.load(std::memory_order_relaxed));
+    }
+
+    static void SetEnabled(Flags flags, bool enabled) noexcept
+    {
+        if (enabled)
+        {
+            ms_Flags.fetch_or(::ToUnderlyingType(flags), std::memory_order_relaxed);
+        }
+        else
+        {
+            ms_Flags.fetch_and(~::ToUnderlyingType(flags), std::memory_order_relaxed);
+        }
+    }
+
+private:
+
+    static std::atomic<uint32_t> ms_Flags;
+};
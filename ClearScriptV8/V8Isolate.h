@@ -56,6 +56,8 @@ public:
         size_t ScriptCount = 0;
         size_t ScriptCacheSize = 0;
         size_t ModuleCount = 0;
+        size_t StringCacheHitCount = 0;
+        size_t StringCacheMissCount = 0;
         TaskCounts PostedTaskCounts = {};
         TaskCounts InvokedTaskCounts = {};
     };
@@ -71,6 +73,9 @@ public:
     virtual size_t GetMaxStackUsage() = 0;
     virtual void SetMaxStackUsage(size_t value) = 0;
 
+    virtual size_t GetMaxStringCacheSize() = 0;
+    virtual void SetMaxStringCacheSize(size_t value) = 0;
+
     virtual void AwaitDebuggerAndPause() = 0;
     virtual void CancelAwaitDebugger() = 0;
 
@@ -424,6 +424,113 @@ void V8OutputStream::EndOfStream()
 {
 }
 
+//-----------------------------------------------------------------------------
+// V8ExternalStringResourceRegistry
+//-----------------------------------------------------------------------------
+
+class V8ExternalStringResourceRegistry final: StaticBase
+{
+public:
+
+    // Other code (e.g., V8's externalizeString extension) can attach external resources of its
+    // own to strings, so a string's resource is trusted only if it's registered here.
+
+    static void Add(const v8::String::ExternalStringResourceBase* pResource, V8StringBuffer* pBuffer)
+    {
+        auto& state = GetState();
+        BEGIN_MUTEX_SCOPE(state.Mutex)
+            state.Buffers.emplace(pResource, pBuffer);
+        END_MUTEX_SCOPE
+    }
+
+    static V8StringBuffer* TryGetBuffer(const v8::String::ExternalStringResourceBase* pResource)
+    {
+        V8StringBuffer* pBuffer = nullptr;
+
+        auto& state = GetState();
+        BEGIN_MUTEX_SCOPE(state.Mutex)
+            auto it = state.Buffers.find(pResource);
+            if (it != state.Buffers.end())
+            {
+                pBuffer = it->second;
+            }
+        END_MUTEX_SCOPE
+
+        return pBuffer;
+    }
+
+    static void Remove(const v8::String::ExternalStringResourceBase* pResource)
+    {
+        auto& state = GetState();
+        BEGIN_MUTEX_SCOPE(state.Mutex)
+            state.Buffers.erase(pResource);
+        END_MUTEX_SCOPE
+    }
+
+private:
+
+    struct State
+    {
+        std::unordered_map<const v8::String::ExternalStringResourceBase*, V8StringBuffer*> Buffers;
+        SimpleMutex Mutex;
+    };
+
+    static State& GetState()
+    {
+        // Resources can outlive static destruction in isolates that are never torn down.
+
+        static auto pState = new State;
+        return *pState;
+    }
+};
+
+//-----------------------------------------------------------------------------
+// V8ExternalStringResource
+//-----------------------------------------------------------------------------
+
+template <typename TBase, typename TChar>
+class V8ExternalStringResource final: public TBase
+{
+    PROHIBIT_COPY(V8ExternalStringResource)
+
+public:
+
+    explicit V8ExternalStringResource(V8StringBuffer& buffer):
+        m_Buffer(buffer)
+    {
+        m_Buffer.AddRef();
+        V8ExternalStringResourceRegistry::Add(this, &m_Buffer);
+    }
+
+    V8StringBuffer& GetBuffer() const
+    {
+        return m_Buffer;
+    }
+
+    virtual const TChar* data() const override
+    {
+        return static_cast<const TChar*>(m_Buffer.GetData());
+    }
+
+    virtual size_t length() const override
+    {
+        return m_Buffer.GetLength();
+    }
+
+    ~V8ExternalStringResource()
+    {
+        V8ExternalStringResourceRegistry::Remove(this);
+        m_Buffer.Release();
+    }
+
+private:
+
+    V8StringBuffer& m_Buffer;
+};
+
+using V8ExternalOneByteStringResource = V8ExternalStringResource<v8::String::ExternalOneByteStringResource, char>;
+using V8ExternalTwoByteStringResource = V8ExternalStringResource<v8::String::ExternalStringResource, uint16_t>;
+
 //-----------------------------------------------------------------------------
 // V8IsolateImpl implementation
 //-----------------------------------------------------------------------------
@@ -478,6 +585,7 @@ V8IsolateImpl::V8IsolateImpl(const StdString& name, const v8::ResourceConstraint
     m_HeapWatchLevel(0),
     m_HeapExpansionMultiplier(options.HeapExpansionMultiplier),
     m_MaxStackUsage(0),
+    m_MaxStringCacheSize(0),
     m_EnableInterruptPropagation(false),
     m_DisableHeapSizeViolationInterrupt(false),
     m_CpuProfileSampleInterval(1000U),
@@ -485,6 +593,7 @@ V8IsolateImpl::V8IsolateImpl(const StdString& name, const v8::ResourceConstraint
     m_pStackLimit(nullptr),
     m_IsExecutionTerminating(false),
     m_pExecutionScope(nullptr),
+    m_InFastCall(false),
     m_pDocumentInfo(nullptr),
     m_IsOutOfMemory(false),
     m_Released(false)
@@ -508,6 +617,8 @@ V8IsolateImpl::V8IsolateImpl(const StdString& name, const v8::ResourceConstraint
 
         m_upIsolate->AddNearHeapLimitCallback(HeapExpansionCallback, this);
         m_upIsolate->AddBeforeCallEnteredCallback(OnBeforeCallEntered);
+        m_upIsolate->AddGCPrologueCallback(OnGCPrologue, this);
+        m_upIsolate->AddGCEpilogueCallback(OnGCEpilogue, this);
 
         BEGIN_ISOLATE_SCOPE
 
@@ -594,6 +705,35 @@ void V8IsolateImpl::RemoveContext(V8ContextImpl* pContextImpl)
 
 //-----------------------------------------------------------------------------
 
+void V8IsolateImpl::QueueHostObjectRelease(void* pvObject)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    // called from weak handle callbacks during garbage collection; the queue is drained in a
+    // single managed call once the collection is complete
+
+    if (pvObject != nullptr)
+    {
+        m_QueuedHostObjectReleases.push_back(pvObject);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::ReleaseQueuedHostObjects()
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    if (!m_QueuedHostObjectReleases.empty())
+    {
+        std::vector<void*> objectPtrs;
+        std::swap(objectPtrs, m_QueuedHostObjectReleases);
+        HostObjectUtil::Release(objectPtrs);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 V8ContextImpl* V8IsolateImpl::FindContext(v8::Local<v8::Context> hContext)
 {
     _ASSERTE(IsCurrent() && IsLocked());
@@ -714,6 +854,20 @@ void V8IsolateImpl::SetMaxStackUsage(size_t value)
 
 //-----------------------------------------------------------------------------
 
+size_t V8IsolateImpl::GetMaxStringCacheSize()
+{
+    return m_MaxStringCacheSize;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::SetMaxStringCacheSize(size_t value)
+{
+    m_MaxStringCacheSize = value;
+}
+
+//-----------------------------------------------------------------------------
+
 void V8IsolateImpl::AwaitDebuggerAndPause()
 {
     BEGIN_ISOLATE_SCOPE
@@ -868,6 +1022,7 @@ void V8IsolateImpl::CollectGarbage(bool exhaustive)
         if (exhaustive)
         {
             ClearScriptCache();
+            ClearStringCache();
             ClearCachesForTesting();
             RequestGarbageCollectionForTesting(v8::Isolate::kFullGarbageCollection);
         }
@@ -876,6 +1031,8 @@ void V8IsolateImpl::CollectGarbage(bool exhaustive)
             RequestGarbageCollectionForTesting(v8::Isolate::kMinorGarbageCollection);
         }
 
+        ReleaseQueuedHostObjects();
+
     END_ISOLATE_SCOPE
 }
 
@@ -1385,12 +1542,15 @@ void V8IsolateImpl::CallWithLockNoWait(bool allowNesting, CallWithLockCallback&&
             // the callback may release this instance; hold it for destruction outside isolate scope
             SharedPtr<V8IsolateImpl> spThis(this);
 
+            // work that arrives during a fast API call (e.g., entity release) must be queued
+
             MutexLock<RecursiveMutex> lock(m_Mutex, false);
-            if (allowNesting || (m_CallWithLockLevel < 1))
+            if (!m_InFastCall && (allowNesting || (m_CallWithLockLevel < 1)))
             {
                 BEGIN_ISOLATE_NATIVE_SCOPE
                 BEGIN_PULSE_VALUE_SCOPE(&m_CallWithLockLevel, m_CallWithLockLevel + 1)
 
+                    V8_TRACE_SCOPE(CallWithLock, "CallWithLock");
                     callback(this);
                     return;
 
@@ -1598,6 +1758,162 @@ void V8IsolateImpl::ClearScriptCache()
 
 //-----------------------------------------------------------------------------
 
+V8Value V8IsolateImpl::CreateStringValue(v8::Local<v8::String> hString)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    // Strings created from host buffers share them directly; strings created by script code are
+    // never externalized here, as that would mutate V8 heap objects the host doesn't own.
+
+    v8::String::Encoding encoding;
+    auto pResource = hString->GetExternalStringResourceBase(&encoding);
+    if (pResource != nullptr)
+    {
+        auto pSharedBuffer = V8ExternalStringResourceRegistry::TryGetBuffer(pResource);
+        if (pSharedBuffer != nullptr)
+        {
+            return V8Value(V8Value::StringView, pSharedBuffer);
+        }
+    }
+
+    // Short strings are cheaper to copy into a standard string; longer ones are copied once
+    // into a shared buffer that the host can borrow without a further copy.
+
+    if (hString->Length() < Constants::MinSharedStringLength)
+    {
+        return V8Value(new StdString(CreateStdString(hString)));
+    }
+
+    V8StringBuffer* pBuffer;
+
+    {
+        v8::String::ValueView view(m_upIsolate.get(), hString);
+        pBuffer = view.is_one_byte() ? new V8StringBuffer(view.data8(), view.length()) : new V8StringBuffer(view.data16(), view.length());
+    }
+
+    V8Value value(V8Value::StringView, pBuffer);
+    pBuffer->Release();
+    return value;
+}
+
+//-----------------------------------------------------------------------------
+
+v8::MaybeLocal<v8::String> V8IsolateImpl::CreateString(V8StringBuffer& buffer)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    if (buffer.IsOneByte())
+    {
+        return v8::String::NewExternalOneByte(m_upIsolate.get(), new V8ExternalOneByteStringResource(buffer));
+    }
+
+    return v8::String::NewExternalTwoByte(m_upIsolate.get(), new V8ExternalTwoByteStringResource(buffer));
+}
+
+//-----------------------------------------------------------------------------
+
+v8::MaybeLocal<v8::String> V8IsolateImpl::GetCachedString(const StdString& value)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    size_t maxStringCacheSize = m_MaxStringCacheSize;
+    if ((maxStringCacheSize < 1) || (value.GetLength() > Constants::MaxCachedStringLength))
+    {
+        TrimStringCache(maxStringCacheSize);
+        return CreateString(value);
+    }
+
+    auto digest = value.GetDigest();
+
+    auto range = m_StringCacheIndex.equal_range(digest);
+    for (auto it = range.first; it != range.second; it++)
+    {
+        auto itEntry = it->second;
+        if (itEntry->Value == value)
+        {
+            m_StringCache.splice(m_StringCache.begin(), m_StringCache, itEntry);
+            ++m_Statistics.StringCacheHitCount;
+            return static_cast<v8::Local<v8::String>>(itEntry->hString);
+        }
+    }
+
+    ++m_Statistics.StringCacheMissCount;
+
+    v8::Local<v8::String> hString;
+    if (!CreateString(value, v8::NewStringType::kInternalized).ToLocal(&hString))
+    {
+        return v8::MaybeLocal<v8::String>();
+    }
+
+    TrimStringCache(maxStringCacheSize - 1);
+
+    m_StringCache.push_front(StringCacheEntry { value, digest, CreatePersistent(hString) });
+    m_StringCacheIndex.emplace(digest, m_StringCache.begin());
+
+    return hString;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::TrimStringCache(size_t maxSize)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    while (m_StringCache.size() > maxSize)
+    {
+        auto itEntry = std::prev(m_StringCache.end());
+
+        auto range = m_StringCacheIndex.equal_range(itEntry->Digest);
+        for (auto it = range.first; it != range.second; it++)
+        {
+            if (it->second == itEntry)
+            {
+                m_StringCacheIndex.erase(it);
+                break;
+            }
+        }
+
+        Dispose(itEntry->hString);
+        m_StringCache.erase(itEntry);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::ClearStringCache()
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    for (auto& entry : m_StringCache)
+    {
+        Dispose(entry.hString);
+    }
+
+    m_StringCache.clear();
+    m_StringCacheIndex.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void* V8IsolateImpl::AllocateTransient(size_t size)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    return m_TransientArena.Allocate(size);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::FreeTransient(const void* pvBlock)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+    _ASSERTE(Arena::GetOwner(pvBlock) == &m_TransientArena);
+
+    Arena::Free(pvBlock);
+}
+
+//-----------------------------------------------------------------------------
+
 void V8IsolateImpl::TerminateExecutionInternal()
 {
     if (!m_IsExecutionTerminating)
@@ -1631,6 +1947,8 @@ V8IsolateImpl::~V8IsolateImpl()
     BEGIN_ISOLATE_SCOPE
         DisableDebugging();
         ClearScriptCache();
+        ClearStringCache();
+        ReleaseQueuedHostObjects();
     END_ISOLATE_SCOPE
 
     {
@@ -1653,6 +1971,8 @@ V8IsolateImpl::~V8IsolateImpl()
     m_upIsolate->SetHostImportModuleDynamicallyCallback(static_cast<v8::HostImportModuleDynamicallyCallback>(nullptr));
     m_upIsolate->SetHostInitializeImportMetaObjectCallback(nullptr);
 
+    m_upIsolate->RemoveGCEpilogueCallback(OnGCEpilogue, this);
+    m_upIsolate->RemoveGCPrologueCallback(OnGCPrologue, this);
     m_upIsolate->RemoveBeforeCallEnteredCallback(OnBeforeCallEntered);
     m_upIsolate->RemoveNearHeapLimitCallback(HeapExpansionCallback, 0);
 }
@@ -1754,6 +2074,11 @@ void V8IsolateImpl::ProcessCallWithLockQueue(v8::Isolate* /*pIsolate*/, void* pv
 
 void V8IsolateImpl::ProcessCallWithLockQueue()
 {
+    if (m_InFastCall)
+    {
+        return;
+    }
+
     BEGIN_PROMISE_HOOK_SCOPE
 
         std::unique_lock<std::mutex> lock(m_DataMutex.GetImpl());
@@ -1791,6 +2116,7 @@ void V8IsolateImpl::ProcessCallWithLockQueue(CallWithLockQueue& callWithLockQueu
         {
             try
             {
+                V8_TRACE_SCOPE(CallWithLock, "CallWithLock");
                 callWithLockQueue.front().second(this);
             }
             catch (...)
@@ -1990,6 +2316,13 @@ void V8IsolateImpl::ExitExecutionScope(ExecutionScope* pPreviousExecutionScope)
             m_spHeapWatchTimer.Empty();
         }
     }
+
+    // exited outermost execution scope?
+    if (pPreviousExecutionScope == nullptr)
+    {
+        // yes; release unused transient memory
+        m_TransientArena.Trim();
+    }
 }
 
 
@@ -2156,6 +2489,28 @@ void V8IsolateImpl::OnBeforeCallEntered()
 
 //-----------------------------------------------------------------------------
 
+void V8IsolateImpl::OnGCPrologue(v8::Isolate* /*pIsolate*/, v8::GCType /*type*/, v8::GCCallbackFlags /*flags*/, void* /*pvIsolateImpl*/)
+{
+    if (V8TraceRecorder::IsEnabled())
+    {
+        V8TraceRecorder::Record(V8TraceRecorder::Category::GarbageCollection, "GarbageCollection", V8TraceRecorder::Phase::Begin);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::OnGCEpilogue(v8::Isolate* /*pIsolate*/, v8::GCType /*type*/, v8::GCCallbackFlags /*flags*/, void* pvIsolateImpl)
+{
+    if (V8TraceRecorder::IsEnabled())
+    {
+        V8TraceRecorder::Record(V8TraceRecorder::Category::GarbageCollection, "GarbageCollection", V8TraceRecorder::Phase::End);
+    }
+
+    static_cast<V8IsolateImpl*>(pvIsolateImpl)->ReleaseQueuedHostObjects();
+}
+
+//-----------------------------------------------------------------------------
+
 void V8IsolateImpl::PromiseHook(v8::PromiseHookType type, v8::Local<v8::Promise> hPromise, v8::Local<v8::Value> /*hParent*/)
 {
     if ((type == v8::PromiseHookType::kResolve) && !hPromise.IsEmpty())
@@ -30,6 +30,14 @@ class V8IsolateImpl final: public V8Isolate, public v8_inspector::V8InspectorCli
             m_IsolateScope(m_IsolateImpl.m_upIsolate.get()),
             m_HandleScope(m_IsolateImpl.m_upIsolate.get())
         {
+            // V8 prohibits reentry during a fast API call; the lock is recursive, so only the
+            // thread that is making the call can get here while the call is in progress
+
+            if (m_IsolateImpl.m_InFastCall)
+            {
+                throw V8Exception(V8Exception::Type::General, m_IsolateImpl.m_Name, StdString(SL("The V8 runtime cannot be accessed from within a fast function callback")), false);
+            }
+
             m_IsolateImpl.ProcessCallWithLockQueue();
         }
 
@@ -105,6 +113,30 @@ public:
         bool m_ExecutionStarted;
     };
 
+    class FastCallScope final
+    {
+        PROHIBIT_COPY(FastCallScope)
+        PROHIBIT_HEAP(FastCallScope)
+
+    public:
+
+        explicit FastCallScope(V8IsolateImpl& isolateImpl):
+            m_IsolateImpl(isolateImpl)
+        {
+            _ASSERTE(!m_IsolateImpl.m_InFastCall);
+            m_IsolateImpl.m_InFastCall = true;
+        }
+
+        ~FastCallScope()
+        {
+            m_IsolateImpl.m_InFastCall = false;
+        }
+
+    private:
+
+        V8IsolateImpl& m_IsolateImpl;
+    };
+
     class DocumentScope final
     {
         PROHIBIT_COPY(DocumentScope)
@@ -243,6 +275,9 @@ public:
         return StdString(m_upIsolate.get(), hValue);
     }
 
+    V8Value CreateStringValue(v8::Local<v8::String> hString);
+    v8::MaybeLocal<v8::String> CreateString(V8StringBuffer& buffer);
+
     v8::Local<v8::Symbol> CreateSymbol(v8::Local<v8::String> hName = v8::Local<v8::String>())
     {
         return v8::Symbol::New(m_upIsolate.get(), hName);
@@ -258,6 +293,11 @@ public:
         return v8::Array::New(m_upIsolate.get(), length);
     }
 
+    v8::Local<v8::Array> CreateArray(v8::Local<v8::Value>* pElements, size_t length)
+    {
+        return v8::Array::New(m_upIsolate.get(), pElements, length);
+    }
+
     v8::Local<v8::PrimitiveArray> CreatePrimitiveArray(int length)
     {
         return v8::PrimitiveArray::New(m_upIsolate.get(), length);
@@ -283,11 +323,21 @@ public:
         return v8::ObjectTemplate::New(m_upIsolate.get());
     }
 
+    v8::Local<v8::DictionaryTemplate> CreateDictionaryTemplate(const std::vector<std::string_view>& names)
+    {
+        return v8::DictionaryTemplate::New(m_upIsolate.get(), v8::MemorySpan<const std::string_view>(names.data(), names.size()));
+    }
+
     v8::Local<v8::FunctionTemplate> CreateFunctionTemplate(v8::FunctionCallback callback = 0, v8::Local<v8::Value> data = v8::Local<v8::Value>(), v8::Local<v8::Signature> signature = v8::Local<v8::Signature>(), int length = 0)
     {
         return v8::FunctionTemplate::New(m_upIsolate.get(), callback, data, signature, length);
     }
 
+    v8::Local<v8::FunctionTemplate> CreateFunctionTemplate(v8::FunctionCallback callback, v8::Local<v8::Value> data, int length, const v8::CFunction* pCFunction)
+    {
+        return v8::FunctionTemplate::New(m_upIsolate.get(), callback, data, v8::Local<v8::Signature>(), length, v8::ConstructorBehavior::kThrow, v8::SideEffectType::kHasSideEffect, pCFunction);
+    }
+
     v8::Local<v8::SharedArrayBuffer> CreateSharedArrayBuffer(const std::shared_ptr<v8::BackingStore>& spBackingStore)
     {
         return v8::SharedArrayBuffer::New(m_upIsolate.get(), spBackingStore);
@@ -475,6 +525,9 @@ public:
     void RemoveContext(V8ContextImpl* pContextImpl);
     V8ContextImpl* FindContext(v8::Local<v8::Context> hContext);
 
+    void QueueHostObjectRelease(void* pvObject);
+    void ReleaseQueuedHostObjects();
+
     void EnableDebugging(int port, bool remote);
     void DisableDebugging();
 
@@ -486,6 +539,9 @@ public:
     virtual size_t GetMaxStackUsage() override;
     virtual void SetMaxStackUsage(size_t value) override;
 
+    virtual size_t GetMaxStringCacheSize() override;
+    virtual void SetMaxStringCacheSize(size_t value) override;
+
     virtual void AwaitDebuggerAndPause() override;
     virtual void CancelAwaitDebugger() override;
 
@@ -556,6 +612,13 @@ public:
     void SetCachedScriptCacheBytes(uint64_t uniqueId, size_t codeDigest, const std::vector<uint8_t>& cacheBytes);
     void ClearScriptCache();
 
+    v8::MaybeLocal<v8::String> GetCachedString(const StdString& value);
+    void TrimStringCache(size_t maxSize);
+    void ClearStringCache();
+
+    void* AllocateTransient(size_t size);
+    void FreeTransient(const void* pvBlock);
+
     void TerminateExecutionInternal();
     void CancelTerminateExecutionInternal();
 
@@ -609,6 +672,16 @@ private:
         std::vector<uint8_t> CacheBytes;
     };
 
+    struct StringCacheEntry final
+    {
+        StdString Value;
+        size_t Digest;
+        Persistent<v8::String> hString;
+    };
+
+    using StringCache = std::list<StringCacheEntry>;
+    using StringCacheIndex = std::unordered_multimap<size_t, StringCache::iterator>;
+
     enum class RunMessageLoopReason
     {
         AwaitingDebugger,
@@ -650,6 +723,9 @@ private:
     static void OnBeforeCallEntered(v8::Isolate* pIsolate);
     void OnBeforeCallEntered();
 
+    static void OnGCPrologue(v8::Isolate* pIsolate, v8::GCType type, v8::GCCallbackFlags flags, void* pvIsolateImpl);
+    static void OnGCEpilogue(v8::Isolate* pIsolate, v8::GCType type, v8::GCCallbackFlags flags, void* pvIsolateImpl);
+
     static void PromiseHook(v8::PromiseHookType type, v8::Local<v8::Promise> hPromise, v8::Local<v8::Value> hParent);
 
     void FlushContextAsync(v8::Local<v8::Context> hContext);
@@ -671,7 +747,11 @@ private:
     std::condition_variable m_CallWithLockQueueChanged;
     size_t m_CallWithLockLevel;
     std::vector<SharedPtr<Timer>> m_TaskTimers;
+    std::vector<void*> m_QueuedHostObjectReleases;
     std::list<ScriptCacheEntry> m_ScriptCache;
+    StringCache m_StringCache;
+    StringCacheIndex m_StringCacheIndex;
+    Arena m_TransientArena;
     bool m_DebuggingEnabled;
     int m_DebugPort;
     void* m_pvDebugAgent;
@@ -687,6 +767,7 @@ private:
     double m_HeapExpansionMultiplier;
     SharedPtr<Timer> m_spHeapWatchTimer;
     std::atomic<size_t> m_MaxStackUsage;
+    std::atomic<size_t> m_MaxStringCacheSize;
     std::atomic<bool> m_EnableInterruptPropagation;
     std::atomic<bool> m_DisableHeapSizeViolationInterrupt;
     std::atomic<uint32_t> m_CpuProfileSampleInterval;
@@ -695,6 +776,7 @@ private:
     SimpleMutex m_TerminateExecutionMutex;
     bool m_IsExecutionTerminating;
     ExecutionScope* m_pExecutionScope;
+    bool m_InFastCall;
     const V8DocumentInfo* m_pDocumentInfo;
     std::atomic<bool> m_IsOutOfMemory;
     std::atomic<bool> m_Released;
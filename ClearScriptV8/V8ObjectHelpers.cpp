@@ -42,6 +42,20 @@ void V8ObjectHelpers::GetPropertyNames(const SharedPtr<V8ObjectHolder>& spHolder
 
 //-----------------------------------------------------------------------------
 
+void V8ObjectHelpers::GetProperties(const SharedPtr<V8ObjectHolder>& spHolder, const std::vector<StdString>& names, std::vector<V8Value>& values)
+{
+    spHolder.DerefAs<V8ObjectHolderImpl>().GetProperties(names, values);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ObjectHelpers::SetProperties(const SharedPtr<V8ObjectHolder>& spHolder, const std::vector<StdString>& names, const std::vector<V8Value>& values)
+{
+    spHolder.DerefAs<V8ObjectHolderImpl>().SetProperties(names, values);
+}
+
+//-----------------------------------------------------------------------------
+
 V8Value V8ObjectHelpers::GetProperty(const SharedPtr<V8ObjectHolder>& spHolder, int index)
 {
     return spHolder.DerefAs<V8ObjectHolderImpl>().GetProperty(index);
@@ -70,6 +84,27 @@ void V8ObjectHelpers::GetPropertyIndices(const SharedPtr<V8ObjectHolder>& spHold
 
 //-----------------------------------------------------------------------------
 
+V8ObjectHelpers::ArrayExportKind V8ObjectHelpers::ExportArray(const SharedPtr<V8ObjectHolder>& spHolder, std::vector<V8Value>& values, std::vector<uint8_t>& packedValues)
+{
+    return spHolder.DerefAs<V8ObjectHolderImpl>().ExportArray(values, packedValues);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ObjectHelpers::Serialize(const SharedPtr<V8ObjectHolder>& spHolder, std::vector<uint8_t>& data, std::vector<V8Value>& sharedObjects)
+{
+    spHolder.DerefAs<V8ObjectHolderImpl>().Serialize(data, sharedObjects);
+}
+
+//-----------------------------------------------------------------------------
+
+StdString V8ObjectHelpers::ToJson(const SharedPtr<V8ObjectHolder>& spHolder)
+{
+    return spHolder.DerefAs<V8ObjectHolderImpl>().ToJson();
+}
+
+//-----------------------------------------------------------------------------
+
 V8Value V8ObjectHelpers::Invoke(const SharedPtr<V8ObjectHolder>& spHolder, bool asConstructor, const std::vector<V8Value>& args)
 {
     return spHolder.DerefAs<V8ObjectHolderImpl>().Invoke(asConstructor, args);
@@ -9,16 +9,30 @@
 
 struct V8ObjectHelpers final: StaticBase
 {
+    enum class ArrayExportKind: int32_t
+    {
+        // IMPORTANT: maintain bitwise equivalence with managed enum V8.SplitProxy.V8Object.ArrayExportKind
+        Values,
+        Int32,
+        Double,
+        Unsupported
+    };
+
     static V8Value GetProperty(const SharedPtr<V8ObjectHolder>& spHolder, const StdString& name);
     static bool TryGetProperty(const SharedPtr<V8ObjectHolder>& spHolder, const StdString& name, V8Value& value);
     static void SetProperty(const SharedPtr<V8ObjectHolder>& spHolder, const StdString& name, const V8Value& value);
     static bool DeleteProperty(const SharedPtr<V8ObjectHolder>& spHolder, const StdString& name);
     static void GetPropertyNames(const SharedPtr<V8ObjectHolder>& spHolder, bool includeIndices, std::vector<StdString>& names);
+    static void GetProperties(const SharedPtr<V8ObjectHolder>& spHolder, const std::vector<StdString>& names, std::vector<V8Value>& values);
+    static void SetProperties(const SharedPtr<V8ObjectHolder>& spHolder, const std::vector<StdString>& names, const std::vector<V8Value>& values);
 
     static V8Value GetProperty(const SharedPtr<V8ObjectHolder>& spHolder, int index);
     static void SetProperty(const SharedPtr<V8ObjectHolder>& spHolder, int index, const V8Value& value);
     static bool DeleteProperty(const SharedPtr<V8ObjectHolder>& spHolder, int index);
     static void GetPropertyIndices(const SharedPtr<V8ObjectHolder>& spHolder, std::vector<int>& indices);
+    static ArrayExportKind ExportArray(const SharedPtr<V8ObjectHolder>& spHolder, std::vector<V8Value>& values, std::vector<uint8_t>& packedValues);
+    static void Serialize(const SharedPtr<V8ObjectHolder>& spHolder, std::vector<uint8_t>& data, std::vector<V8Value>& sharedObjects);
+    static StdString ToJson(const SharedPtr<V8ObjectHolder>& spHolder);
 
     static V8Value Invoke(const SharedPtr<V8ObjectHolder>& spHolder, bool asConstructor, const std::vector<V8Value>& args);
     static V8Value InvokeMethod(const SharedPtr<V8ObjectHolder>& spHolder, const StdString& name, const std::vector<V8Value>& args);
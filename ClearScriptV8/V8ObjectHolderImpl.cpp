@@ -4,12 +4,48 @@
 #include "ClearScriptV8Native.h"
 
 //-----------------------------------------------------------------------------
-// V8ObjectHolderImpl implementation
+// V8ObjectRef implementation
 //-----------------------------------------------------------------------------
 
-V8ObjectHolderImpl::V8ObjectHolderImpl(const SharedPtr<V8WeakContextBinding>& spBinding, void* pvObject, int32_t identityHash, const SharedPtr<V8SharedObjectInfo>& spSharedObjectInfo):
+V8ObjectRef::V8ObjectRef(const SharedPtr<V8WeakContextBinding>& spBinding, void* pvObject):
     m_spBinding(spBinding),
-    m_pvObject(pvObject),
+    m_pvObject(pvObject)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+const SharedPtr<V8WeakContextBinding>& V8ObjectRef::GetBinding() const
+{
+    return m_spBinding;
+}
+
+//-----------------------------------------------------------------------------
+
+void* V8ObjectRef::GetObject() const
+{
+    return m_pvObject;
+}
+
+//-----------------------------------------------------------------------------
+
+V8ObjectRef::~V8ObjectRef()
+{
+    SharedPtr<V8IsolateImpl> spIsolateImpl;
+    if (m_spBinding->TryGetIsolateImpl(spIsolateImpl))
+    {
+        spIsolateImpl->ReleaseV8Object(m_pvObject);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// V8ObjectHolderImpl implementation
+//-----------------------------------------------------------------------------
+
+V8ObjectHolderImpl::V8ObjectHolderImpl(const SharedPtr<V8ObjectRef>& spObjectRef, int32_t identityHash, const SharedPtr<V8SharedObjectInfo>& spSharedObjectInfo):
+    m_spObjectRef(spObjectRef),
+    m_spBinding(spObjectRef->GetBinding()),
+    m_pvObject(spObjectRef->GetObject()),
     m_IdentityHash(identityHash),
     m_spSharedObjectInfo(spSharedObjectInfo)
 {
@@ -19,7 +55,8 @@ V8ObjectHolderImpl::V8ObjectHolderImpl(const SharedPtr<V8WeakContextBinding>& sp
 
 V8ObjectHolderImpl* V8ObjectHolderImpl::Clone() const
 {
-    return new V8ObjectHolderImpl(m_spBinding, m_spBinding->GetIsolateImpl()->AddRefV8Object(m_pvObject), m_IdentityHash, m_spSharedObjectInfo);
+    // clones share the underlying persistent handle; it's released with the last reference
+    return new V8ObjectHolderImpl(m_spObjectRef, m_IdentityHash, m_spSharedObjectInfo);
 }
 
 //-----------------------------------------------------------------------------
@@ -93,6 +130,20 @@ void V8ObjectHolderImpl::GetPropertyNames(bool includeIndices, std::vector<StdSt
 
 //-----------------------------------------------------------------------------
 
+void V8ObjectHolderImpl::GetProperties(const std::vector<StdString>& names, std::vector<V8Value>& values) const
+{
+    m_spBinding->GetContextImpl()->GetV8ObjectProperties(m_pvObject, names, values);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ObjectHolderImpl::SetProperties(const std::vector<StdString>& names, const std::vector<V8Value>& values) const
+{
+    m_spBinding->GetContextImpl()->SetV8ObjectProperties(m_pvObject, names, values);
+}
+
+//-----------------------------------------------------------------------------
+
 V8Value V8ObjectHolderImpl::GetProperty(int index) const
 {
     return m_spBinding->GetContextImpl()->GetV8ObjectProperty(m_pvObject, index);
@@ -121,6 +172,27 @@ void V8ObjectHolderImpl::GetPropertyIndices(std::vector<int>& indices) const
 
 //-----------------------------------------------------------------------------
 
+V8ObjectHelpers::ArrayExportKind V8ObjectHolderImpl::ExportArray(std::vector<V8Value>& values, std::vector<uint8_t>& packedValues) const
+{
+    return m_spBinding->GetContextImpl()->ExportV8Array(m_pvObject, values, packedValues);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ObjectHolderImpl::Serialize(std::vector<uint8_t>& data, std::vector<V8Value>& sharedObjects) const
+{
+    m_spBinding->GetContextImpl()->SerializeV8Object(m_pvObject, data, sharedObjects);
+}
+
+//-----------------------------------------------------------------------------
+
+StdString V8ObjectHolderImpl::ToJson() const
+{
+    return m_spBinding->GetContextImpl()->StringifyV8Object(m_pvObject);
+}
+
+//-----------------------------------------------------------------------------
+
 V8Value V8ObjectHolderImpl::Invoke(bool asConstructor, const std::vector<V8Value>& args) const
 {
     return m_spBinding->GetContextImpl()->InvokeV8Object(m_pvObject, asConstructor, args);
@@ -146,14 +218,3 @@ void V8ObjectHolderImpl::InvokeWithArrayBufferOrViewData(V8ObjectHelpers::ArrayB
 {
     m_spBinding->GetContextImpl()->InvokeWithV8ObjectArrayBufferOrViewData(m_pvObject, pCallback, pvArg);
 }
-
-//-----------------------------------------------------------------------------
-
-V8ObjectHolderImpl::~V8ObjectHolderImpl()
-{
-    SharedPtr<V8IsolateImpl> spIsolateImpl;
-    if (m_spBinding->TryGetIsolateImpl(spIsolateImpl))
-    {
-        spIsolateImpl->ReleaseV8Object(m_pvObject);
-    }
-}
@@ -3,6 +3,29 @@
 
 #pragma once
 
+//-----------------------------------------------------------------------------
+// V8ObjectRef
+//-----------------------------------------------------------------------------
+
+class V8ObjectRef final: public WeakRefTarget<V8ObjectRef>
+{
+    PROHIBIT_COPY(V8ObjectRef)
+
+public:
+
+    V8ObjectRef(const SharedPtr<V8WeakContextBinding>& spBinding, void* pvObject);
+
+    const SharedPtr<V8WeakContextBinding>& GetBinding() const;
+    void* GetObject() const;
+
+    ~V8ObjectRef();
+
+private:
+
+    SharedPtr<V8WeakContextBinding> m_spBinding;
+    void* m_pvObject;
+};
+
 //-----------------------------------------------------------------------------
 // V8ObjectHolderImpl
 //-----------------------------------------------------------------------------
@@ -13,7 +36,7 @@ class V8ObjectHolderImpl final: public V8ObjectHolder
 
 public:
 
-    V8ObjectHolderImpl(const SharedPtr<V8WeakContextBinding>& spBinding, void* pvObject, int32_t identityHash, const SharedPtr<V8SharedObjectInfo>& spSharedObjectInfo);
+    V8ObjectHolderImpl(const SharedPtr<V8ObjectRef>& spObjectRef, int32_t identityHash, const SharedPtr<V8SharedObjectInfo>& spSharedObjectInfo);
 
     virtual V8ObjectHolderImpl* Clone() const override;
     virtual bool IsSameIsolate(const SharedPtr<V8IsolateImpl>& spThat) const override;
@@ -26,11 +49,16 @@ public:
     void SetProperty(const StdString& name, const V8Value& value) const;
     bool DeleteProperty(const StdString& name) const;
     void GetPropertyNames(bool includeIndices, std::vector<StdString>& names) const;
+    void GetProperties(const std::vector<StdString>& names, std::vector<V8Value>& values) const;
+    void SetProperties(const std::vector<StdString>& names, const std::vector<V8Value>& values) const;
 
     V8Value GetProperty(int index) const;
     void SetProperty(int index, const V8Value& value) const;
     bool DeleteProperty(int index) const;
     void GetPropertyIndices(std::vector<int>& indices) const;
+    V8ObjectHelpers::ArrayExportKind ExportArray(std::vector<V8Value>& values, std::vector<uint8_t>& packedValues) const;
+    void Serialize(std::vector<uint8_t>& data, std::vector<V8Value>& sharedObjects) const;
+    StdString ToJson() const;
 
     V8Value Invoke(bool asConstructor, const std::vector<V8Value>& args) const;
     V8Value InvokeMethod(const StdString& name, const std::vector<V8Value>& args) const;
@@ -38,10 +66,9 @@ public:
     void GetArrayBufferOrViewInfo(V8Value& arrayBuffer, size_t& offset, size_t& size, size_t& length) const;
     void InvokeWithArrayBufferOrViewData(V8ObjectHelpers::ArrayBufferOrViewDataCallback* pCallback, void* pvArg) const;
 
-    ~V8ObjectHolderImpl();
-
 private:
 
+    SharedPtr<V8ObjectRef> m_spObjectRef;
     SharedPtr<V8WeakContextBinding> m_spBinding;
     void* m_pvObject;
     int32_t m_IdentityHash;
@@ -27,6 +27,7 @@
 #endif // CLEARSCRIPT_V8_POINTER_COMPRESSION_ENABLED
 
 #include "v8.h"
+#include "v8-fast-api-calls.h"
 #include "v8-platform.h"
 #include "v8-inspector.h"
 #include "v8-profiler.h"
@@ -10,6 +10,13 @@
 thread_local void** V8SplitProxyManaged::ms_pMethodTable = nullptr;
 thread_local HostException* V8SplitProxyManaged::ms_pHostException = nullptr;
 
+V8SplitProxyStatistics::Site V8SplitProxyManaged::ms_StatisticsSites[] =
+{
+    #define V8_SPLIT_PROXY_MANAGED_METHOD(TYPE, NAME, ...) { V8SplitProxyStatistics::SiteKind::ManagedMethod, #NAME },
+        V8_SPLIT_PROXY_MANAGED_METHOD_LIST
+    #undef V8_SPLIT_PROXY_MANAGED_METHOD
+};
+
 //-----------------------------------------------------------------------------
 
 void** V8SplitProxyManaged::SetMethodTable(void** pMethodTable) noexcept
@@ -24,12 +24,6 @@
     V8_SPLIT_PROXY_MANAGED_METHOD(void, ProcessArrayBufferOrViewDataWithArg, void* pvData, void* pvAction, void* pvArg) \
     V8_SPLIT_PROXY_MANAGED_METHOD(void, ProcessCpuProfile, const v8::CpuProfile& profile, void* pvAction) \
     \
-    V8_SPLIT_PROXY_MANAGED_METHOD(void*, CreateV8ObjectCache) \
-    V8_SPLIT_PROXY_MANAGED_METHOD(void, CacheV8Object, void* pvCache, void* pvObject, void* pvV8Object) \
-    V8_SPLIT_PROXY_MANAGED_METHOD(void*, GetCachedV8Object, void* pvCache, void* pvObject) \
-    V8_SPLIT_PROXY_MANAGED_METHOD(void, GetAllCachedV8Objects, void* pvCache, std::vector<void*>& v8ObjectPtrs) \
-    V8_SPLIT_PROXY_MANAGED_METHOD(StdBool, RemoveV8ObjectCacheEntry, void* pvCache, void* pvObject) \
-    \
     V8_SPLIT_PROXY_MANAGED_METHOD(void*, CreateDebugAgent, const StdString& name, const StdString& version, int32_t port, StdBool remote, V8DebugCallbackHandle* pCallbackHandle) \
     V8_SPLIT_PROXY_MANAGED_METHOD(void, SendDebugMessage, void* pvAgent, const StdString& content) \
     V8_SPLIT_PROXY_MANAGED_METHOD(void, DestroyDebugAgent, void* pvAgent) \
@@ -39,7 +33,10 @@
     \
     V8_SPLIT_PROXY_MANAGED_METHOD(void*, AddRefHostObject, void* pvObject) \
     V8_SPLIT_PROXY_MANAGED_METHOD(void, ReleaseHostObject, void* pvObject) \
+    V8_SPLIT_PROXY_MANAGED_METHOD(void, ReleaseHostObjects, const std::vector<void*>& objectPtrs) \
     V8_SPLIT_PROXY_MANAGED_METHOD(HostObjectUtil::Invocability, GetHostObjectInvocability, void* pvObject) \
+    V8_SPLIT_PROXY_MANAGED_METHOD(int32_t, GetHostObjectTypeId, void* pvObject) \
+    V8_SPLIT_PROXY_MANAGED_METHOD(void, GetHostObjectTypeMemberNames, void* pvObject, std::vector<StdString>& names, std::vector<StdString>& extensionMethodNames) \
     \
     V8_SPLIT_PROXY_MANAGED_METHOD(void, GetHostObjectNamedProperty, void* pvObject, const StdString& name, V8Value& value, StdBool& isCacheable) \
     V8_SPLIT_PROXY_MANAGED_METHOD(void, SetHostObjectNamedProperty, void* pvObject, const StdString& name, const V8Value::Decoded& value) \
@@ -70,10 +67,14 @@
     V8_SPLIT_PROXY_MANAGED_METHOD(void, GetFastHostObjectPropertyIndices, void* pvObject, std::vector<int32_t>& indices) \
     \
     V8_SPLIT_PROXY_MANAGED_METHOD(void, InvokeFastHostObject, void* pvObject, StdBool asConstructor, int32_t argCount, const V8Value::FastArg* pArgs, V8Value::FastResult& result) \
+    V8_SPLIT_PROXY_MANAGED_METHOD(void, InvokeFastHostFunction, void* pvFunction, int32_t argCount, const FastHostObjectUtil::CallValue* pArgs, FastHostObjectUtil::CallValue& result) \
     \
     V8_SPLIT_PROXY_MANAGED_METHOD(void, GetFastHostObjectEnumerator, void* pvObject, V8Value::FastResult& result) \
     V8_SPLIT_PROXY_MANAGED_METHOD(void, GetFastHostObjectAsyncEnumerator, void* pvObject, V8Value::FastResult& result) \
     \
+    V8_SPLIT_PROXY_MANAGED_METHOD(int32_t, GetHostEnumeratorChunk, void* pvEnumerator, int32_t maxCount, V8Value::FastResult* pItems) \
+    V8_SPLIT_PROXY_MANAGED_METHOD(void, FetchHostAsyncEnumeratorChunk, void* pvEnumerator, int32_t maxCount, V8Value& promise) \
+    \
     V8_SPLIT_PROXY_MANAGED_METHOD(void, QueueNativeCallback, NativeCallbackHandle* pCallbackHandle) \
     \
     V8_SPLIT_PROXY_MANAGED_METHOD(void*, CreateNativeCallbackTimer, int32_t dueTime, int32_t period, NativeCallbackHandle* pCallbackHandle) \
@@ -111,9 +112,15 @@ public:
     static void** SetMethodTable(void** pMethodTable) noexcept;
     static void SetHostException(HostException&& exception) noexcept;
 
-    template <typename T>
-    static T Invoke(const std::function<T(void** pMethodTable)>& action)
+    // The invocation helpers below take the call site by reference as a template argument rather
+    // than as a std::function. Each call site's lambda is inlined into its helper instance, so a
+    // crossing involves no type erasure and no heap allocation regardless of capture size.
+
+    template <typename T, typename TAction>
+    static T Invoke(MethodSlot slot, const TAction& action)
     {
+        InstrumentationScope instrumentationScope(slot);
+
         auto pMethodTable = ms_pMethodTable;
         _ASSERTE(pMethodTable != nullptr);
 
@@ -124,8 +131,11 @@ public:
         END_PULSE_VALUE_SCOPE
     }
 
-    static void InvokeVoid(const std::function<void(void** pMethodTable)>& action)
+    template <typename TAction>
+    static void InvokeVoid(MethodSlot slot, const TAction& action)
     {
+        InstrumentationScope instrumentationScope(slot);
+
         auto pMethodTable = ms_pMethodTable;
         _ASSERTE(pMethodTable != nullptr);
 
@@ -135,16 +145,21 @@ public:
         END_PULSE_VALUE_SCOPE
     }
 
-    template <typename T>
-    static T InvokeNoThrow(const std::function<T(void** pMethodTable)>& action) noexcept
+    template <typename T, typename TAction>
+    static T InvokeNoThrow(MethodSlot slot, const TAction& action) noexcept
     {
+        InstrumentationScope instrumentationScope(slot);
+
         auto pMethodTable = ms_pMethodTable;
         _ASSERTE(pMethodTable != nullptr);
         return action(pMethodTable);
     }
 
-    static void InvokeVoidNoThrow(const std::function<void(void** pMethodTable)>& action) noexcept
+    template <typename TAction>
+    static void InvokeVoidNoThrow(MethodSlot slot, const TAction& action) noexcept
     {
+        InstrumentationScope instrumentationScope(slot);
+
         auto pMethodTable = ms_pMethodTable;
         _ASSERTE(pMethodTable != nullptr);
         action(pMethodTable);
@@ -152,10 +167,40 @@ public:
 
 private:
 
+    class InstrumentationScope final
+    {
+        PROHIBIT_COPY(InstrumentationScope)
+        PROHIBIT_HEAP(InstrumentationScope)
+
+    public:
+
+        explicit InstrumentationScope(MethodSlot slot) noexcept:
+            InstrumentationScope(V8Instrumentation::GetFlags(), GetStatisticsSite(slot))
+        {
+        }
+
+    private:
+
+        InstrumentationScope(V8Instrumentation::Flags flags, V8SplitProxyStatistics::Site& site) noexcept:
+            m_StatisticsScope(flags, site),
+            m_TraceScope(flags, V8TraceRecorder::Category::HostCall, site.GetName())
+        {
+        }
+
+        V8SplitProxyStatistics::Scope m_StatisticsScope;
+        V8TraceRecorder::Scope m_TraceScope;
+    };
+
+    static V8SplitProxyStatistics::Site& GetStatisticsSite(MethodSlot slot) noexcept
+    {
+        return ms_StatisticsSites[::ToUnderlyingType(slot)];
+    }
+
     static void ThrowHostException();
 
     static thread_local void** ms_pMethodTable;
     static thread_local HostException* ms_pHostException;
+    static V8SplitProxyStatistics::Site ms_StatisticsSites[];
 };
 
 //-----------------------------------------------------------------------------
@@ -164,13 +209,13 @@ private:
     reinterpret_cast<V8SplitProxyManaged::Method::NAME*>((TABLE)[::ToUnderlyingType(V8SplitProxyManaged::MethodSlot::NAME)])(__VA_ARGS__)
 
 #define V8_SPLIT_PROXY_MANAGED_INVOKE(TYPE, NAME, ...) \
-    V8SplitProxyManaged::Invoke<TYPE>([&] (void** pMethodTable) noexcept { return V8_SPLIT_PROXY_MANAGED_CALL(pMethodTable, NAME, __VA_ARGS__); })
+    V8SplitProxyManaged::Invoke<TYPE>(V8SplitProxyManaged::MethodSlot::NAME, [&] (void** pMethodTable) noexcept { return V8_SPLIT_PROXY_MANAGED_CALL(pMethodTable, NAME, __VA_ARGS__); })
 
 #define V8_SPLIT_PROXY_MANAGED_INVOKE_VOID(NAME, ...) \
-    V8SplitProxyManaged::InvokeVoid([&] (void** pMethodTable) noexcept { V8_SPLIT_PROXY_MANAGED_CALL(pMethodTable, NAME, __VA_ARGS__); })
+    V8SplitProxyManaged::InvokeVoid(V8SplitProxyManaged::MethodSlot::NAME, [&] (void** pMethodTable) noexcept { V8_SPLIT_PROXY_MANAGED_CALL(pMethodTable, NAME, __VA_ARGS__); })
 
 #define V8_SPLIT_PROXY_MANAGED_INVOKE_NOTHROW(TYPE, NAME, ...) \
-    V8SplitProxyManaged::InvokeNoThrow<TYPE>([&] (void** pMethodTable) noexcept { return V8_SPLIT_PROXY_MANAGED_CALL(pMethodTable, NAME, __VA_ARGS__); })
+    V8SplitProxyManaged::InvokeNoThrow<TYPE>(V8SplitProxyManaged::MethodSlot::NAME, [&] (void** pMethodTable) noexcept { return V8_SPLIT_PROXY_MANAGED_CALL(pMethodTable, NAME, __VA_ARGS__); })
 
 #define V8_SPLIT_PROXY_MANAGED_INVOKE_VOID_NOTHROW(NAME, ...) \
-    V8SplitProxyManaged::InvokeVoidNoThrow([&] (void** pMethodTable) noexcept { V8_SPLIT_PROXY_MANAGED_CALL(pMethodTable, NAME, __VA_ARGS__); })
+    V8SplitProxyManaged::InvokeVoidNoThrow(V8SplitProxyManaged::MethodSlot::NAME, [&] (void** pMethodTable) noexcept { V8_SPLIT_PROXY_MANAGED_CALL(pMethodTable, NAME, __VA_ARGS__); })
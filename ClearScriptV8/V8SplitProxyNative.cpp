@@ -4,6 +4,24 @@
 #include "ClearScriptV8Native.h"
 #include "../ClearScript/Exports/VersionSymbols.h"
 
+//-----------------------------------------------------------------------------
+// entry point definition macros
+//-----------------------------------------------------------------------------
+
+// Every entry point is defined with one of these so that none can silently miss its statistics
+// scope. Only the entry points that control instrumentation are left unrecorded.
+
+#define BEGIN_NATIVE_ENTRY_POINT(TYPE, NAME, ...) \
+    BEGIN_UNRECORDED_NATIVE_ENTRY_POINT(TYPE, NAME, __VA_ARGS__) \
+        V8_SPLIT_PROXY_STATISTICS_SCOPE(NativeEntryPoint, __func__);
+
+#define BEGIN_UNRECORDED_NATIVE_ENTRY_POINT(TYPE, NAME, ...) \
+    NATIVE_ENTRY_POINT(TYPE) NAME(__VA_ARGS__) noexcept \
+    {
+
+#define END_NATIVE_ENTRY_POINT \
+    }
+
 //-----------------------------------------------------------------------------
 // local helper functions
 //-----------------------------------------------------------------------------
@@ -117,6 +135,159 @@ void V8Exception::ScheduleScriptEngineException() const noexcept
     }
 }
 
+//-----------------------------------------------------------------------------
+// V8EntityHandleSlab
+//-----------------------------------------------------------------------------
+
+// Entity handles are carved out of fixed-size blocks in chunks that are never freed, so a block
+// index always refers to valid memory. Free blocks form a lock-free stack whose head carries a
+// generation tag alongside the index of the top block; the tag changes on every update, which
+// keeps a stale head from being mistaken for a current one. If the slab is exhausted, blocks are
+// allocated individually.
+//
+// Because a thread popping the stack may still read the link of a block that another thread has
+// just taken, chunk memory can't be returned even when all of its blocks are free. The slab
+// therefore retains its high-water mark for the life of the process, up to 256 chunks of 4096
+// blocks (1M handles, 48 MiB with 48-byte blocks on 64-bit platforms). Handles beyond that
+// limit live on the heap and are freed individually.
+
+class V8EntityHandleSlab final: StaticBase
+{
+public:
+
+    static void* Allocate()
+    {
+        auto& state = GetState();
+
+        while (true)
+        {
+            auto head = state.FreeHead.load(std::memory_order_acquire);
+            auto index = GetIndex(head);
+
+            if (index == 0)
+            {
+                // once the slab is exhausted, skip the mutex and go straight to the heap
+
+                if (state.Exhausted.load(std::memory_order_relaxed) || !TryAddChunk(state))
+                {
+                    return (new Block)->Storage;
+                }
+
+                continue;
+            }
+
+            auto pBlock = GetBlock(state, index);
+            auto newHead = Pack(GetGeneration(head) + 1, pBlock->NextFreeIndex.load(std::memory_order_relaxed));
+
+            if (state.FreeHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return pBlock->Storage;
+            }
+        }
+    }
+
+    static void Free(void* pvBlock) noexcept
+    {
+        auto pBlock = reinterpret_cast<Block*>(pvBlock);
+        if (pBlock->Index == 0)
+        {
+            delete pBlock;
+            return;
+        }
+
+        Push(GetState(), pBlock, pBlock);
+    }
+
+private:
+
+    struct Block final
+    {
+        alignas(std::max_align_t) uint8_t Storage[V8EntityHandleBase::MaxHandleSize];
+        std::atomic<uint32_t> NextFreeIndex { 0 };
+        uint32_t Index { 0 };
+    };
+
+    static_assert(offsetof(Block, Storage) == 0, "slab block storage must be at offset zero");
+    static_assert((Constants::MaxEntityHandleSlabChunkCount * Constants::EntityHandleSlabChunkSize * sizeof(Block)) <= (64 * 1024 * 1024), "entity handle slab may retain too much memory");
+
+    struct State final
+    {
+        std::atomic<uint64_t> FreeHead { 0 };
+        std::array<std::atomic<Block*>, Constants::MaxEntityHandleSlabChunkCount> Chunks {};
+        size_t ChunkCount { 0 };
+        std::atomic<bool> Exhausted { false };
+        SimpleMutex Mutex;
+    };
+
+    static State& GetState() noexcept
+    {
+        static auto pState = new State;
+        return *pState;
+    }
+
+    static uint64_t Pack(uint32_t generation, uint32_t index) noexcept
+    {
+        return (static_cast<uint64_t>(generation) << 32) | index;
+    }
+
+    static uint32_t GetGeneration(uint64_t head) noexcept
+    {
+        return static_cast<uint32_t>(head >> 32);
+    }
+
+    static uint32_t GetIndex(uint64_t head) noexcept
+    {
+        return static_cast<uint32_t>(head);
+    }
+
+    static Block* GetBlock(const State& state, uint32_t index) noexcept
+    {
+        auto pChunk = state.Chunks[(index - 1) / Constants::EntityHandleSlabChunkSize].load(std::memory_order_acquire);
+        return pChunk + ((index - 1) % Constants::EntityHandleSlabChunkSize);
+    }
+
+    static void Push(State& state, Block* pFirst, Block* pLast) noexcept
+    {
+        auto head = state.FreeHead.load(std::memory_order_relaxed);
+        do
+        {
+            pLast->NextFreeIndex.store(GetIndex(head), std::memory_order_relaxed);
+        }
+        while (!state.FreeHead.compare_exchange_weak(head, Pack(GetGeneration(head) + 1, pFirst->Index), std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    static bool TryAddChunk(State& state)
+    {
+        BEGIN_MUTEX_SCOPE(state.Mutex)
+
+            if (GetIndex(state.FreeHead.load(std::memory_order_acquire)) != 0)
+            {
+                return true;
+            }
+
+            if (state.ChunkCount >= Constants::MaxEntityHandleSlabChunkCount)
+            {
+                state.Exhausted.store(true, std::memory_order_relaxed);
+                return false;
+            }
+
+            auto pChunk = new Block[Constants::EntityHandleSlabChunkSize];
+            auto baseIndex = static_cast<uint32_t>(state.ChunkCount * Constants::EntityHandleSlabChunkSize);
+
+            for (size_t offset = 0; offset < Constants::EntityHandleSlabChunkSize; offset++)
+            {
+                pChunk[offset].Index = baseIndex + static_cast<uint32_t>(offset) + 1;
+                pChunk[offset].NextFreeIndex.store(pChunk[offset].Index + 1, std::memory_order_relaxed);
+            }
+
+            state.Chunks[state.ChunkCount++].store(pChunk, std::memory_order_release);
+            Push(state, pChunk, pChunk + (Constants::EntityHandleSlabChunkSize - 1));
+            return true;
+
+        END_MUTEX_SCOPE
+    }
+};
+
 //-----------------------------------------------------------------------------
 // V8EntityHandleBase implementation
 //-----------------------------------------------------------------------------
@@ -131,6 +302,22 @@ StdString V8EntityHandleBase::GetEntityReleasedMessage(const StdChar* pName) noe
 
 //-----------------------------------------------------------------------------
 
+void* V8EntityHandleBase::operator new(size_t size)
+{
+    _ASSERTE(size <= MaxHandleSize);
+    IGNORE_UNUSED(size);
+    return V8EntityHandleSlab::Allocate();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8EntityHandleBase::operator delete(void* pvHandle) noexcept
+{
+    V8EntityHandleSlab::Free(pvHandle);
+}
+
+//-----------------------------------------------------------------------------
+
 void V8EntityHandleBase::ScheduleInvalidOperationException(const StdString& message) noexcept
 {
     V8_SPLIT_PROXY_MANAGED_INVOKE_VOID(ScheduleInvalidOperationException, message);
@@ -153,8 +340,24 @@ void V8Value::Decode(Decoded& decoded) const
     }
     else if (m_Type == Type::String)
     {
-        decoded.pStringData = m_Data.pString->ToCString();
-        decoded.Length = static_cast<int32_t>(m_Data.pString->GetLength());
+        if (IsStringView())
+        {
+            decoded.pOneByteStringData = static_cast<const uint8_t*>(m_Data.pStringBuffer->GetData());
+            decoded.Length = static_cast<int32_t>(m_Data.pStringBuffer->GetLength());
+            decoded.Flags = m_Data.pStringBuffer->IsOneByte() ? Flags::OneByte : Flags::None;
+        }
+        else if (m_Data.pString->IsOneByte())
+        {
+            decoded.pOneByteStringData = m_Data.pString->ToOneByteCString();
+            decoded.Length = static_cast<int32_t>(m_Data.pString->GetLength());
+            decoded.Flags = Flags::OneByte;
+        }
+        else
+        {
+            decoded.pStringData = m_Data.pString->ToCString();
+            decoded.Length = static_cast<int32_t>(m_Data.pString->GetLength());
+            decoded.Flags = Flags::None;
+        }
     }
     else if (m_Type == Type::DateTime)
     {
@@ -178,6 +381,7 @@ void V8Value::Decode(Decoded& decoded) const
         decoded.pvHostObject = m_Data.pHostObjectHolder->GetObject();
         decoded.Subtype = m_Subtype;
         decoded.Flags = m_Flags;
+        decoded.IdentityHash = m_Data.pHostObjectHolder->GetIdentity();
     }
 }
 
@@ -226,7 +430,9 @@ void V8Value::InitializeFromFastResult(const FastResult& result)
     {
         m_Subtype = result.Subtype;
         m_Flags = result.Flags;
-        m_Data.pHostObjectHolder = new HostObjectHolderImpl(result.pvHostObject, ::ToUnderlyingType(m_Subtype), ::ToUnderlyingType(m_Flags));
+        // the wire format has no room for a type ID
+
+        m_Data.pHostObjectHolder = new HostObjectHolderImpl(result.pvHostObject, result.IdentityHash, HostObjectHolder::UnknownTypeId, ::ToUnderlyingType(m_Subtype), ::ToUnderlyingType(m_Flags));
     }
 }
 
@@ -234,388 +440,480 @@ void V8Value::InitializeFromFastResult(const FastResult& result)
 // V8 split proxy native entry points implementation
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void**) V8SplitProxyManaged_SetMethodTable(void** pMethodTable) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void**, V8SplitProxyManaged_SetMethodTable, void** pMethodTable)
+
     return V8SplitProxyManaged::SetMethodTable(pMethodTable);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(const StdChar*) V8SplitProxyNative_GetVersion() noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(const StdChar*, V8SplitProxyNative_GetVersion)
+
     return SL(CLEARSCRIPT_VERSION_STRING_INFORMATIONAL);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void*) Memory_Allocate(size_t size) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void*, Memory_Allocate, size_t size)
+
     return ::malloc(size);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void*) Memory_AllocateZeroed(size_t size) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void*, Memory_AllocateZeroed, size_t size)
+
     return ::calloc(1, size);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) Memory_Free(const void* pMemory) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, Memory_Free, const void* pMemory)
+
     ::free(const_cast<void*>(pMemory));
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Environment_InitializeICU(const char* pICUData, uint32_t size) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void*, Memory_AllocateTransient, size_t size)
+
+    auto pIsolate = v8::Isolate::TryGetCurrent();
+    if (pIsolate != nullptr)
+    {
+        auto pvBlock = V8IsolateImpl::GetInstanceFromIsolate(pIsolate)->AllocateTransient(size);
+        if (pvBlock != nullptr)
+        {
+            return ::memset(pvBlock, 0, size);
+        }
+    }
+
+    return Arena::AllocateUnowned(size);
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, Memory_FreeTransient, const void* pMemory)
+
+    // an arena block must go back to its isolate under the same lock that allocated it
+
+    if (Arena::GetOwner(pMemory) != nullptr)
+    {
+        auto pIsolate = v8::Isolate::TryGetCurrent();
+        _ASSERTE(pIsolate != nullptr);
+        V8IsolateImpl::GetInstanceFromIsolate(pIsolate)->FreeTransient(pMemory);
+    }
+    else
+    {
+        Arena::Free(pMemory);
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Environment_InitializeICU, const char* pICUData, uint32_t size)
+
     ASSERT_EVAL(v8::V8::InitializeICU(pICUData, size));
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(StdString*) StdString_New(const StdChar* pValue, int32_t length) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(StdString*, StdString_New, const StdChar* pValue, int32_t length)
+
     return new StdString(pValue, length);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(const StdChar*) StdString_GetValue(const StdString& string, int32_t& length) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(const void*, StdString_GetValue, const StdString& string, int32_t& length, StdBool& isOneByte)
+
     length = string.GetLength();
-    return string.ToCString();
-}
+    isOneByte = string.IsOneByte();
+    return isOneByte ? static_cast<const void*>(string.ToOneByteCString()) : static_cast<const void*>(string.ToCString());
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdString_SetValue(StdString& string, const StdChar* pValue, int32_t length) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdString_SetValue, StdString& string, const StdChar* pValue, int32_t length)
+
     string = StdString(pValue, length);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdString_Delete(StdString* pString) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdString_Delete, StdString* pString)
+
     delete pString;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(std::vector<StdString>*) StdStringArray_New(int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(std::vector<StdString>*, StdStringArray_New, int32_t elementCount)
+
     return new std::vector<StdString>(elementCount);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(int32_t) StdStringArray_GetElementCount(const std::vector<StdString>& stringArray) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(int32_t, StdStringArray_GetElementCount, const std::vector<StdString>& stringArray)
+
     return static_cast<int32_t>(stringArray.size());
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdStringArray_SetElementCount(std::vector<StdString>& stringArray, int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdStringArray_SetElementCount, std::vector<StdString>& stringArray, int32_t elementCount)
+
     stringArray.resize(elementCount);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(const StdChar*) StdStringArray_GetElement(const std::vector<StdString>& stringArray, int32_t index, int32_t& length) noexcept
-{
-    return StdString_GetValue(stringArray[index], length);
-}
+BEGIN_NATIVE_ENTRY_POINT(const void*, StdStringArray_GetElement, const std::vector<StdString>& stringArray, int32_t index, int32_t& length, StdBool& isOneByte)
+
+    return StdString_GetValue(stringArray[index], length, isOneByte);
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdStringArray_SetElement(std::vector<StdString>& stringArray, int32_t index, const StdChar* pValue, int32_t length) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdStringArray_SetElement, std::vector<StdString>& stringArray, int32_t index, const StdChar* pValue, int32_t length)
+
     stringArray[index] = StdString(pValue, length);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdStringArray_Delete(std::vector<StdString>* pStringArray) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdStringArray_Delete, std::vector<StdString>* pStringArray)
+
     delete pStringArray;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(std::vector<uint8_t>*) StdByteArray_New(int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(std::vector<uint8_t>*, StdByteArray_New, int32_t elementCount)
+
     return new std::vector<uint8_t>(elementCount);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(int32_t) StdByteArray_GetElementCount(const std::vector<uint8_t>& byteArray) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(int32_t, StdByteArray_GetElementCount, const std::vector<uint8_t>& byteArray)
+
     return static_cast<int32_t>(byteArray.size());
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdByteArray_SetElementCount(std::vector<uint8_t>& byteArray, int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdByteArray_SetElementCount, std::vector<uint8_t>& byteArray, int32_t elementCount)
+
     byteArray.resize(elementCount);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(uint8_t*) StdByteArray_GetData(std::vector<uint8_t>& byteArray) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(uint8_t*, StdByteArray_GetData, std::vector<uint8_t>& byteArray)
+
     return byteArray.data();
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdByteArray_Delete(std::vector<uint8_t>* pByteArray) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdByteArray_Delete, std::vector<uint8_t>* pByteArray)
+
     delete pByteArray;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(std::vector<int32_t>*) StdInt32Array_New(int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(std::vector<int32_t>*, StdInt32Array_New, int32_t elementCount)
+
     return new std::vector<int32_t>(elementCount);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(int32_t) StdInt32Array_GetElementCount(const std::vector<int32_t>& int32Array) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(int32_t, StdInt32Array_GetElementCount, const std::vector<int32_t>& int32Array)
+
     return static_cast<int32_t>(int32Array.size());
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdInt32Array_SetElementCount(std::vector<int32_t>& int32Array, int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdInt32Array_SetElementCount, std::vector<int32_t>& int32Array, int32_t elementCount)
+
     int32Array.resize(elementCount);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(int32_t*) StdInt32Array_GetData(std::vector<int32_t>& int32Array) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(int32_t*, StdInt32Array_GetData, std::vector<int32_t>& int32Array)
+
     return int32Array.data();
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdInt32Array_Delete(std::vector<int32_t>* pInt32Array) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdInt32Array_Delete, std::vector<int32_t>* pInt32Array)
+
     delete pInt32Array;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(std::vector<uint32_t>*) StdUInt32Array_New(int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(std::vector<uint32_t>*, StdUInt32Array_New, int32_t elementCount)
+
     return new std::vector<uint32_t>(elementCount);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(int32_t) StdUInt32Array_GetElementCount(const std::vector<uint32_t>& uint32Array) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(int32_t, StdUInt32Array_GetElementCount, const std::vector<uint32_t>& uint32Array)
+
     return static_cast<int32_t>(uint32Array.size());
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdUInt32Array_SetElementCount(std::vector<uint32_t>& uint32Array, int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdUInt32Array_SetElementCount, std::vector<uint32_t>& uint32Array, int32_t elementCount)
+
     uint32Array.resize(elementCount);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(uint32_t*) StdUInt32Array_GetData(std::vector<uint32_t>& uint32Array) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(uint32_t*, StdUInt32Array_GetData, std::vector<uint32_t>& uint32Array)
+
     return uint32Array.data();
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdUInt32Array_Delete(std::vector<uint32_t>* pUInt32Array) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdUInt32Array_Delete, std::vector<uint32_t>* pUInt32Array)
+
     delete pUInt32Array;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(std::vector<uint64_t>*) StdUInt64Array_New(int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(std::vector<uint64_t>*, StdUInt64Array_New, int32_t elementCount)
+
     return new std::vector<uint64_t>(elementCount);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(int32_t) StdUInt64Array_GetElementCount(const std::vector<uint64_t>& uint64Array) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(int32_t, StdUInt64Array_GetElementCount, const std::vector<uint64_t>& uint64Array)
+
     return static_cast<int32_t>(uint64Array.size());
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdUInt64Array_SetElementCount(std::vector<uint64_t>& uint64Array, int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdUInt64Array_SetElementCount, std::vector<uint64_t>& uint64Array, int32_t elementCount)
+
     uint64Array.resize(elementCount);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(uint64_t*) StdUInt64Array_GetData(std::vector<uint64_t>& uint64Array) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(uint64_t*, StdUInt64Array_GetData, std::vector<uint64_t>& uint64Array)
+
     return uint64Array.data();
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
 
-NATIVE_ENTRY_POINT(void) StdUInt64Array_Delete(std::vector<uint64_t>* pUInt64Array) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdUInt64Array_Delete, std::vector<uint64_t>* pUInt64Array)
+
     delete pUInt64Array;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(std::vector<void*>*) StdPtrArray_New(int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(std::vector<void*>*, StdPtrArray_New, int32_t elementCount)
+
     return new std::vector<void*>(elementCount);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(int32_t) StdPtrArray_GetElementCount(const std::vector<void*>& ptrArray) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(int32_t, StdPtrArray_GetElementCount, const std::vector<void*>& ptrArray)
+
     return static_cast<int32_t>(ptrArray.size());
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdPtrArray_SetElementCount(std::vector<void*>& ptrArray, int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdPtrArray_SetElementCount, std::vector<void*>& ptrArray, int32_t elementCount)
+
     ptrArray.resize(elementCount);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void**) StdPtrArray_GetData(std::vector<void*>& ptrArray) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void**, StdPtrArray_GetData, std::vector<void*>& ptrArray)
+
     return ptrArray.data();
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdPtrArray_Delete(std::vector<void*>* pPtrArray) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdPtrArray_Delete, std::vector<void*>* pPtrArray)
+
     delete pPtrArray;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(std::vector<V8Value>*) StdV8ValueArray_New(int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(std::vector<V8Value>*, StdV8ValueArray_New, int32_t elementCount)
+
     return new std::vector<V8Value>(elementCount, V8Value(V8Value::Nonexistent));
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(int32_t) StdV8ValueArray_GetElementCount(const std::vector<V8Value>& v8ValueArray) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(int32_t, StdV8ValueArray_GetElementCount, const std::vector<V8Value>& v8ValueArray)
+
     return static_cast<int32_t>(v8ValueArray.size());
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdV8ValueArray_SetElementCount(std::vector<V8Value>& v8ValueArray, int32_t elementCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdV8ValueArray_SetElementCount, std::vector<V8Value>& v8ValueArray, int32_t elementCount)
+
     v8ValueArray.resize(elementCount, V8Value(V8Value::Nonexistent));
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8Value*) StdV8ValueArray_GetData(std::vector<V8Value>& v8ValueArray) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8Value*, StdV8ValueArray_GetData, std::vector<V8Value>& v8ValueArray)
+
     return v8ValueArray.data();
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) StdV8ValueArray_Delete(std::vector<V8Value>* pV8ValueArray) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, StdV8ValueArray_Delete, std::vector<V8Value>* pV8ValueArray)
+
     delete pV8ValueArray;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8Value*) V8Value_New() noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8Value*, V8Value_New)
+
     return new V8Value(V8Value::Nonexistent);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Value_SetNonexistent(V8Value* pV8Value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Value_SetNonexistent, V8Value* pV8Value)
+
     *pV8Value = V8Value(V8Value::Nonexistent);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Value_SetUndefined(V8Value* pV8Value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Value_SetUndefined, V8Value* pV8Value)
+
     *pV8Value = V8Value(V8Value::Undefined);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Value_SetNull(V8Value* pV8Value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Value_SetNull, V8Value* pV8Value)
+
     *pV8Value = V8Value(V8Value::Null);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Value_SetBoolean(V8Value* pV8Value, StdBool value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Value_SetBoolean, V8Value* pV8Value, StdBool value)
+
     *pV8Value = V8Value(value != 0);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Value_SetNumber(V8Value* pV8Value, double value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Value_SetNumber, V8Value* pV8Value, double value)
+
     *pV8Value = V8Value(value);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Value_SetString(V8Value* pV8Value, const StdChar* pValue, int32_t length) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Value_SetString, V8Value* pV8Value, const StdChar* pValue, int32_t length)
+
     *pV8Value = V8Value(new StdString(pValue, length));
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Value_SetDateTime(V8Value* pV8Value, double value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Value_SetDateTime, V8Value* pV8Value, double value)
+
     *pV8Value = V8Value(V8Value::DateTime, value);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Value_SetBigInt(V8Value* pV8Value, int32_t signBit, const uint8_t* pBytes, int32_t length) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Value_SetBigInt, V8Value* pV8Value, int32_t signBit, const uint8_t* pBytes, int32_t length)
+
     std::vector<uint64_t> words;
     if (length > 0)
     {
@@ -624,55 +922,61 @@ NATIVE_ENTRY_POINT(void) V8Value_SetBigInt(V8Value* pV8Value, int32_t signBit, c
     }
 
     *pV8Value = V8Value(new V8BigInt(signBit, std::move(words)));
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Value_SetV8Object(V8Value* pV8Value, const V8ObjectHandle& handle, V8Value::Subtype subtype, V8Value::Flags flags) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Value_SetV8Object, V8Value* pV8Value, const V8ObjectHandle& handle, V8Value::Subtype subtype, V8Value::Flags flags)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
         *pV8Value = V8Value(spV8ObjectHolder->Clone(), subtype, flags);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Value_SetHostObject(V8Value* pV8Value, void* pvObject, V8Value::Subtype subtype, V8Value::Flags flags) noexcept
-{
-    *pV8Value = V8Value(new HostObjectHolderImpl(pvObject, ::ToUnderlyingType(subtype), ::ToUnderlyingType(flags)));
-}
+BEGIN_NATIVE_ENTRY_POINT(void, V8Value_SetHostObject, V8Value* pV8Value, void* pvObject, int32_t identity, int32_t typeId, V8Value::Subtype subtype, V8Value::Flags flags)
+
+    *pV8Value = V8Value(new HostObjectHolderImpl(pvObject, identity, typeId, ::ToUnderlyingType(subtype), ::ToUnderlyingType(flags)));
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Value_Decode(const V8Value& value, V8Value::Decoded& decoded) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Value_Decode, const V8Value& value, V8Value::Decoded& decoded)
+
     value.Decode(decoded);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Value_Delete(V8Value* pV8Value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Value_Delete, V8Value* pV8Value)
+
     delete pV8Value;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8CpuProfile_GetInfo(const v8::CpuProfile& profile, const V8EntityHandleBase& entityHandle, StdString& name, uint64_t& startTimestamp, uint64_t& endTimestamp, int32_t& sampleCount, const v8::CpuProfileNode*& pRootNode) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8CpuProfile_GetInfo, const v8::CpuProfile& profile, const V8EntityHandleBase& entityHandle, StdString& name, uint64_t& startTimestamp, uint64_t& endTimestamp, int32_t& sampleCount, const v8::CpuProfileNode*& pRootNode)
+
     name = entityHandle.CreateStdString(profile.GetTitle());
     startTimestamp = profile.GetStartTime();
     endTimestamp = profile.GetEndTime();
     sampleCount = profile.GetSamplesCount();
     pRootNode = profile.GetTopDownRoot();
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(StdBool) V8CpuProfile_GetSample(const v8::CpuProfile& profile, int32_t index, uint64_t& nodeId, uint64_t& timestamp) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(StdBool, V8CpuProfile_GetSample, const v8::CpuProfile& profile, int32_t index, uint64_t& nodeId, uint64_t& timestamp)
+
     auto pNode = profile.GetSample(index);
     if (pNode != nullptr)
     {
@@ -682,12 +986,13 @@ NATIVE_ENTRY_POINT(StdBool) V8CpuProfile_GetSample(const v8::CpuProfile& profile
     }
 
     return false;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8CpuProfileNode_GetInfo(const v8::CpuProfileNode& node, const V8EntityHandleBase& entityHandle, uint64_t& nodeId, int64_t& scriptId, StdString& scriptName, StdString& functionName, StdString& bailoutReason, int64_t& lineNumber, int64_t& columnNumber, uint64_t& hitCount, uint32_t& hitLineCount, int32_t& childCount)
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8CpuProfileNode_GetInfo, const v8::CpuProfileNode& node, const V8EntityHandleBase& entityHandle, uint64_t& nodeId, int64_t& scriptId, StdString& scriptName, StdString& functionName, StdString& bailoutReason, int64_t& lineNumber, int64_t& columnNumber, uint64_t& hitCount, uint32_t& hitLineCount, int32_t& childCount)
+
     nodeId = node.GetNodeId();
     scriptId = node.GetScriptId();
     scriptName = entityHandle.CreateStdString(node.GetScriptResourceName());
@@ -698,12 +1003,13 @@ NATIVE_ENTRY_POINT(void) V8CpuProfileNode_GetInfo(const v8::CpuProfileNode& node
     hitCount = node.GetHitCount();
     hitLineCount = node.GetHitLineCount();
     childCount = node.GetChildrenCount();
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(StdBool) V8CpuProfileNode_GetHitLines(const v8::CpuProfileNode& node, std::vector<int32_t>& lineNumbers, std::vector<uint32_t>& hitCounts) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(StdBool, V8CpuProfileNode_GetHitLines, const v8::CpuProfileNode& node, std::vector<int32_t>& lineNumbers, std::vector<uint32_t>& hitCounts)
+
     auto hitLineCount = node.GetHitLineCount();
     if (hitLineCount > 0)
     {
@@ -724,19 +1030,21 @@ NATIVE_ENTRY_POINT(StdBool) V8CpuProfileNode_GetHitLines(const v8::CpuProfileNod
     }
 
     return false;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(const v8::CpuProfileNode*) V8CpuProfileNode_GetChildNode(const v8::CpuProfileNode& node, int32_t index) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(const v8::CpuProfileNode*, V8CpuProfileNode_GetChildNode, const v8::CpuProfileNode& node, int32_t index)
+
     return node.GetChild(index);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8IsolateHandle*) V8Isolate_Create(const StdString& name, int32_t maxNewSpaceSize, int32_t maxOldSpaceSize, double heapExpansionMultiplier, uint64_t maxArrayBufferAllocation, V8Isolate::Flags flags, int32_t debugPort) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8IsolateHandle*, V8Isolate_Create, const StdString& name, int32_t maxNewSpaceSize, int32_t maxOldSpaceSize, double heapExpansionMultiplier, uint64_t maxArrayBufferAllocation, V8Isolate::Flags flags, int32_t debugPort)
+
     v8::ResourceConstraints* pConstraints = nullptr;
 
     v8::ResourceConstraints constraints;
@@ -766,12 +1074,13 @@ NATIVE_ENTRY_POINT(V8IsolateHandle*) V8Isolate_Create(const StdString& name, int
         exception.ScheduleScriptEngineException();
         return nullptr;
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8ContextHandle*) V8Isolate_CreateContext(const V8IsolateHandle& handle, const StdString& name, V8Context::Flags flags, int32_t debugPort) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8ContextHandle*, V8Isolate_CreateContext, const V8IsolateHandle& handle, const StdString& name, V8Context::Flags flags, int32_t debugPort)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
@@ -790,69 +1099,97 @@ NATIVE_ENTRY_POINT(V8ContextHandle*) V8Isolate_CreateContext(const V8IsolateHand
     }
 
     return nullptr;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(size_t) V8Isolate_GetMaxHeapSize(const V8IsolateHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(size_t, V8Isolate_GetMaxHeapSize, const V8IsolateHandle& handle)
+
     auto spIsolate = handle.GetEntity();
     return !spIsolate.IsEmpty() ? spIsolate->GetMaxHeapSize() : 0;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_SetMaxHeapSize(const V8IsolateHandle& handle, size_t size) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_SetMaxHeapSize, const V8IsolateHandle& handle, size_t size)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
         spIsolate->SetMaxHeapSize(size);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(double) V8Isolate_GetHeapSizeSampleInterval(const V8IsolateHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(double, V8Isolate_GetHeapSizeSampleInterval, const V8IsolateHandle& handle)
+
     auto spIsolate = handle.GetEntity();
     return !spIsolate.IsEmpty() ? spIsolate->GetHeapSizeSampleInterval() : 0.0;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_SetHeapSizeSampleInterval(const V8IsolateHandle& handle, double milliseconds) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_SetHeapSizeSampleInterval, const V8IsolateHandle& handle, double milliseconds)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
         spIsolate->SetHeapSizeSampleInterval(milliseconds);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(size_t) V8Isolate_GetMaxStackUsage(const V8IsolateHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(size_t, V8Isolate_GetMaxStackUsage, const V8IsolateHandle& handle)
+
     auto spIsolate = handle.GetEntity();
     return !spIsolate.IsEmpty() ? spIsolate->GetMaxStackUsage() : 0;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_SetMaxStackUsage(const V8IsolateHandle& handle, size_t size) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_SetMaxStackUsage, const V8IsolateHandle& handle, size_t size)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
         spIsolate->SetMaxStackUsage(size);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_AwaitDebuggerAndPause(const V8IsolateHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(size_t, V8Isolate_GetMaxStringCacheSize, const V8IsolateHandle& handle)
+
+    auto spIsolate = handle.GetEntity();
+    return !spIsolate.IsEmpty() ? spIsolate->GetMaxStringCacheSize() : 0;
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_SetMaxStringCacheSize, const V8IsolateHandle& handle, size_t size)
+
+    auto spIsolate = handle.GetEntity();
+    if (!spIsolate.IsEmpty())
+    {
+        spIsolate->SetMaxStringCacheSize(size);
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_AwaitDebuggerAndPause, const V8IsolateHandle& handle)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
@@ -865,23 +1202,25 @@ NATIVE_ENTRY_POINT(void) V8Isolate_AwaitDebuggerAndPause(const V8IsolateHandle&
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_CancelAwaitDebugger(const V8IsolateHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_CancelAwaitDebugger, const V8IsolateHandle& handle)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
         spIsolate->CancelAwaitDebugger();
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Isolate_Compile(const V8IsolateHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8ScriptHandle*, V8Isolate_Compile, const V8IsolateHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code)
+
     V8DocumentInfo documentInfo(std::move(resourceName), std::move(sourceMapUrl), uniqueId, documentKind, pvDocumentInfo);
 
     auto spIsolate = handle.GetEntity();
@@ -898,12 +1237,13 @@ NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Isolate_Compile(const V8IsolateHandle& han
     }
 
     return nullptr;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Isolate_CompileProducingCache(const V8IsolateHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, std::vector<uint8_t>& cacheBytes) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8ScriptHandle*, V8Isolate_CompileProducingCache, const V8IsolateHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, std::vector<uint8_t>& cacheBytes)
+
     cacheBytes.clear();
 
     if (cacheKind == V8CacheKind::None)
@@ -927,12 +1267,13 @@ NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Isolate_CompileProducingCache(const V8Isol
     }
 
     return nullptr;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Isolate_CompileConsumingCache(const V8IsolateHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, const std::vector<uint8_t>& cacheBytes, StdBool& cacheAccepted) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8ScriptHandle*, V8Isolate_CompileConsumingCache, const V8IsolateHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, const std::vector<uint8_t>& cacheBytes, StdBool& cacheAccepted)
+
     cacheAccepted = false;
 
     if ((cacheKind == V8CacheKind::None) || cacheBytes.empty())
@@ -960,12 +1301,13 @@ NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Isolate_CompileConsumingCache(const V8Isol
     }
 
     return nullptr;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Isolate_CompileUpdatingCache(const V8IsolateHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, std::vector<uint8_t>& cacheBytes, V8CacheResult& cacheResult) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8ScriptHandle*, V8Isolate_CompileUpdatingCache, const V8IsolateHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, std::vector<uint8_t>& cacheBytes, V8CacheResult& cacheResult)
+
     if (cacheKind == V8CacheKind::None)
     {
         cacheResult = V8CacheResult::Disabled;
@@ -995,50 +1337,55 @@ NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Isolate_CompileUpdatingCache(const V8Isola
     }
 
     return nullptr;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(StdBool) V8Isolate_GetEnableInterruptPropagation(const V8IsolateHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(StdBool, V8Isolate_GetEnableInterruptPropagation, const V8IsolateHandle& handle)
+
     auto spIsolate = handle.GetEntity();
     return !spIsolate.IsEmpty() ? spIsolate->GetEnableInterruptPropagation() : false;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_SetEnableInterruptPropagation(const V8IsolateHandle& handle, StdBool value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_SetEnableInterruptPropagation, const V8IsolateHandle& handle, StdBool value)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
         spIsolate->SetEnableInterruptPropagation(value);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(StdBool) V8Isolate_GetDisableHeapSizeViolationInterrupt(const V8IsolateHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(StdBool, V8Isolate_GetDisableHeapSizeViolationInterrupt, const V8IsolateHandle& handle)
+
     auto spIsolate = handle.GetEntity();
     return !spIsolate.IsEmpty() ? spIsolate->GetDisableHeapSizeViolationInterrupt() : false;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_SetDisableHeapSizeViolationInterrupt(const V8IsolateHandle& handle, StdBool value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_SetDisableHeapSizeViolationInterrupt, const V8IsolateHandle& handle, StdBool value)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
         spIsolate->SetDisableHeapSizeViolationInterrupt(value);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_GetHeapStatistics(const V8IsolateHandle& handle, uint64_t& totalHeapSize, uint64_t& totalHeapSizeExecutable, uint64_t& totalPhysicalSize, uint64_t& totalAvailableSize, uint64_t& usedHeapSize, uint64_t& heapSizeLimit, uint64_t& totalExternalSize) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_GetHeapStatistics, const V8IsolateHandle& handle, uint64_t& totalHeapSize, uint64_t& totalHeapSizeExecutable, uint64_t& totalPhysicalSize, uint64_t& totalAvailableSize, uint64_t& usedHeapSize, uint64_t& heapSizeLimit, uint64_t& totalExternalSize)
+
     totalHeapSize = 0UL;
     totalHeapSizeExecutable = 0UL;
     totalPhysicalSize = 0UL;
@@ -1061,15 +1408,18 @@ NATIVE_ENTRY_POINT(void) V8Isolate_GetHeapStatistics(const V8IsolateHandle& hand
         heapSizeLimit = statistics.heap_size_limit();
         totalExternalSize = statistics.external_memory();
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_GetStatistics(const V8IsolateHandle& handle, uint64_t& scriptCount, uint64_t& scriptCacheSize, uint64_t& moduleCount, std::vector<uint64_t>& postedTaskCounts, std::vector<uint64_t>& invokedTaskCounts) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_GetStatistics, const V8IsolateHandle& handle, uint64_t& scriptCount, uint64_t& scriptCacheSize, uint64_t& moduleCount, uint64_t& stringCacheHitCount, uint64_t& stringCacheMissCount, std::vector<uint64_t>& postedTaskCounts, std::vector<uint64_t>& invokedTaskCounts)
+
     scriptCount = 0UL;
     scriptCacheSize = 0UL;
     moduleCount = 0UL;
+    stringCacheHitCount = 0UL;
+    stringCacheMissCount = 0UL;
     postedTaskCounts.clear();
     invokedTaskCounts.clear();
 
@@ -1081,6 +1431,8 @@ NATIVE_ENTRY_POINT(void) V8Isolate_GetStatistics(const V8IsolateHandle& handle,
         scriptCount = statistics.ScriptCount;
         scriptCacheSize = statistics.ScriptCacheSize;
         moduleCount = statistics.ModuleCount;
+        stringCacheHitCount = statistics.StringCacheHitCount;
+        stringCacheMissCount = statistics.StringCacheMissCount;
 
         auto count = statistics.PostedTaskCounts.size();
         postedTaskCounts.reserve(count);
@@ -1090,140 +1442,175 @@ NATIVE_ENTRY_POINT(void) V8Isolate_GetStatistics(const V8IsolateHandle& handle,
         invokedTaskCounts.reserve(count);
         std::copy(statistics.InvokedTaskCounts.cbegin(), statistics.InvokedTaskCounts.cend(), std::back_inserter(invokedTaskCounts));
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_CollectGarbage(const V8IsolateHandle& handle, StdBool exhaustive) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_CollectGarbage, const V8IsolateHandle& handle, StdBool exhaustive)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
         spIsolate->CollectGarbage(exhaustive);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(StdBool) V8Isolate_BeginCpuProfile(const V8IsolateHandle& handle, const StdString& name, StdBool recordSamples) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(StdBool, V8Isolate_BeginCpuProfile, const V8IsolateHandle& handle, const StdString& name, StdBool recordSamples)
+
     auto spIsolate = handle.GetEntity();
     return !spIsolate.IsEmpty() && spIsolate->BeginCpuProfile(name, v8::kLeafNodeLineNumbers, recordSamples);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_EndCpuProfile(const V8IsolateHandle& handle, const StdString& name, void* pvAction) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_EndCpuProfile, const V8IsolateHandle& handle, const StdString& name, void* pvAction)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
         spIsolate->EndCpuProfile(name, ProcessCpuProfile, pvAction);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_CollectCpuProfileSample(const V8IsolateHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_CollectCpuProfileSample, const V8IsolateHandle& handle)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
         spIsolate->CollectCpuProfileSample();
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(uint32_t) V8Isolate_GetCpuProfileSampleInterval(const V8IsolateHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(uint32_t, V8Isolate_GetCpuProfileSampleInterval, const V8IsolateHandle& handle)
+
     auto spIsolate = handle.GetEntity();
     return !spIsolate.IsEmpty() ? spIsolate->GetCpuProfileSampleInterval() : 0;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_SetCpuProfileSampleInterval(const V8IsolateHandle& handle, uint32_t value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_SetCpuProfileSampleInterval, const V8IsolateHandle& handle, uint32_t value)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
         spIsolate->SetCpuProfileSampleInterval(value);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Isolate_WriteHeapSnapshot(const V8IsolateHandle& handle, void* pvStream) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Isolate_WriteHeapSnapshot, const V8IsolateHandle& handle, void* pvStream)
+
     auto spIsolate = handle.GetEntity();
     if (!spIsolate.IsEmpty())
     {
         spIsolate->WriteHeapSnapshot(pvStream);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(size_t) V8Context_GetMaxIsolateHeapSize(const V8ContextHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(size_t, V8Context_GetMaxIsolateHeapSize, const V8ContextHandle& handle)
+
     auto spContext = handle.GetEntity();
     return !spContext.IsEmpty() ? spContext->GetMaxIsolateHeapSize() : 0;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_SetMaxIsolateHeapSize(const V8ContextHandle& handle, size_t size) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_SetMaxIsolateHeapSize, const V8ContextHandle& handle, size_t size)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->SetMaxIsolateHeapSize(size);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(double) V8Context_GetIsolateHeapSizeSampleInterval(const V8ContextHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(double, V8Context_GetIsolateHeapSizeSampleInterval, const V8ContextHandle& handle)
+
     auto spContext = handle.GetEntity();
     return !spContext.IsEmpty() ? spContext->GetIsolateHeapSizeSampleInterval() : 0.0;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_SetIsolateHeapSizeSampleInterval(const V8ContextHandle& handle, double milliseconds) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_SetIsolateHeapSizeSampleInterval, const V8ContextHandle& handle, double milliseconds)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->SetIsolateHeapSizeSampleInterval(milliseconds);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(size_t) V8Context_GetMaxIsolateStackUsage(const V8ContextHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(size_t, V8Context_GetMaxIsolateStackUsage, const V8ContextHandle& handle)
+
     auto spContext = handle.GetEntity();
     return !spContext.IsEmpty() ? spContext->GetMaxIsolateStackUsage() : 0;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_SetMaxIsolateStackUsage(const V8ContextHandle& handle, size_t size) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_SetMaxIsolateStackUsage, const V8ContextHandle& handle, size_t size)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->SetMaxIsolateStackUsage(size);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_InvokeWithLock(const V8ContextHandle& handle, void* pvAction) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(size_t, V8Context_GetMaxIsolateStringCacheSize, const V8ContextHandle& handle)
+
+    auto spContext = handle.GetEntity();
+    return !spContext.IsEmpty() ? spContext->GetMaxIsolateStringCacheSize() : 0;
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_SetMaxIsolateStringCacheSize, const V8ContextHandle& handle, size_t size)
+
+    auto spContext = handle.GetEntity();
+    if (!spContext.IsEmpty())
+    {
+        spContext->SetMaxIsolateStringCacheSize(size);
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_InvokeWithLock, const V8ContextHandle& handle, void* pvAction)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
@@ -1236,12 +1623,13 @@ NATIVE_ENTRY_POINT(void) V8Context_InvokeWithLock(const V8ContextHandle& handle,
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_InvokeWithLockWithArg(const V8ContextHandle& handle, void* pvAction, void* pvArg) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_InvokeWithLockWithArg, const V8ContextHandle& handle, void* pvAction, void* pvArg)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
@@ -1254,12 +1642,13 @@ NATIVE_ENTRY_POINT(void) V8Context_InvokeWithLockWithArg(const V8ContextHandle&
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_GetRootItem(const V8ContextHandle& handle, V8Value& item) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_GetRootItem, const V8ContextHandle& handle, V8Value& item)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
@@ -1272,12 +1661,13 @@ NATIVE_ENTRY_POINT(void) V8Context_GetRootItem(const V8ContextHandle& handle, V8
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_AddGlobalItem(const V8ContextHandle& handle, const StdString& name, const V8Value& value, StdBool globalMembers) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_AddGlobalItem, const V8ContextHandle& handle, const StdString& name, const V8Value& value, StdBool globalMembers)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
@@ -1290,12 +1680,127 @@ NATIVE_ENTRY_POINT(void) V8Context_AddGlobalItem(const V8ContextHandle& handle,
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_AwaitDebuggerAndPause(const V8ContextHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_CreateArray, const V8ContextHandle& handle, const std::vector<V8Value>& values, V8Value& array)
+
+    auto spContext = handle.GetEntity();
+    if (!spContext.IsEmpty())
+    {
+        try
+        {
+            array = spContext->CreateV8Array(values);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_CreateObject, const V8ContextHandle& handle, const std::vector<StdString>& names, const std::vector<V8Value>& values, V8Value& obj)
+
+    auto spContext = handle.GetEntity();
+    if (!spContext.IsEmpty())
+    {
+        try
+        {
+            obj = spContext->CreateV8Object(names, values);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_Deserialize, const V8ContextHandle& handle, const std::vector<uint8_t>& data, const std::vector<V8Value>& sharedObjects, V8Value& value)
+
+    auto spContext = handle.GetEntity();
+    if (!spContext.IsEmpty())
+    {
+        try
+        {
+            value = spContext->DeserializeValue(data, sharedObjects);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_ParseJson, const V8ContextHandle& handle, const StdString& json, V8Value& value)
+
+    auto spContext = handle.GetEntity();
+    if (!spContext.IsEmpty())
+    {
+        try
+        {
+            value = spContext->ParseJson(json);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_ParseJsonUtf8, const V8ContextHandle& handle, const char* pJson, int32_t length, V8Value& value)
+
+    auto spContext = handle.GetEntity();
+    if (!spContext.IsEmpty())
+    {
+        try
+        {
+            value = spContext->ParseJson(pJson, length);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_CreateFastFunction, const V8ContextHandle& handle, void* pvFunction, FastHostObjectUtil::CallType returnType, const std::vector<int32_t>& argTypes, V8Value& function)
+
+    auto spContext = handle.GetEntity();
+    if (!spContext.IsEmpty())
+    {
+        try
+        {
+            function = spContext->CreateFastFunction(pvFunction, returnType, argTypes);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_AwaitDebuggerAndPause, const V8ContextHandle& handle)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
@@ -1308,23 +1813,25 @@ NATIVE_ENTRY_POINT(void) V8Context_AwaitDebuggerAndPause(const V8ContextHandle&
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_CancelAwaitDebugger(const V8ContextHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_CancelAwaitDebugger, const V8ContextHandle& handle)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->CancelAwaitDebugger();
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_ExecuteCode(const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, const StdString& code, StdBool evaluate, V8Value& result) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_ExecuteCode, const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, const StdString& code, StdBool evaluate, V8Value& result)
+
     V8DocumentInfo documentInfo(std::move(resourceName), std::move(sourceMapUrl), uniqueId, documentKind, pvDocumentInfo);
 
     auto spContext = handle.GetEntity();
@@ -1339,12 +1846,13 @@ NATIVE_ENTRY_POINT(void) V8Context_ExecuteCode(const V8ContextHandle& handle, St
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Context_Compile(const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8ScriptHandle*, V8Context_Compile, const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code)
+
     V8DocumentInfo documentInfo(std::move(resourceName), std::move(sourceMapUrl), uniqueId, documentKind, pvDocumentInfo);
 
     auto spContext = handle.GetEntity();
@@ -1361,12 +1869,13 @@ NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Context_Compile(const V8ContextHandle& han
     }
 
     return nullptr;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Context_CompileProducingCache(const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, std::vector<uint8_t>& cacheBytes) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8ScriptHandle*, V8Context_CompileProducingCache, const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, std::vector<uint8_t>& cacheBytes)
+
     cacheBytes.clear();
 
     if (cacheKind == V8CacheKind::None)
@@ -1390,12 +1899,13 @@ NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Context_CompileProducingCache(const V8Cont
     }
 
     return nullptr;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Context_CompileConsumingCache(const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, const std::vector<uint8_t>& cacheBytes, StdBool& cacheAccepted) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8ScriptHandle*, V8Context_CompileConsumingCache, const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, const std::vector<uint8_t>& cacheBytes, StdBool& cacheAccepted)
+
     cacheAccepted = false;
 
     if ((cacheKind == V8CacheKind::None) || cacheBytes.empty())
@@ -1423,12 +1933,13 @@ NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Context_CompileConsumingCache(const V8Cont
     }
 
     return nullptr;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Context_CompileUpdatingCache(const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, std::vector<uint8_t>& cacheBytes, V8CacheResult& cacheResult) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8ScriptHandle*, V8Context_CompileUpdatingCache, const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, std::vector<uint8_t>& cacheBytes, V8CacheResult& cacheResult)
+
     if (cacheKind == V8CacheKind::None)
     {
         cacheResult = V8CacheResult::Disabled;
@@ -1458,12 +1969,13 @@ NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Context_CompileUpdatingCache(const V8Conte
     }
 
     return nullptr;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_ExecuteScript(const V8ContextHandle& handle, const V8ScriptHandle& scriptHandle, StdBool evaluate, V8Value& result) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_ExecuteScript, const V8ContextHandle& handle, const V8ScriptHandle& scriptHandle, StdBool evaluate, V8Value& result)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
@@ -1480,72 +1992,98 @@ NATIVE_ENTRY_POINT(void) V8Context_ExecuteScript(const V8ContextHandle& handle,
             }
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_Interrupt(const V8ContextHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_ExecuteBatch, const V8ContextHandle& handle, const std::vector<int32_t>& commands, const std::vector<StdString>& names, const std::vector<V8Value>& values, std::vector<V8Value>& results, std::vector<StdString>& errors)
+
+    auto spContext = handle.GetEntity();
+    if (!spContext.IsEmpty())
+    {
+        try
+        {
+            spContext->ExecuteBatch(commands, names, values, results, errors);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_Interrupt, const V8ContextHandle& handle)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->Interrupt();
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_CancelInterrupt(const V8ContextHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_CancelInterrupt, const V8ContextHandle& handle)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->CancelInterrupt();
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(StdBool) V8Context_GetEnableIsolateInterruptPropagation(const V8ContextHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(StdBool, V8Context_GetEnableIsolateInterruptPropagation, const V8ContextHandle& handle)
+
     auto spContext = handle.GetEntity();
     return !spContext.IsEmpty() ? spContext->GetEnableIsolateInterruptPropagation() : false;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_SetEnableIsolateInterruptPropagation(const V8ContextHandle& handle, StdBool value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_SetEnableIsolateInterruptPropagation, const V8ContextHandle& handle, StdBool value)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->SetEnableIsolateInterruptPropagation(value);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(StdBool) V8Context_GetDisableIsolateHeapSizeViolationInterrupt(const V8ContextHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(StdBool, V8Context_GetDisableIsolateHeapSizeViolationInterrupt, const V8ContextHandle& handle)
+
     auto spContext = handle.GetEntity();
     return !spContext.IsEmpty() ? spContext->GetDisableIsolateHeapSizeViolationInterrupt() : false;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_SetDisableIsolateHeapSizeViolationInterrupt(const V8ContextHandle& handle, StdBool value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_SetDisableIsolateHeapSizeViolationInterrupt, const V8ContextHandle& handle, StdBool value)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->SetDisableIsolateHeapSizeViolationInterrupt(value);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_GetIsolateHeapStatistics(const V8ContextHandle& handle, uint64_t& totalHeapSize, uint64_t& totalHeapSizeExecutable, uint64_t& totalPhysicalSize, uint64_t& totalAvailableSize, uint64_t& usedHeapSize, uint64_t& heapSizeLimit, uint64_t& totalExternalSize) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_GetIsolateHeapStatistics, const V8ContextHandle& handle, uint64_t& totalHeapSize, uint64_t& totalHeapSizeExecutable, uint64_t& totalPhysicalSize, uint64_t& totalAvailableSize, uint64_t& usedHeapSize, uint64_t& heapSizeLimit, uint64_t& totalExternalSize)
+
     totalHeapSize = 0UL;
     totalHeapSizeExecutable = 0UL;
     totalPhysicalSize = 0UL;
@@ -1568,15 +2106,18 @@ NATIVE_ENTRY_POINT(void) V8Context_GetIsolateHeapStatistics(const V8ContextHandl
         heapSizeLimit = statistics.heap_size_limit();
         totalExternalSize = statistics.external_memory();
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_GetIsolateStatistics(const V8ContextHandle& handle, uint64_t& scriptCount, uint64_t& scriptCacheSize, uint64_t& moduleCount, std::vector<uint64_t>& postedTaskCounts, std::vector<uint64_t>& invokedTaskCounts) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_GetIsolateStatistics, const V8ContextHandle& handle, uint64_t& scriptCount, uint64_t& scriptCacheSize, uint64_t& moduleCount, uint64_t& stringCacheHitCount, uint64_t& stringCacheMissCount, std::vector<uint64_t>& postedTaskCounts, std::vector<uint64_t>& invokedTaskCounts)
+
     scriptCount = 0UL;
     scriptCacheSize = 0UL;
     moduleCount = 0UL;
+    stringCacheHitCount = 0UL;
+    stringCacheMissCount = 0UL;
     postedTaskCounts.clear();
     invokedTaskCounts.clear();
 
@@ -1588,6 +2129,8 @@ NATIVE_ENTRY_POINT(void) V8Context_GetIsolateStatistics(const V8ContextHandle& h
         scriptCount = statistics.ScriptCount;
         scriptCacheSize = statistics.ScriptCacheSize;
         moduleCount = statistics.ModuleCount;
+        stringCacheHitCount = statistics.StringCacheHitCount;
+        stringCacheMissCount = statistics.StringCacheMissCount;
 
         auto count = statistics.PostedTaskCounts.size();
         postedTaskCounts.reserve(count);
@@ -1597,15 +2140,21 @@ NATIVE_ENTRY_POINT(void) V8Context_GetIsolateStatistics(const V8ContextHandle& h
         invokedTaskCounts.reserve(count);
         std::copy(statistics.InvokedTaskCounts.cbegin(), statistics.InvokedTaskCounts.cend(), std::back_inserter(invokedTaskCounts));
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_GetStatistics(const V8ContextHandle& handle, uint64_t& scriptCount, uint64_t& moduleCount, uint64_t& moduleCacheSize) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_GetStatistics, const V8ContextHandle& handle, uint64_t& scriptCount, uint64_t& moduleCount, uint64_t& moduleCacheSize, uint64_t& propertyNameCacheHitCount, uint64_t& propertyNameCacheMissCount, uint64_t& objectIdentityCacheHitCount, uint64_t& objectIdentityCacheMissCount, uint64_t& fastFunctionCallCount)
+
     scriptCount = 0UL;
     moduleCount = 0UL;
     moduleCacheSize = 0UL;
+    propertyNameCacheHitCount = 0UL;
+    propertyNameCacheMissCount = 0UL;
+    objectIdentityCacheHitCount = 0UL;
+    objectIdentityCacheMissCount = 0UL;
+    fastFunctionCallCount = 0UL;
 
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
@@ -1614,95 +2163,140 @@ NATIVE_ENTRY_POINT(void) V8Context_GetStatistics(const V8ContextHandle& handle,
         scriptCount = statistics.ScriptCount;
         moduleCount = statistics.ModuleCount;
         moduleCacheSize = statistics.ModuleCacheSize;
+        propertyNameCacheHitCount = statistics.PropertyNameCacheHitCount;
+        propertyNameCacheMissCount = statistics.PropertyNameCacheMissCount;
+        objectIdentityCacheHitCount = statistics.ObjectIdentityCacheHitCount;
+        objectIdentityCacheMissCount = statistics.ObjectIdentityCacheMissCount;
+        fastFunctionCallCount = statistics.FastFunctionCallCount;
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_CollectGarbage(const V8ContextHandle& handle, StdBool exhaustive) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_CollectGarbage, const V8ContextHandle& handle, StdBool exhaustive)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->CollectGarbage(exhaustive);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_OnAccessSettingsChanged(const V8ContextHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_OnAccessSettingsChanged, const V8ContextHandle& handle)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->OnAccessSettingsChanged();
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(StdBool) V8Context_BeginCpuProfile(const V8ContextHandle& handle, const StdString& name, StdBool recordSamples) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_OnEnumerationSettingsChanged, const V8ContextHandle& handle)
+
+    auto spContext = handle.GetEntity();
+    if (!spContext.IsEmpty())
+    {
+        spContext->OnEnumerationSettingsChanged();
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_InvalidateHostMemberCache, const V8ContextHandle& handle, const std::vector<StdString>& names)
+
+    auto spContext = handle.GetEntity();
+    if (!spContext.IsEmpty())
+    {
+        try
+        {
+            spContext->InvalidateHostMemberCache(names);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(StdBool, V8Context_BeginCpuProfile, const V8ContextHandle& handle, const StdString& name, StdBool recordSamples)
+
     auto spContext = handle.GetEntity();
     return !spContext.IsEmpty() && spContext->BeginCpuProfile(name, v8::kLeafNodeLineNumbers, recordSamples);
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_EndCpuProfile(const V8ContextHandle& handle, const StdString& name, void* pvAction) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_EndCpuProfile, const V8ContextHandle& handle, const StdString& name, void* pvAction)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->EndCpuProfile(name, ProcessCpuProfile, pvAction);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_CollectCpuProfileSample(const V8ContextHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_CollectCpuProfileSample, const V8ContextHandle& handle)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->CollectCpuProfileSample();
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(uint32_t) V8Context_GetCpuProfileSampleInterval(const V8ContextHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(uint32_t, V8Context_GetCpuProfileSampleInterval, const V8ContextHandle& handle)
+
     auto spContext = handle.GetEntity();
     return !spContext.IsEmpty() ? spContext->GetCpuProfileSampleInterval() : 0;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_SetCpuProfileSampleInterval(const V8ContextHandle& handle, uint32_t value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_SetCpuProfileSampleInterval, const V8ContextHandle& handle, uint32_t value)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->SetCpuProfileSampleInterval(value);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Context_WriteIsolateHeapSnapshot(const V8ContextHandle& handle, void* pvStream) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Context_WriteIsolateHeapSnapshot, const V8ContextHandle& handle, void* pvStream)
+
     auto spContext = handle.GetEntity();
     if (!spContext.IsEmpty())
     {
         spContext->WriteIsolateHeapSnapshot(pvStream);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Object_GetNamedProperty(const V8ObjectHandle& handle, const StdString& name, V8Value& value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_GetNamedProperty, const V8ObjectHandle& handle, const StdString& name, V8Value& value)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1715,12 +2309,13 @@ NATIVE_ENTRY_POINT(void) V8Object_GetNamedProperty(const V8ObjectHandle& handle,
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(StdBool) V8Object_TryGetNamedProperty(const V8ObjectHandle& handle, const StdString& name, V8Value& value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(StdBool, V8Object_TryGetNamedProperty, const V8ObjectHandle& handle, const StdString& name, V8Value& value)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1735,12 +2330,13 @@ NATIVE_ENTRY_POINT(StdBool) V8Object_TryGetNamedProperty(const V8ObjectHandle& h
     }
 
     return false;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Object_SetNamedProperty(const V8ObjectHandle& handle, const StdString& name, const V8Value& value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_SetNamedProperty, const V8ObjectHandle& handle, const StdString& name, const V8Value& value)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1753,12 +2349,13 @@ NATIVE_ENTRY_POINT(void) V8Object_SetNamedProperty(const V8ObjectHandle& handle,
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(StdBool) V8Object_DeleteNamedProperty(const V8ObjectHandle& handle, const StdString& name) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(StdBool, V8Object_DeleteNamedProperty, const V8ObjectHandle& handle, const StdString& name)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1773,12 +2370,13 @@ NATIVE_ENTRY_POINT(StdBool) V8Object_DeleteNamedProperty(const V8ObjectHandle& h
     }
 
     return false;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Object_GetPropertyNames(const V8ObjectHandle& handle, StdBool includeIndices, std::vector<StdString>& names) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_GetPropertyNames, const V8ObjectHandle& handle, StdBool includeIndices, std::vector<StdString>& names)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1791,12 +2389,51 @@ NATIVE_ENTRY_POINT(void) V8Object_GetPropertyNames(const V8ObjectHandle& handle,
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Object_GetIndexedProperty(const V8ObjectHandle& handle, int32_t index, V8Value& value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_GetNamedProperties, const V8ObjectHandle& handle, const std::vector<StdString>& names, std::vector<V8Value>& values)
+
+    auto spV8ObjectHolder = handle.GetEntity();
+    if (!spV8ObjectHolder.IsEmpty())
+    {
+        try
+        {
+            V8ObjectHelpers::GetProperties(spV8ObjectHolder, names, values);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_SetNamedProperties, const V8ObjectHandle& handle, const std::vector<StdString>& names, const std::vector<V8Value>& values)
+
+    auto spV8ObjectHolder = handle.GetEntity();
+    if (!spV8ObjectHolder.IsEmpty())
+    {
+        try
+        {
+            V8ObjectHelpers::SetProperties(spV8ObjectHolder, names, values);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_GetIndexedProperty, const V8ObjectHandle& handle, int32_t index, V8Value& value)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1809,12 +2446,13 @@ NATIVE_ENTRY_POINT(void) V8Object_GetIndexedProperty(const V8ObjectHandle& handl
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Object_SetIndexedProperty(const V8ObjectHandle& handle, int32_t index, const V8Value& value) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_SetIndexedProperty, const V8ObjectHandle& handle, int32_t index, const V8Value& value)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1827,12 +2465,13 @@ NATIVE_ENTRY_POINT(void) V8Object_SetIndexedProperty(const V8ObjectHandle& handl
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(StdBool) V8Object_DeleteIndexedProperty(const V8ObjectHandle& handle, int32_t index) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(StdBool, V8Object_DeleteIndexedProperty, const V8ObjectHandle& handle, int32_t index)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1847,12 +2486,13 @@ NATIVE_ENTRY_POINT(StdBool) V8Object_DeleteIndexedProperty(const V8ObjectHandle&
     }
 
     return false;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Object_GetPropertyIndices(const V8ObjectHandle& handle, std::vector<int32_t>& indices) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_GetPropertyIndices, const V8ObjectHandle& handle, std::vector<int32_t>& indices)
+
     indices.clear();
 
     auto spV8ObjectHolder = handle.GetEntity();
@@ -1867,12 +2507,78 @@ NATIVE_ENTRY_POINT(void) V8Object_GetPropertyIndices(const V8ObjectHandle& handl
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Object_Invoke(const V8ObjectHandle& handle, StdBool asConstructor, const std::vector<V8Value>& args, V8Value& result) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8ObjectHelpers::ArrayExportKind, V8Object_ExportArray, const V8ObjectHandle& handle, std::vector<V8Value>& values, std::vector<uint8_t>& packedValues)
+
+    values.clear();
+    packedValues.clear();
+
+    auto spV8ObjectHolder = handle.GetEntity();
+    if (!spV8ObjectHolder.IsEmpty())
+    {
+        try
+        {
+            return V8ObjectHelpers::ExportArray(spV8ObjectHolder, values, packedValues);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+    return V8ObjectHelpers::ArrayExportKind::Values;
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_Serialize, const V8ObjectHandle& handle, std::vector<uint8_t>& data, std::vector<V8Value>& sharedObjects)
+
+    data.clear();
+    sharedObjects.clear();
+
+    auto spV8ObjectHolder = handle.GetEntity();
+    if (!spV8ObjectHolder.IsEmpty())
+    {
+        try
+        {
+            V8ObjectHelpers::Serialize(spV8ObjectHolder, data, sharedObjects);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_ToJson, const V8ObjectHandle& handle, StdString& json)
+
+    auto spV8ObjectHolder = handle.GetEntity();
+    if (!spV8ObjectHolder.IsEmpty())
+    {
+        try
+        {
+            json = V8ObjectHelpers::ToJson(spV8ObjectHolder);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ScheduleScriptEngineException();
+        }
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_Invoke, const V8ObjectHandle& handle, StdBool asConstructor, const std::vector<V8Value>& args, V8Value& result)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1885,12 +2591,13 @@ NATIVE_ENTRY_POINT(void) V8Object_Invoke(const V8ObjectHandle& handle, StdBool a
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Object_InvokeMethod(const V8ObjectHandle& handle, const StdString& name, const std::vector<V8Value>& args, V8Value& result) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_InvokeMethod, const V8ObjectHandle& handle, const StdString& name, const std::vector<V8Value>& args, V8Value& result)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1903,12 +2610,13 @@ NATIVE_ENTRY_POINT(void) V8Object_InvokeMethod(const V8ObjectHandle& handle, con
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Object_GetArrayBufferOrViewInfo(const V8ObjectHandle& handle, V8Value& arrayBuffer, uint64_t& offset, uint64_t& size, uint64_t& length) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_GetArrayBufferOrViewInfo, const V8ObjectHandle& handle, V8Value& arrayBuffer, uint64_t& offset, uint64_t& size, uint64_t& length)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1928,12 +2636,13 @@ NATIVE_ENTRY_POINT(void) V8Object_GetArrayBufferOrViewInfo(const V8ObjectHandle&
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Object_InvokeWithArrayBufferOrViewData(const V8ObjectHandle& handle, void* pvAction) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_InvokeWithArrayBufferOrViewData, const V8ObjectHandle& handle, void* pvAction)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1946,12 +2655,13 @@ NATIVE_ENTRY_POINT(void) V8Object_InvokeWithArrayBufferOrViewData(const V8Object
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Object_InvokeWithArrayBufferOrViewDataWithArg(const V8ObjectHandle& handle, void* pvAction, void* pvArg) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Object_InvokeWithArrayBufferOrViewDataWithArg, const V8ObjectHandle& handle, void* pvAction, void* pvArg)
+
     auto spV8ObjectHolder = handle.GetEntity();
     if (!spV8ObjectHolder.IsEmpty())
     {
@@ -1965,45 +2675,49 @@ NATIVE_ENTRY_POINT(void) V8Object_InvokeWithArrayBufferOrViewDataWithArg(const V
             exception.ScheduleScriptEngineException();
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8DebugCallback_ConnectClient(const V8DebugCallbackHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8DebugCallback_ConnectClient, const V8DebugCallbackHandle& handle)
+
     SharedPtr<HostObjectUtil::DebugCallback> spCallback;
     if (handle.TryGetEntity(spCallback))
     {
         (*spCallback)(HostObjectUtil::DebugDirective::ConnectClient, nullptr);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8DebugCallback_SendCommand(const V8DebugCallbackHandle& handle, const StdString& command) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8DebugCallback_SendCommand, const V8DebugCallbackHandle& handle, const StdString& command)
+
     SharedPtr<HostObjectUtil::DebugCallback> spCallback;
     if (handle.TryGetEntity(spCallback))
     {
         (*spCallback)(HostObjectUtil::DebugDirective::SendCommand, &command);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8DebugCallback_DisconnectClient(const V8DebugCallbackHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8DebugCallback_DisconnectClient, const V8DebugCallbackHandle& handle)
+
     SharedPtr<HostObjectUtil::DebugCallback> spCallback;
     if (handle.TryGetEntity(spCallback))
     {
         (*spCallback)(HostObjectUtil::DebugDirective::DisconnectClient, nullptr);
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) NativeCallback_Invoke(const NativeCallbackHandle& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, NativeCallback_Invoke, const NativeCallbackHandle& handle)
+
     SharedPtr<HostObjectUtil::NativeCallback> spCallback;
     if (handle.TryGetEntity(spCallback))
     {
@@ -2018,47 +2732,109 @@ NATIVE_ENTRY_POINT(void) NativeCallback_Invoke(const NativeCallbackHandle& handl
         {
         }
     }
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Entity_Release(V8EntityHandleBase& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Entity_Release, V8EntityHandleBase& handle)
+
     handle.ReleaseEntity();
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(V8EntityHandleBase*) V8Entity_CloneHandle(V8EntityHandleBase& handle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(V8EntityHandleBase*, V8Entity_CloneHandle, V8EntityHandleBase& handle)
+
     return handle.Clone();
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8Entity_DestroyHandle(V8EntityHandleBase* pHandle) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8Entity_DestroyHandle, V8EntityHandleBase* pHandle)
+
     delete pHandle;
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) HostException_Schedule(StdString&& message, V8Value&& exception) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, HostException_Schedule, StdString&& message, V8Value&& exception)
+
     V8SplitProxyManaged::SetHostException(HostException(std::move(message), std::move(exception)));
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(size_t) V8UnitTestSupport_GetTextDigest(const StdString& value) noexcept
-{
+BEGIN_UNRECORDED_NATIVE_ENTRY_POINT(void, V8SplitProxyStatistics_SetEnabled, StdBool enabled)
+
+    V8SplitProxyStatistics::SetEnabled(enabled);
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_UNRECORDED_NATIVE_ENTRY_POINT(void, V8SplitProxyStatistics_Reset)
+
+    V8SplitProxyStatistics::Reset();
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_UNRECORDED_NATIVE_ENTRY_POINT(void, V8SplitProxyStatistics_GetSnapshot, std::vector<StdString>& names, std::vector<int32_t>& kinds, std::vector<uint64_t>& bucketCounts)
+
+    V8SplitProxyStatistics::GetSnapshot(names, kinds, bucketCounts);
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_UNRECORDED_NATIVE_ENTRY_POINT(void, V8TraceRecorder_SetEnabled, StdBool enabled)
+
+    V8TraceRecorder::SetEnabled(enabled);
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_UNRECORDED_NATIVE_ENTRY_POINT(void, V8TraceRecorder_Clear)
+
+    V8TraceRecorder::Clear();
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_UNRECORDED_NATIVE_ENTRY_POINT(void, V8TraceRecorder_WriteJson, void* pvStream)
+
+    try
+    {
+        V8TraceRecorder::WriteJson(pvStream);
+    }
+    catch (const HostException& exception)
+    {
+        V8_SPLIT_PROXY_MANAGED_INVOKE_VOID(ScheduleForwardingException, exception.GetException());
+    }
+
+END_NATIVE_ENTRY_POINT
+
+//-----------------------------------------------------------------------------
+
+BEGIN_NATIVE_ENTRY_POINT(size_t, V8UnitTestSupport_GetTextDigest, const StdString& value)
+
     return value.GetDigest();
-}
+
+END_NATIVE_ENTRY_POINT
 
 //-----------------------------------------------------------------------------
 
-NATIVE_ENTRY_POINT(void) V8UnitTestSupport_GetStatistics(uint64_t& isolateCount, uint64_t& contextCount) noexcept
-{
+BEGIN_NATIVE_ENTRY_POINT(void, V8UnitTestSupport_GetStatistics, uint64_t& isolateCount, uint64_t& contextCount)
+
     isolateCount = V8IsolateImpl::GetInstanceCount();
     contextCount = V8ContextImpl::GetInstanceCount();
-}
+
+END_NATIVE_ENTRY_POINT
@@ -55,6 +55,14 @@ class V8EntityHandleBase
 {
 public:
 
+    // Entity handles are allocated from a slab rather than individually; see
+    // V8EntityHandleSlab for details.
+
+    static const size_t MaxHandleSize = 32;
+
+    static void* operator new(size_t size);
+    static void operator delete(void* pvHandle) noexcept;
+
     virtual V8EntityHandleBase* Clone() const noexcept = 0;
     virtual StdString CreateStdString(v8::Local<v8::Value> hValue) const noexcept = 0;
     virtual void ReleaseEntity() noexcept = 0;
@@ -70,6 +78,11 @@ protected:
 // V8EntityHandle
 //-----------------------------------------------------------------------------
 
+// Readers register themselves in the handle's state word before copying the entity pointer, so
+// looking up an entity takes a fixed number of atomic operations and never blocks. Releasing the
+// entity marks the handle as released and then waits for registered readers to finish their
+// copies, which takes only a few instructions each.
+
 template <typename T>
 class V8EntityHandle final: public V8EntityHandleBase
 {
@@ -85,42 +98,29 @@ public:
     SharedPtr<T> GetEntity() const noexcept
     {
         SharedPtr<T> spEntity;
-
-        BEGIN_MUTEX_SCOPE(m_Mutex)
-            spEntity = m_spEntity;
-        END_MUTEX_SCOPE
-
-        if (spEntity.IsEmpty())
+        if (!TryGetEntity(spEntity))
         {
             ScheduleInvalidOperationException(GetEntityReleasedMessage(V8EntityName<T>::Get()));
         }
-        
+
         return spEntity;
     }
 
     bool TryGetEntity(SharedPtr<T>& spEntity) const noexcept
     {
-        BEGIN_MUTEX_SCOPE(m_Mutex)
-
-            if (m_spEntity.IsEmpty())
-            {
-                return false;
-            }
-
+        if ((m_State.fetch_add(1, std::memory_order_acquire) & ReleasedFlag) == 0)
+        {
             spEntity = m_spEntity;
-            return true;
+        }
 
-        END_MUTEX_SCOPE
+        m_State.fetch_sub(1, std::memory_order_release);
+        return !spEntity.IsEmpty();
     }
 
     V8EntityHandleBase* Clone() const noexcept override
     {
         SharedPtr<T> spEntity;
-
-        BEGIN_MUTEX_SCOPE(m_Mutex)
-            spEntity = m_spEntity;
-        END_MUTEX_SCOPE
-
+        TryGetEntity(spEntity);
         return new V8EntityHandle(std::move(spEntity));
     }
 
@@ -134,19 +134,27 @@ public:
     {
         SharedPtr<T> spEntity;
 
-        BEGIN_MUTEX_SCOPE(m_Mutex)
+        if ((m_State.fetch_or(ReleasedFlag, std::memory_order_acq_rel) & ReleasedFlag) == 0)
+        {
+            while ((m_State.load(std::memory_order_acquire) & ~ReleasedFlag) != 0)
+            {
+                std::this_thread::yield();
+            }
+
             spEntity = std::move(m_spEntity);
-        END_MUTEX_SCOPE
+        }
     }
 
 private:
 
+    static const uint32_t ReleasedFlag = 0x80000000U;
+
     explicit V8EntityHandle(SharedPtr<T>&& spEntity) noexcept :
         m_spEntity(std::move(spEntity))
     {
     }
 
-    mutable SimpleMutex m_Mutex;
+    mutable std::atomic<uint32_t> m_State { 0 };
     SharedPtr<T> m_spEntity;
 };
 
@@ -154,7 +162,8 @@ private:
 
 #define DEFINE_V8_ENTITY_HANDLE(TYPE, TARGET, NAME) \
     template <> struct V8EntityName<TARGET> final: StaticBase { static const StdChar* Get() { return NAME; } }; \
-    using TYPE = V8EntityHandle<TARGET>;
+    using TYPE = V8EntityHandle<TARGET>; \
+    static_assert(sizeof(TYPE) <= V8EntityHandleBase::MaxHandleSize, "entity handle too large for slab block");
 
 DEFINE_V8_ENTITY_HANDLE(V8IsolateHandle, V8Isolate, SL("V8 runtime"))
 DEFINE_V8_ENTITY_HANDLE(V8ContextHandle, V8Context, SL("V8 script engine"))
@@ -174,16 +183,18 @@ NATIVE_ENTRY_POINT(void) V8Environment_InitializeICU(const char* pICUData, uint3
 NATIVE_ENTRY_POINT(void*) Memory_Allocate(size_t size) noexcept;
 NATIVE_ENTRY_POINT(void*) Memory_AllocateZeroed(size_t size) noexcept;
 NATIVE_ENTRY_POINT(void) Memory_Free(const void* pMemory) noexcept;
+NATIVE_ENTRY_POINT(void*) Memory_AllocateTransient(size_t size) noexcept;
+NATIVE_ENTRY_POINT(void) Memory_FreeTransient(const void* pMemory) noexcept;
 
 NATIVE_ENTRY_POINT(StdString*) StdString_New(const StdChar* pValue, int32_t length) noexcept;
-NATIVE_ENTRY_POINT(const StdChar*) StdString_GetValue(const StdString& string, int32_t& length) noexcept;
+NATIVE_ENTRY_POINT(const void*) StdString_GetValue(const StdString& string, int32_t& length, StdBool& isOneByte) noexcept;
 NATIVE_ENTRY_POINT(void) StdString_SetValue(StdString& string, const StdChar* pValue, int32_t length) noexcept;
 NATIVE_ENTRY_POINT(void) StdString_Delete(StdString* pString) noexcept;
 
 NATIVE_ENTRY_POINT(std::vector<StdString>*) StdStringArray_New(int32_t elementCount) noexcept;
 NATIVE_ENTRY_POINT(int32_t) StdStringArray_GetElementCount(const std::vector<StdString>& stringArray) noexcept;
 NATIVE_ENTRY_POINT(void) StdStringArray_SetElementCount(std::vector<StdString>& stringArray, int32_t elementCount) noexcept;
-NATIVE_ENTRY_POINT(const StdChar*) StdStringArray_GetElement(const std::vector<StdString>& stringArray, int32_t index, int32_t& length) noexcept;
+NATIVE_ENTRY_POINT(const void*) StdStringArray_GetElement(const std::vector<StdString>& stringArray, int32_t index, int32_t& length, StdBool& isOneByte) noexcept;
 NATIVE_ENTRY_POINT(void) StdStringArray_SetElement(std::vector<StdString>& stringArray, int32_t index, const StdChar* pValue, int32_t length) noexcept;
 NATIVE_ENTRY_POINT(void) StdStringArray_Delete(std::vector<StdString>* pStringArray) noexcept;
 
@@ -233,13 +244,13 @@ NATIVE_ENTRY_POINT(void) V8Value_SetString(V8Value* pV8Value, const StdChar* pVa
 NATIVE_ENTRY_POINT(void) V8Value_SetDateTime(V8Value* pV8Value, double value) noexcept;
 NATIVE_ENTRY_POINT(void) V8Value_SetBigInt(V8Value* pV8Value, int32_t signBit, const uint8_t* pBytes, int32_t length) noexcept;
 NATIVE_ENTRY_POINT(void) V8Value_SetV8Object(V8Value* pV8Value, const V8ObjectHandle& handle, V8Value::Subtype subtype, V8Value::Flags flags) noexcept;
-NATIVE_ENTRY_POINT(void) V8Value_SetHostObject(V8Value* pV8Value, void* pvObject, V8Value::Subtype subtype, V8Value::Flags flags) noexcept;
+NATIVE_ENTRY_POINT(void) V8Value_SetHostObject(V8Value* pV8Value, void* pvObject, int32_t identity, int32_t typeId, V8Value::Subtype subtype, V8Value::Flags flags) noexcept;
 NATIVE_ENTRY_POINT(void) V8Value_Decode(const V8Value& value, V8Value::Decoded& decoded) noexcept;
 NATIVE_ENTRY_POINT(void) V8Value_Delete(V8Value* pV8Value) noexcept;
 
 NATIVE_ENTRY_POINT(void) V8CpuProfile_GetInfo(const v8::CpuProfile& profile, const V8EntityHandleBase& entityHandle, StdString& name, uint64_t& startTimestamp, uint64_t& endTimestamp, int32_t& sampleCount, const v8::CpuProfileNode*& pRootNode) noexcept;
 NATIVE_ENTRY_POINT(StdBool) V8CpuProfile_GetSample(const v8::CpuProfile& profile, int32_t index, uint64_t& nodeId, uint64_t& timestamp) noexcept;
-NATIVE_ENTRY_POINT(void) V8CpuProfileNode_GetInfo(const v8::CpuProfileNode& node, const V8EntityHandleBase& entityHandle, uint64_t& nodeId, int64_t& scriptId, StdString& scriptName, StdString& functionName, StdString& bailoutReason, int64_t& lineNumber, int64_t& columnNumber, uint64_t& hitCount, uint32_t& hitLineCount, int32_t& childCount);
+NATIVE_ENTRY_POINT(void) V8CpuProfileNode_GetInfo(const v8::CpuProfileNode& node, const V8EntityHandleBase& entityHandle, uint64_t& nodeId, int64_t& scriptId, StdString& scriptName, StdString& functionName, StdString& bailoutReason, int64_t& lineNumber, int64_t& columnNumber, uint64_t& hitCount, uint32_t& hitLineCount, int32_t& childCount) noexcept;
 NATIVE_ENTRY_POINT(StdBool) V8CpuProfileNode_GetHitLines(const v8::CpuProfileNode& node, std::vector<int32_t>& lineNumbers, std::vector<uint32_t>& hitCounts) noexcept;
 NATIVE_ENTRY_POINT(const v8::CpuProfileNode*) V8CpuProfileNode_GetChildNode(const v8::CpuProfileNode& node, int32_t index) noexcept;
 
@@ -251,6 +262,8 @@ NATIVE_ENTRY_POINT(double) V8Isolate_GetHeapSizeSampleInterval(const V8IsolateHa
 NATIVE_ENTRY_POINT(void) V8Isolate_SetHeapSizeSampleInterval(const V8IsolateHandle& handle, double milliseconds) noexcept;
 NATIVE_ENTRY_POINT(size_t) V8Isolate_GetMaxStackUsage(const V8IsolateHandle& handle) noexcept;
 NATIVE_ENTRY_POINT(void) V8Isolate_SetMaxStackUsage(const V8IsolateHandle& handle, size_t size) noexcept;
+NATIVE_ENTRY_POINT(size_t) V8Isolate_GetMaxStringCacheSize(const V8IsolateHandle& handle) noexcept;
+NATIVE_ENTRY_POINT(void) V8Isolate_SetMaxStringCacheSize(const V8IsolateHandle& handle, size_t size) noexcept;
 NATIVE_ENTRY_POINT(void) V8Isolate_AwaitDebuggerAndPause(const V8IsolateHandle& handle) noexcept;
 NATIVE_ENTRY_POINT(void) V8Isolate_CancelAwaitDebugger(const V8IsolateHandle& handle) noexcept;
 NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Isolate_Compile(const V8IsolateHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code) noexcept;
@@ -262,7 +275,7 @@ NATIVE_ENTRY_POINT(void) V8Isolate_SetEnableInterruptPropagation(const V8Isolate
 NATIVE_ENTRY_POINT(StdBool) V8Isolate_GetDisableHeapSizeViolationInterrupt(const V8IsolateHandle& handle) noexcept;
 NATIVE_ENTRY_POINT(void) V8Isolate_SetDisableHeapSizeViolationInterrupt(const V8IsolateHandle& handle, StdBool value) noexcept;
 NATIVE_ENTRY_POINT(void) V8Isolate_GetHeapStatistics(const V8IsolateHandle& handle, uint64_t& totalHeapSize, uint64_t& totalHeapSizeExecutable, uint64_t& totalPhysicalSize, uint64_t& totalAvailableSize, uint64_t& usedHeapSize, uint64_t& heapSizeLimit, uint64_t& totalExternalSize) noexcept;
-NATIVE_ENTRY_POINT(void) V8Isolate_GetStatistics(const V8IsolateHandle& handle, uint64_t& scriptCount, uint64_t& scriptCacheSize, uint64_t& moduleCount, std::vector<uint64_t>& postedTaskCounts, std::vector<uint64_t>& invokedTaskCounts) noexcept;
+NATIVE_ENTRY_POINT(void) V8Isolate_GetStatistics(const V8IsolateHandle& handle, uint64_t& scriptCount, uint64_t& scriptCacheSize, uint64_t& moduleCount, uint64_t& stringCacheHitCount, uint64_t& stringCacheMissCount, std::vector<uint64_t>& postedTaskCounts, std::vector<uint64_t>& invokedTaskCounts) noexcept;
 NATIVE_ENTRY_POINT(void) V8Isolate_CollectGarbage(const V8IsolateHandle& handle, StdBool exhaustive) noexcept;
 NATIVE_ENTRY_POINT(StdBool) V8Isolate_BeginCpuProfile(const V8IsolateHandle& handle, const StdString& name, StdBool recordSamples) noexcept;
 NATIVE_ENTRY_POINT(void) V8Isolate_EndCpuProfile(const V8IsolateHandle& handle, const StdString& name, void* pvAction) noexcept;
@@ -277,10 +290,18 @@ NATIVE_ENTRY_POINT(double) V8Context_GetIsolateHeapSizeSampleInterval(const V8Co
 NATIVE_ENTRY_POINT(void) V8Context_SetIsolateHeapSizeSampleInterval(const V8ContextHandle& handle, double milliseconds) noexcept;
 NATIVE_ENTRY_POINT(size_t) V8Context_GetMaxIsolateStackUsage(const V8ContextHandle& handle) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_SetMaxIsolateStackUsage(const V8ContextHandle& handle, size_t size) noexcept;
+NATIVE_ENTRY_POINT(size_t) V8Context_GetMaxIsolateStringCacheSize(const V8ContextHandle& handle) noexcept;
+NATIVE_ENTRY_POINT(void) V8Context_SetMaxIsolateStringCacheSize(const V8ContextHandle& handle, size_t size) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_InvokeWithLock(const V8ContextHandle& handle, void* pvAction) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_InvokeWithLockWithArg(const V8ContextHandle& handle, void* pvAction, void* pvArg) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_GetRootItem(const V8ContextHandle& handle, V8Value& item) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_AddGlobalItem(const V8ContextHandle& handle, const StdString& name, const V8Value& value, StdBool globalMembers) noexcept;
+NATIVE_ENTRY_POINT(void) V8Context_CreateArray(const V8ContextHandle& handle, const std::vector<V8Value>& values, V8Value& array) noexcept;
+NATIVE_ENTRY_POINT(void) V8Context_CreateObject(const V8ContextHandle& handle, const std::vector<StdString>& names, const std::vector<V8Value>& values, V8Value& obj) noexcept;
+NATIVE_ENTRY_POINT(void) V8Context_Deserialize(const V8ContextHandle& handle, const std::vector<uint8_t>& data, const std::vector<V8Value>& sharedObjects, V8Value& value) noexcept;
+NATIVE_ENTRY_POINT(void) V8Context_ParseJson(const V8ContextHandle& handle, const StdString& json, V8Value& value) noexcept;
+NATIVE_ENTRY_POINT(void) V8Context_ParseJsonUtf8(const V8ContextHandle& handle, const char* pJson, int32_t length, V8Value& value) noexcept;
+NATIVE_ENTRY_POINT(void) V8Context_CreateFastFunction(const V8ContextHandle& handle, void* pvFunction, FastHostObjectUtil::CallType returnType, const std::vector<int32_t>& argTypes, V8Value& function) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_AwaitDebuggerAndPause(const V8ContextHandle& handle) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_CancelAwaitDebugger(const V8ContextHandle& handle) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_ExecuteCode(const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, const StdString& code, StdBool evaluate, V8Value& result) noexcept;
@@ -289,6 +310,7 @@ NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Context_CompileProducingCache(const V8Cont
 NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Context_CompileConsumingCache(const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, const std::vector<uint8_t>& cacheBytes, StdBool& cacheAccepted) noexcept;
 NATIVE_ENTRY_POINT(V8ScriptHandle*) V8Context_CompileUpdatingCache(const V8ContextHandle& handle, StdString&& resourceName, StdString&& sourceMapUrl, uint64_t uniqueId, DocumentKind documentKind, void* pvDocumentInfo, StdString&& code, V8CacheKind cacheKind, std::vector<uint8_t>& cacheBytes, V8CacheResult& cacheResult) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_ExecuteScript(const V8ContextHandle& handle, const V8ScriptHandle& scriptHandle, StdBool evaluate, V8Value& result) noexcept;
+NATIVE_ENTRY_POINT(void) V8Context_ExecuteBatch(const V8ContextHandle& handle, const std::vector<int32_t>& commands, const std::vector<StdString>& names, const std::vector<V8Value>& values, std::vector<V8Value>& results, std::vector<StdString>& errors) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_Interrupt(const V8ContextHandle& handle) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_CancelInterrupt(const V8ContextHandle& handle) noexcept;
 NATIVE_ENTRY_POINT(StdBool) V8Context_GetEnableIsolateInterruptPropagation(const V8ContextHandle& handle) noexcept;
@@ -296,10 +318,12 @@ NATIVE_ENTRY_POINT(void) V8Context_SetEnableIsolateInterruptPropagation(const V8
 NATIVE_ENTRY_POINT(StdBool) V8Context_GetDisableIsolateHeapSizeViolationInterrupt(const V8ContextHandle& handle) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_SetDisableIsolateHeapSizeViolationInterrupt(const V8ContextHandle& handle, StdBool value) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_GetIsolateHeapStatistics(const V8ContextHandle& handle, uint64_t& totalHeapSize, uint64_t& totalHeapSizeExecutable, uint64_t& totalPhysicalSize, uint64_t& totalAvailableSize, uint64_t& usedHeapSize, uint64_t& heapSizeLimit, uint64_t& totalExternalSize) noexcept;
-NATIVE_ENTRY_POINT(void) V8Context_GetIsolateStatistics(const V8ContextHandle& handle, uint64_t& scriptCount, uint64_t& scriptCacheSize, uint64_t& moduleCount, std::vector<uint64_t>& postedTaskCounts, std::vector<uint64_t>& invokedTaskCounts) noexcept;
-NATIVE_ENTRY_POINT(void) V8Context_GetStatistics(const V8ContextHandle& handle, uint64_t& scriptCount, uint64_t& moduleCount, uint64_t& moduleCacheSize) noexcept;
+NATIVE_ENTRY_POINT(void) V8Context_GetIsolateStatistics(const V8ContextHandle& handle, uint64_t& scriptCount, uint64_t& scriptCacheSize, uint64_t& moduleCount, uint64_t& stringCacheHitCount, uint64_t& stringCacheMissCount, std::vector<uint64_t>& postedTaskCounts, std::vector<uint64_t>& invokedTaskCounts) noexcept;
+NATIVE_ENTRY_POINT(void) V8Context_GetStatistics(const V8ContextHandle& handle, uint64_t& scriptCount, uint64_t& moduleCount, uint64_t& moduleCacheSize, uint64_t& propertyNameCacheHitCount, uint64_t& propertyNameCacheMissCount, uint64_t& objectIdentityCacheHitCount, uint64_t& objectIdentityCacheMissCount, uint64_t& fastFunctionCallCount) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_CollectGarbage(const V8ContextHandle& handle, StdBool exhaustive) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_OnAccessSettingsChanged(const V8ContextHandle& handle) noexcept;
+NATIVE_ENTRY_POINT(void) V8Context_OnEnumerationSettingsChanged(const V8ContextHandle& handle) noexcept;
+NATIVE_ENTRY_POINT(void) V8Context_InvalidateHostMemberCache(const V8ContextHandle& handle, const std::vector<StdString>& names) noexcept;
 NATIVE_ENTRY_POINT(StdBool) V8Context_BeginCpuProfile(const V8ContextHandle& handle, const StdString& name, StdBool recordSamples) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_EndCpuProfile(const V8ContextHandle& handle, const StdString& name, void* pvAction) noexcept;
 NATIVE_ENTRY_POINT(void) V8Context_CollectCpuProfileSample(const V8ContextHandle& handle) noexcept;
@@ -312,10 +336,15 @@ NATIVE_ENTRY_POINT(StdBool) V8Object_TryGetNamedProperty(const V8ObjectHandle& h
 NATIVE_ENTRY_POINT(void) V8Object_SetNamedProperty(const V8ObjectHandle& handle, const StdString& name, const V8Value& value) noexcept;
 NATIVE_ENTRY_POINT(StdBool) V8Object_DeleteNamedProperty(const V8ObjectHandle& handle, const StdString& name) noexcept;
 NATIVE_ENTRY_POINT(void) V8Object_GetPropertyNames(const V8ObjectHandle& handle, StdBool includeIndices, std::vector<StdString>& names) noexcept;
+NATIVE_ENTRY_POINT(void) V8Object_GetNamedProperties(const V8ObjectHandle& handle, const std::vector<StdString>& names, std::vector<V8Value>& values) noexcept;
+NATIVE_ENTRY_POINT(void) V8Object_SetNamedProperties(const V8ObjectHandle& handle, const std::vector<StdString>& names, const std::vector<V8Value>& values) noexcept;
 NATIVE_ENTRY_POINT(void) V8Object_GetIndexedProperty(const V8ObjectHandle& handle, int32_t index, V8Value& value) noexcept;
 NATIVE_ENTRY_POINT(void) V8Object_SetIndexedProperty(const V8ObjectHandle& handle, int32_t index, const V8Value& value) noexcept;
 NATIVE_ENTRY_POINT(StdBool) V8Object_DeleteIndexedProperty(const V8ObjectHandle& handle, int32_t index) noexcept;
 NATIVE_ENTRY_POINT(void) V8Object_GetPropertyIndices(const V8ObjectHandle& handle, std::vector<int32_t>& indices) noexcept;
+NATIVE_ENTRY_POINT(V8ObjectHelpers::ArrayExportKind) V8Object_ExportArray(const V8ObjectHandle& handle, std::vector<V8Value>& values, std::vector<uint8_t>& packedValues) noexcept;
+NATIVE_ENTRY_POINT(void) V8Object_Serialize(const V8ObjectHandle& handle, std::vector<uint8_t>& data, std::vector<V8Value>& sharedObjects) noexcept;
+NATIVE_ENTRY_POINT(void) V8Object_ToJson(const V8ObjectHandle& handle, StdString& json) noexcept;
 NATIVE_ENTRY_POINT(void) V8Object_Invoke(const V8ObjectHandle& handle, StdBool asConstructor, const std::vector<V8Value>& args, V8Value& result) noexcept;
 NATIVE_ENTRY_POINT(void) V8Object_InvokeMethod(const V8ObjectHandle& handle, const StdString& name, const std::vector<V8Value>& args, V8Value& result) noexcept;
 NATIVE_ENTRY_POINT(void) V8Object_GetArrayBufferOrViewInfo(const V8ObjectHandle& handle, V8Value& arrayBuffer, uint64_t& offset, uint64_t& size, uint64_t& length) noexcept;
@@ -334,5 +363,13 @@ NATIVE_ENTRY_POINT(void) V8Entity_DestroyHandle(V8EntityHandleBase* pHandle) noe
 
 NATIVE_ENTRY_POINT(void) HostException_Schedule(StdString&& message, V8Value&& exception) noexcept;
 
+NATIVE_ENTRY_POINT(void) V8SplitProxyStatistics_SetEnabled(StdBool enabled) noexcept;
+NATIVE_ENTRY_POINT(void) V8SplitProxyStatistics_Reset() noexcept;
+NATIVE_ENTRY_POINT(void) V8SplitProxyStatistics_GetSnapshot(std::vector<StdString>& names, std::vector<int32_t>& kinds, std::vector<uint64_t>& bucketCounts) noexcept;
+
+NATIVE_ENTRY_POINT(void) V8TraceRecorder_SetEnabled(StdBool enabled) noexcept;
+NATIVE_ENTRY_POINT(void) V8TraceRecorder_Clear() noexcept;
+NATIVE_ENTRY_POINT(void) V8TraceRecorder_WriteJson(void* pvStream) noexcept;
+
 NATIVE_ENTRY_POINT(size_t) V8UnitTestSupport_GetTextDigest(const StdString& value) noexcept;
 NATIVE_ENTRY_POINT(void) V8UnitTestSupport_GetStatistics(uint64_t& isolateCount, uint64_t& contextCount) noexcept;
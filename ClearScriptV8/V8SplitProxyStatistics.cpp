@@ -0,0 +1,293 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+
+//-----------------------------------------------------------------------------
+// V8SplitProxyHistogram
+//-----------------------------------------------------------------------------
+
+struct V8SplitProxyHistogram final
+{
+    std::array<std::atomic<uint64_t>, V8SplitProxyStatistics::BucketCount> BucketCounts {};
+};
+
+//-----------------------------------------------------------------------------
+// V8SplitProxyThreadStatistics
+//-----------------------------------------------------------------------------
+
+// Histograms are written only by the owning thread, so recording a crossing requires neither
+// locking nor read-modify-write instructions. Readers load the counters without synchronization
+// and may observe values that lag slightly behind the owning thread.
+//
+// A reset only advances the global epoch. Each thread clears its own histograms when it next
+// records a crossing and observes the new epoch; until then, readers ignore its stale counters.
+
+class V8SplitProxyThreadStatistics final
+{
+    PROHIBIT_COPY(V8SplitProxyThreadStatistics)
+
+public:
+
+    explicit V8SplitProxyThreadStatistics(uint64_t epoch);
+
+    V8SplitProxyHistogram* TryGetHistogram(size_t index, uint64_t epoch)
+    {
+        if (m_Epoch.load(std::memory_order_relaxed) != epoch)
+        {
+            for (auto& pHistogram : m_Histograms)
+            {
+                auto pTempHistogram = pHistogram.load(std::memory_order_relaxed);
+                if (pTempHistogram != nullptr)
+                {
+                    for (auto& bucketCount : pTempHistogram->BucketCounts)
+                    {
+                        bucketCount.store(0, std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            m_Epoch.store(epoch, std::memory_order_release);
+        }
+
+        auto pHistogram = m_Histograms[index].load(std::memory_order_relaxed);
+        if (pHistogram == nullptr)
+        {
+            pHistogram = new (std::nothrow) V8SplitProxyHistogram;
+            m_Histograms[index].store(pHistogram, std::memory_order_release);
+        }
+
+        return pHistogram;
+    }
+
+    const V8SplitProxyHistogram* TryGetCurrentHistogram(size_t index, uint64_t epoch) const
+    {
+        return (m_Epoch.load(std::memory_order_acquire) == epoch) ? m_Histograms[index].load(std::memory_order_acquire) : nullptr;
+    }
+
+    ~V8SplitProxyThreadStatistics();
+
+private:
+
+    std::atomic<uint64_t> m_Epoch;
+    std::array<std::atomic<V8SplitProxyHistogram*>, Constants::MaxSplitProxyStatisticsSiteCount> m_Histograms {};
+};
+
+//-----------------------------------------------------------------------------
+// V8SplitProxyStatisticsState
+//-----------------------------------------------------------------------------
+
+struct V8SplitProxyStatisticsState final
+{
+    using BucketCounts = std::array<uint64_t, V8SplitProxyStatistics::BucketCount>;
+
+    SimpleMutex Mutex;
+    std::atomic<uint64_t> Epoch { 0 };
+    std::vector<const V8SplitProxyStatistics::Site*> Sites;
+    std::vector<BucketCounts> RetiredBucketCounts;
+    std::unordered_set<V8SplitProxyThreadStatistics*> ThreadStatisticsSet;
+};
+
+//-----------------------------------------------------------------------------
+// local helper functions
+//-----------------------------------------------------------------------------
+
+static const size_t NoSiteIndex = SIZE_MAX;
+
+//-----------------------------------------------------------------------------
+
+static V8SplitProxyStatisticsState& GetState()
+{
+    // The state is never destroyed; threads that exit during process shutdown may still retire
+    // their counters into it.
+
+    static auto pState = new V8SplitProxyStatisticsState;
+    return *pState;
+}
+
+//-----------------------------------------------------------------------------
+
+static V8SplitProxyThreadStatistics& GetThreadStatistics()
+{
+    // A throwing initializer leaves the thread-local uninitialized; the next access retries it.
+
+    thread_local V8SplitProxyThreadStatistics threadStatistics(GetState().Epoch.load(std::memory_order_relaxed));
+    return threadStatistics;
+}
+
+//-----------------------------------------------------------------------------
+
+static size_t GetBucketIndex(std::chrono::steady_clock::duration elapsed)
+{
+    auto nanoseconds = static_cast<uint64_t>(std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(), static_cast<std::chrono::nanoseconds::rep>(0)));
+    return std::min(static_cast<size_t>(std::bit_width(nanoseconds)), V8SplitProxyStatistics::BucketCount - 1);
+}
+
+//-----------------------------------------------------------------------------
+// V8SplitProxyThreadStatistics implementation
+//-----------------------------------------------------------------------------
+
+V8SplitProxyThreadStatistics::V8SplitProxyThreadStatistics(uint64_t epoch):
+    m_Epoch(epoch)
+{
+    auto& state = GetState();
+    BEGIN_MUTEX_SCOPE(state.Mutex)
+        state.ThreadStatisticsSet.insert(this);
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8SplitProxyThreadStatistics::~V8SplitProxyThreadStatistics()
+{
+    auto& state = GetState();
+    BEGIN_MUTEX_SCOPE(state.Mutex)
+
+        state.ThreadStatisticsSet.erase(this);
+
+        auto retire = m_Epoch.load(std::memory_order_relaxed) == state.Epoch.load(std::memory_order_relaxed);
+        for (size_t index = 0; index < m_Histograms.size(); index++)
+        {
+            auto pHistogram = m_Histograms[index].load(std::memory_order_relaxed);
+            if (pHistogram != nullptr)
+            {
+                if (retire && (index < state.RetiredBucketCounts.size()))
+                {
+                    auto& retiredBucketCounts = state.RetiredBucketCounts[index];
+                    for (size_t bucketIndex = 0; bucketIndex < V8SplitProxyStatistics::BucketCount; bucketIndex++)
+                    {
+                        retiredBucketCounts[bucketIndex] += pHistogram->BucketCounts[bucketIndex].load(std::memory_order_relaxed);
+                    }
+                }
+
+                delete pHistogram;
+            }
+        }
+
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+// V8SplitProxyStatistics implementation
+//-----------------------------------------------------------------------------
+
+void V8SplitProxyStatistics::Reset()
+{
+    // Live counters belong to their owning threads, which clear them upon observing the new
+    // epoch. A crossing that completes concurrently with a reset may be lost.
+
+    auto& state = GetState();
+    BEGIN_MUTEX_SCOPE(state.Mutex)
+
+        for (auto& retiredBucketCounts : state.RetiredBucketCounts)
+        {
+            retiredBucketCounts.fill(0);
+        }
+
+        state.Epoch.fetch_add(1, std::memory_order_relaxed);
+
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8SplitProxyStatistics::GetSnapshot(std::vector<StdString>& names, std::vector<int32_t>& kinds, std::vector<uint64_t>& bucketCounts)
+{
+    names.clear();
+    kinds.clear();
+    bucketCounts.clear();
+
+    auto& state = GetState();
+    BEGIN_MUTEX_SCOPE(state.Mutex)
+
+        auto epoch = state.Epoch.load(std::memory_order_relaxed);
+        for (size_t index = 0; index < state.Sites.size(); index++)
+        {
+            auto siteBucketCounts = state.RetiredBucketCounts[index];
+            for (auto pThreadStatistics : state.ThreadStatisticsSet)
+            {
+                auto pHistogram = pThreadStatistics->TryGetCurrentHistogram(index, epoch);
+                if (pHistogram != nullptr)
+                {
+                    for (size_t bucketIndex = 0; bucketIndex < BucketCount; bucketIndex++)
+                    {
+                        siteBucketCounts[bucketIndex] += pHistogram->BucketCounts[bucketIndex].load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            if (std::any_of(siteBucketCounts.begin(), siteBucketCounts.end(), [] (uint64_t count) { return count > 0; }))
+            {
+                auto pSite = state.Sites[index];
+                names.emplace_back(std::string(pSite->m_pName));
+                kinds.push_back(static_cast<int32_t>(pSite->m_Kind));
+                bucketCounts.insert(bucketCounts.end(), siteBucketCounts.begin(), siteBucketCounts.end());
+            }
+        }
+
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8SplitProxyStatistics::Record(Site& site, std::chrono::steady_clock::duration elapsed) noexcept
+{
+    // Registering a site or a thread allocates; if that fails, the sample is dropped.
+
+    try
+    {
+        auto index = site.m_Index.load(std::memory_order_acquire);
+        if (index == 0)
+        {
+            index = Register(site);
+        }
+
+        if (index != NoSiteIndex)
+        {
+            auto pHistogram = GetThreadStatistics().TryGetHistogram(index - 1, GetState().Epoch.load(std::memory_order_relaxed));
+            if (pHistogram != nullptr)
+            {
+                auto& bucketCount = pHistogram->BucketCounts[GetBucketIndex(elapsed)];
+                bucketCount.store(bucketCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+        }
+    }
+    catch (...)
+    {
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+size_t V8SplitProxyStatistics::Register(Site& site)
+{
+    auto& state = GetState();
+    BEGIN_MUTEX_SCOPE(state.Mutex)
+
+        // site indices are stored off by one so that zero can denote an unregistered site
+
+        auto index = site.m_Index.load(std::memory_order_relaxed);
+        if (index == 0)
+        {
+            if (state.Sites.size() < Constants::MaxSplitProxyStatisticsSiteCount)
+            {
+                // reserve both vectors first so that a failed allocation leaves them consistent
+
+                state.Sites.reserve(state.Sites.size() + 1);
+                state.RetiredBucketCounts.reserve(state.Sites.size() + 1);
+                state.Sites.push_back(&site);
+                state.RetiredBucketCounts.emplace_back();
+                index = state.Sites.size();
+            }
+            else
+            {
+                index = NoSiteIndex;
+            }
+
+            site.m_Index.store(index, std::memory_order_release);
+        }
+
+        return index;
+
+    END_MUTEX_SCOPE
+}
@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8SplitProxyStatistics
+//-----------------------------------------------------------------------------
+
+class V8SplitProxyStatistics final: StaticBase
+{
+public:
+
+    enum class SiteKind: int32_t
+    {
+        ManagedMethod,
+        NativeEntryPoint
+    };
+
+    // Bucket N counts crossings that took [2^(N-1), 2^N) nanoseconds; bucket 0 counts crossings
+    // below clock resolution, and the last bucket absorbs everything beyond its lower bound.
+
+    static const size_t BucketCount = 32;
+
+    class Site final
+    {
+        PROHIBIT_COPY(Site)
+
+    public:
+
+        constexpr Site(SiteKind kind, const char* pName) noexcept:
+            m_Kind(kind),
+            m_pName(pName)
+        {
+        }
+
+        const char* GetName() const noexcept
+        {
+            return m_pName;
+        }
+
+    private:
+
+        friend class V8SplitProxyStatistics;
+
+        SiteKind m_Kind;
+        const char* m_pName;
+        std::atomic<size_t> m_Index { 0 };
+    };
+
+    class Scope final
+    {
+        PROHIBIT_COPY(Scope)
+        PROHIBIT_HEAP(Scope)
+
+    public:
+
+        explicit Scope(Site& site) noexcept:
+            Scope(V8Instrumentation::GetFlags(), site)
+        {
+        }
+
+        Scope(V8Instrumentation::Flags instrumentationFlags, Site& site) noexcept:
+            m_pSite(::HasFlag(instrumentationFlags, V8Instrumentation::Flags::Statistics) ? &site : nullptr)
+        {
+            if (m_pSite != nullptr)
+            {
+                m_StartTime = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~Scope()
+        {
+            if (m_pSite != nullptr)
+            {
+                Record(*m_pSite, std::chrono::steady_clock::now() - m_StartTime);
+            }
+        }
+
+    private:
+
+        Site* m_pSite;
+        std::chrono::steady_clock::time_point m_StartTime;
+    };
+
+    static bool IsEnabled() noexcept
+    {
+        return ::HasFlag(V8Instrumentation::GetFlags(), V8Instrumentation::Flags::Statistics);
+    }
+
+    static void SetEnabled(bool enabled) noexcept
+    {
+        V8Instrumentation::SetEnabled(V8Instrumentation::Flags::Statistics, enabled);
+    }
+
+    static void Reset();
+    static void GetSnapshot(std::vector<StdString>& names, std::vector<int32_t>& kinds, std::vector<uint64_t>& bucketCounts);
+
+private:
+
+    static void Record(Site& site, std::chrono::steady_clock::duration elapsed) noexcept;
+    static size_t Register(Site& site);
+};
+
+//-----------------------------------------------------------------------------
+
+#define V8_SPLIT_PROXY_STATISTICS_SCOPE(KIND, NAME) \
+    static V8SplitProxyStatistics::Site t_StatisticsSite(V8SplitProxyStatistics::SiteKind::KIND, NAME); \
+    V8SplitProxyStatistics::Scope t_StatisticsScope(t_StatisticsSite)
@@ -0,0 +1,204 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+
+//-----------------------------------------------------------------------------
+// V8TraceEvent
+//-----------------------------------------------------------------------------
+
+// Each slot carries the sequence number of the event it holds. A writer zeroes the sequence
+// number before updating the slot and publishes the new one afterward, so a reader can detect
+// and skip a slot that was overwritten while it was being read.
+
+struct V8TraceEvent final
+{
+    std::atomic<uint64_t> Sequence { 0 };
+    std::atomic<const char*> pName { nullptr };
+    std::atomic<uint64_t> Info { 0 };
+    std::atomic<int64_t> Timestamp { 0 };
+};
+
+//-----------------------------------------------------------------------------
+// V8TraceBuffer
+//-----------------------------------------------------------------------------
+
+struct V8TraceBuffer final
+{
+    std::atomic<uint64_t> NextSequence { 0 };
+    std::atomic<uint64_t> ClearSequence { 0 };
+    std::array<V8TraceEvent, Constants::MaxTraceEventCount> Events;
+};
+
+//-----------------------------------------------------------------------------
+// V8TraceEventData
+//-----------------------------------------------------------------------------
+
+struct V8TraceEventData final
+{
+    const char* pName;
+    uint64_t Info;
+    int64_t Timestamp;
+};
+
+//-----------------------------------------------------------------------------
+// local helper functions
+//-----------------------------------------------------------------------------
+
+static V8TraceBuffer& GetBuffer()
+{
+    // The buffer is allocated on first use and never destroyed; threads that exit during process
+    // shutdown may still record events into it.
+
+    static auto pBuffer = new V8TraceBuffer;
+    return *pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+static uint32_t GetThreadId() noexcept
+{
+    static std::atomic<uint32_t> s_NextThreadId { 0 };
+    thread_local auto t_ThreadId = ++s_NextThreadId;
+    return t_ThreadId;
+}
+
+//-----------------------------------------------------------------------------
+
+static uint64_t PackInfo(V8TraceRecorder::Category category, V8TraceRecorder::Phase phase) noexcept
+{
+    return (static_cast<uint64_t>(GetThreadId()) << 16) | (static_cast<uint64_t>(category) << 8) | static_cast<uint8_t>(phase);
+}
+
+//-----------------------------------------------------------------------------
+
+static const char* GetCategoryName(uint64_t info)
+{
+    switch (static_cast<V8TraceRecorder::Category>((info >> 8) & 0xFF))
+    {
+        case V8TraceRecorder::Category::Execution: return "execution";
+        case V8TraceRecorder::Category::HostCall: return "host";
+        case V8TraceRecorder::Category::ModuleLoad: return "module";
+        case V8TraceRecorder::Category::CallWithLock: return "lock";
+        case V8TraceRecorder::Category::GarbageCollection: return "gc";
+        default: return "unknown";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void GetSnapshot(std::vector<V8TraceEventData>& events)
+{
+    auto& buffer = GetBuffer();
+
+    auto endSequence = buffer.NextSequence.load(std::memory_order_acquire);
+    auto startSequence = std::max(buffer.ClearSequence.load(std::memory_order_relaxed), (endSequence > Constants::MaxTraceEventCount) ? endSequence - Constants::MaxTraceEventCount : 0);
+
+    events.clear();
+    events.reserve(static_cast<size_t>(endSequence - startSequence));
+
+    for (auto sequence = startSequence + 1; sequence <= endSequence; sequence++)
+    {
+        auto& event = buffer.Events[(sequence - 1) % Constants::MaxTraceEventCount];
+        if (event.Sequence.load(std::memory_order_acquire) == sequence)
+        {
+            V8TraceEventData data { event.pName.load(std::memory_order_relaxed), event.Info.load(std::memory_order_relaxed), event.Timestamp.load(std::memory_order_relaxed) };
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (event.Sequence.load(std::memory_order_relaxed) == sequence)
+            {
+                events.push_back(data);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void WriteBytes(void* pvStream, const std::string& bytes)
+{
+    V8_SPLIT_PROXY_MANAGED_INVOKE_VOID(WriteBytesToStream, pvStream, reinterpret_cast<const uint8_t*>(bytes.data()), static_cast<int32_t>(bytes.size()));
+}
+
+//-----------------------------------------------------------------------------
+// V8TraceRecorder implementation
+//-----------------------------------------------------------------------------
+
+void V8TraceRecorder::Clear() noexcept
+{
+    auto& buffer = GetBuffer();
+    buffer.ClearSequence.store(buffer.NextSequence.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8TraceRecorder::Record(Category category, const char* pName, Phase phase) noexcept
+{
+    auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    auto& buffer = GetBuffer();
+    auto sequence = buffer.NextSequence.fetch_add(1, std::memory_order_relaxed) + 1;
+    auto& event = buffer.Events[(sequence - 1) % Constants::MaxTraceEventCount];
+
+    event.Sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    event.pName.store(pName, std::memory_order_relaxed);
+    event.Info.store(PackInfo(category, phase), std::memory_order_relaxed);
+    event.Timestamp.store(timestamp, std::memory_order_relaxed);
+
+    event.Sequence.store(sequence, std::memory_order_release);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8TraceRecorder::WriteJson(void* pvStream)
+{
+    // The output uses the Trace Event Format's JSON object form, which chrome://tracing and
+    // Perfetto accept directly. Timestamps are in microseconds.
+
+    const size_t chunkSize = 64 * 1024;
+
+    std::vector<V8TraceEventData> events;
+    GetSnapshot(events);
+
+    std::string json("{\"traceEvents\":[");
+    auto first = true;
+
+    for (const auto& event : events)
+    {
+        if (!first)
+        {
+            json += ',';
+        }
+
+        auto timestamp = static_cast<uint64_t>(std::max(event.Timestamp, static_cast<int64_t>(0)));
+        auto fraction = std::to_string(timestamp % 1000);
+
+        json += "{\"name\":\"";
+        json += event.pName;
+        json += "\",\"cat\":\"";
+        json += GetCategoryName(event.Info);
+        json += "\",\"ph\":\"";
+        json += static_cast<char>(event.Info & 0xFF);
+        json += "\",\"ts\":";
+        json += std::to_string(timestamp / 1000);
+        json += '.';
+        json.append(3 - fraction.length(), '0');
+        json += fraction;
+        json += ",\"pid\":1,\"tid\":";
+        json += std::to_string(event.Info >> 16);
+        json += '}';
+
+        first = false;
+
+        if (json.length() >= chunkSize)
+        {
+            WriteBytes(pvStream, json);
+            json.clear();
+        }
+    }
+
+    json += "],\"displayTimeUnit\":\"ns\"}";
+    WriteBytes(pvStream, json);
+}
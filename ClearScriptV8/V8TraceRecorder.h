@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8TraceRecorder
+//-----------------------------------------------------------------------------
+
+class V8TraceRecorder final: StaticBase
+{
+public:
+
+    enum class Category: uint8_t
+    {
+        Execution,
+        HostCall,
+        ModuleLoad,
+        CallWithLock,
+        GarbageCollection
+    };
+
+    enum class Phase: char
+    {
+        Begin = 'B',
+        End = 'E'
+    };
+
+    // Event names must have static storage duration and must not require JSON escaping. When
+    // recording is disabled, a scope costs one relaxed load of the shared instrumentation flags;
+    // a split proxy crossing shares that load with its statistics scope. GarbageCollection events
+    // are recorded by the isolate's GC prologue and epilogue callbacks.
+
+    class Scope final
+    {
+        PROHIBIT_COPY(Scope)
+        PROHIBIT_HEAP(Scope)
+
+    public:
+
+        Scope(Category category, const char* pName) noexcept:
+            Scope(V8Instrumentation::GetFlags(), category, pName)
+        {
+        }
+
+        Scope(V8Instrumentation::Flags instrumentationFlags, Category category, const char* pName) noexcept:
+            m_pName(::HasFlag(instrumentationFlags, V8Instrumentation::Flags::Trace) ? pName : nullptr),
+            m_Category(category)
+        {
+            if (m_pName != nullptr)
+            {
+                Record(m_Category, m_pName, Phase::Begin);
+            }
+        }
+
+        ~Scope()
+        {
+            if (m_pName != nullptr)
+            {
+                Record(m_Category, m_pName, Phase::End);
+            }
+        }
+
+    private:
+
+        const char* m_pName;
+        Category m_Category;
+    };
+
+    static bool IsEnabled() noexcept
+    {
+        return ::HasFlag(V8Instrumentation::GetFlags(), V8Instrumentation::Flags::Trace);
+    }
+
+    static void SetEnabled(bool enabled) noexcept
+    {
+        V8Instrumentation::SetEnabled(V8Instrumentation::Flags::Trace, enabled);
+    }
+
+    static void Clear() noexcept;
+    static void Record(Category category, const char* pName, Phase phase) noexcept;
+    static void WriteJson(void* pvStream);
+};
+
+//-----------------------------------------------------------------------------
+
+#define V8_TRACE_SCOPE(CATEGORY, NAME) \
+    V8TraceRecorder::Scope t_TraceScope(V8TraceRecorder::Category::CATEGORY, NAME)
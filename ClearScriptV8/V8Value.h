@@ -67,6 +67,76 @@ private:
     std::vector<uint64_t> m_Words;
 };
 
+//-----------------------------------------------------------------------------
+// V8StringBuffer
+//-----------------------------------------------------------------------------
+
+// A string buffer holds immutable string content that is shared between the host and V8. V8
+// accesses it as the resource behind an external string; the host borrows it through string
+// values. The buffer is destroyed when the last of its references is released.
+
+class V8StringBuffer final
+{
+    PROHIBIT_COPY(V8StringBuffer)
+
+public:
+
+    V8StringBuffer(const uint8_t* pData, size_t length):
+        m_Bytes(pData, pData + length),
+        m_Length(length),
+        m_IsOneByte(true),
+        m_RefCount(1)
+    {
+    }
+
+    V8StringBuffer(const uint16_t* pData, size_t length):
+        m_Bytes(reinterpret_cast<const uint8_t*>(pData), reinterpret_cast<const uint8_t*>(pData + length)),
+        m_Length(length),
+        m_IsOneByte(false),
+        m_RefCount(1)
+    {
+    }
+
+    void AddRef()
+    {
+        m_RefCount.Increment();
+    }
+
+    void Release()
+    {
+        if (m_RefCount.Decrement() < 1)
+        {
+            delete this;
+        }
+    }
+
+    const void* GetData() const
+    {
+        return m_Bytes.data();
+    }
+
+    size_t GetLength() const
+    {
+        return m_Length;
+    }
+
+    bool IsOneByte() const
+    {
+        return m_IsOneByte;
+    }
+
+private:
+
+    ~V8StringBuffer()
+    {
+    }
+
+    std::vector<uint8_t> m_Bytes;
+    size_t m_Length;
+    bool m_IsOneByte;
+    RefCount m_RefCount;
+};
+
 //-----------------------------------------------------------------------------
 // V8Value
 //-----------------------------------------------------------------------------
@@ -95,6 +165,11 @@ public:
         DateTime
     };
 
+    enum StringViewInitializer
+    {
+        StringView
+    };
+
     enum class Type: uint8_t
     {
         // IMPORTANT: maintain bitwise equivalence with managed enum V8.SplitProxy.V8Value.Type
@@ -142,7 +217,9 @@ public:
         Async = 0x0002,
         Generator = 0x0004,
         Pending = 0x0008,
-        Rejected = 0x0010
+        Rejected = 0x0010,
+        OneByte = 0x0020,
+        Borrowed = 0x0040
     };
 
     struct WireData;
@@ -178,11 +255,26 @@ public:
     }
 
     explicit V8Value(const StdString* pString):
-        m_Type(Type::String)
+        m_Type(Type::String),
+        m_Subtype(Subtype::None),
+        m_Flags(Flags::None)
     {
         m_Data.pString = pString;
     }
 
+    // A string view borrows the contents of a shared string buffer instead of copying them. The
+    // buffer is also the resource behind a V8 external string, so the view remains valid for the
+    // lifetime of the value regardless of V8 heap activity. See V8IsolateImpl::CreateStringValue.
+
+    V8Value(StringViewInitializer, V8StringBuffer* pBuffer):
+        m_Type(Type::String),
+        m_Subtype(Subtype::None),
+        m_Flags(pBuffer->IsOneByte() ? ::CombineFlags(Flags::Borrowed, Flags::OneByte) : Flags::Borrowed)
+    {
+        pBuffer->AddRef();
+        m_Data.pStringBuffer = pBuffer;
+    }
+
     V8Value(DateTimeInitializer, double value):
         m_Type(Type::DateTime)
     {
@@ -281,7 +373,7 @@ public:
 
     bool AsString(const StdString*& pString) const
     {
-        if (m_Type == Type::String)
+        if ((m_Type == Type::String) && !IsStringView())
         {
             pString = m_Data.pString;
             return true;
@@ -290,6 +382,17 @@ public:
         return false;
     }
 
+    bool AsStringBuffer(V8StringBuffer*& pBuffer) const
+    {
+        if (IsStringView())
+        {
+            pBuffer = m_Data.pStringBuffer;
+            return true;
+        }
+
+        return false;
+    }
+
     bool AsDateTime(double& result) const
     {
         if (m_Type == Type::DateTime)
@@ -338,6 +441,11 @@ public:
         return false;
     }
 
+    bool IsStringView() const
+    {
+        return (m_Type == Type::String) && ::HasFlag(m_Flags, Flags::Borrowed);
+    }
+
     Type GetType() const
     {
         return m_Type;
@@ -357,6 +465,7 @@ private:
         bool BooleanValue;
         double DoubleValue;
         const StdString* pString;
+        V8StringBuffer* pStringBuffer;
         V8ObjectHolder* pV8ObjectHolder;
         HostObjectHolder* pHostObjectHolder;
         const V8BigInt* pBigInt;
@@ -378,7 +487,15 @@ private:
         }
         else if (m_Type == Type::String)
         {
-            m_Data.pString = new StdString(*that.m_Data.pString);
+            if (that.IsStringView())
+            {
+                that.m_Data.pStringBuffer->AddRef();
+                m_Data.pStringBuffer = that.m_Data.pStringBuffer;
+            }
+            else
+            {
+                m_Data.pString = new StdString(*that.m_Data.pString);
+            }
         }
         else if (m_Type == Type::DateTime)
         {
@@ -411,7 +528,11 @@ private:
 
     void Dispose()
     {
-        if (m_Type == Type::String)
+        if (IsStringView())
+        {
+            m_Data.pStringBuffer->Release();
+        }
+        else if (m_Type == Type::String)
         {
             delete m_Data.pString;
         }
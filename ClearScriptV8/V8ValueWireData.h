@@ -31,6 +31,7 @@ struct V8Value::WireData
         int32_t Int32Value;
         double DoubleValue;
         const StdChar* pStringData;
+        const uint8_t* pOneByteStringData;
         const uint64_t* pBigIntData;
         const V8ObjectHandle* pV8ObjectHandle;
         void* pvHostObject;
@@ -49,6 +50,7 @@ static_assert(offsetof(V8Value::WireData, IdentityHash) == 4, "The managed Split
 static_assert(offsetof(V8Value::WireData, Int32Value) == 8, "The managed SplitProxy code assumes that offsetof(V8Value::WireData, Int32Value) is 8 on all platforms.");
 static_assert(offsetof(V8Value::WireData, DoubleValue) == 8, "The managed SplitProxy code assumes that offsetof(V8Value::WireData, DoubleValue) is 8 on all platforms.");
 static_assert(offsetof(V8Value::WireData, pStringData) == 8, "The managed SplitProxy code assumes that offsetof(V8Value::WireData, pStringData) is 8 on all platforms.");
+static_assert(offsetof(V8Value::WireData, pOneByteStringData) == 8, "The managed SplitProxy code assumes that offsetof(V8Value::WireData, pOneByteStringData) is 8 on all platforms.");
 static_assert(offsetof(V8Value::WireData, pBigIntData) == 8, "The managed SplitProxy code assumes that offsetof(V8Value::WireData, pBigIntData) is 8 on all platforms.");
 static_assert(offsetof(V8Value::WireData, pV8ObjectHandle) == 8, "The managed SplitProxy code assumes that offsetof(V8Value::WireData, pV8ObjectHandle) is 8 on all platforms.");
 static_assert(offsetof(V8Value::WireData, pvHostObject) == 8, "The managed SplitProxy code assumes that offsetof(V8Value::WireData, pvHostObject) is 8 on all platforms.");
@@ -110,11 +112,11 @@ struct V8Value::FastResult final: WireData
         switch (Type)
         {
             case Type::String:
-                ::Memory_Free(pStringData);
+                ::Memory_FreeTransient(pStringData);
                 break;
 
             case Type::BigInt:
-                ::Memory_Free(pBigIntData);
+                ::Memory_FreeTransient(pBigIntData);
                 break;
 
             case Type::V8Object: